@@ -30,7 +30,7 @@ main(int argc, char* argv[])
 	while (!glfwWindowShouldClose(window)) {
 		render(window);
 		glfwSwapBuffers(window);
-		glfwPollEvents();
+		pollEvents(window);
 	}
 
 	glfwDestroyWindow(window);
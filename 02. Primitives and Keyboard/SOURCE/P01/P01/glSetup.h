@@ -4,7 +4,9 @@
 #if defined(__APPLE__)&& defined(__MACH__)
 #include <OpenGL/glu.h>
 #else
+#ifdef _WIN32
 #include <windows.h>
+#endif
 #include <GL/glu.h>
 #endif
 
@@ -18,6 +20,14 @@ extern float dpiScaling;
 
 extern int vsync;
 
+// Offscreen rendering without a window or a display for unattended runs (GLFW 3.4 or later),
+// chosen before initializeOpenGL() or by GL_HEADLESS=egl
+enum HeadlessBackend { HEADLESS_NONE = 0, HEADLESS_EGL };
+
+extern int headless;
+extern int headlessW, headlessH;	// Framebuffer size, GL_HEADLESS_SIZE=WxH
+extern float headlessSeconds;	// Closing the window after, GL_HEADLESS_SECONDS, 0 for never
+
 extern bool perspectiveView;
 extern float fovy;
 extern float nearDist;
@@ -25,6 +35,7 @@ extern float farDist;
 
 GLFWwindow* initializeOpenGL(int argc, char* argv[], GLfloat bg[4]);
 void reshape(GLFWwindow* window, int w, int h);
+void pollEvents(GLFWwindow* window);	// glfwPollEvents() closing the window after headlessSeconds
 void setupProjectionMatrix();
 
 void drawAxes(float l, float w);
@@ -72,7 +72,7 @@ int main(int argc, char* argv[]) {
 	float	previous = (float)glfwGetTime();//
 	float	elapsed = 0;
 	while (!glfwWindowShouldClose(window)) {
-		glfwPollEvents();
+		pollEvents(window);
 
 		float	now = (float)glfwGetTime();
 		float	delta_t = now - previous;
@@ -73,7 +73,7 @@ main(int argc, char* argv[])
 	float elapsed = 0;
 	while (!glfwWindowShouldClose(window))
 	{
-		glfwPollEvents();
+		pollEvents(window);
 
 		float now = (float)glfwGetTime();
 		float delta_t = now - previous;
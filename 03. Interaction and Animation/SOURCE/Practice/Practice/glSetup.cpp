@@ -1,10 +1,14 @@
 #include "glSetup.h"
 
+#include <stdlib.h>
 #include <string.h>
 #include <iostream>
 
 using namespace std;
 
+// The null platform of GLFW 3.4 has no window system, creating the contexts through EGL
+#define HEADLESS_SUPPORTED	(GLFW_VERSION_MAJOR > 3 || (GLFW_VERSION_MAJOR == 3 && GLFW_VERSION_MINOR >= 4))
+
 bool perspectiveView = true;
 
 float screenScale = 0.5f;
@@ -15,6 +19,12 @@ float dpiScaling = 0;
 
 int vsync = 1;
 
+int headless = HEADLESS_NONE;
+int headlessW = 1280, headlessH = 720;
+float headlessSeconds = 0;
+
+static double headlessDeadline = 0;	// glfwGetTime() closing the window, 0 for never
+
 float fovy = 46.4f;
 
 float nearDist = 1.0f;
@@ -51,26 +61,78 @@ reshape(GLFWwindow* window, int w, int h)
 	cerr << " with screen " << screenW << " x " << screenH << endl;
 }
 
+// Backend from the environment unless chosen by the program,
+// e.g., GL_HEADLESS=egl GL_HEADLESS_SIZE=640x480 GL_HEADLESS_SECONDS=10
+static void
+selectHeadless()
+{
+	const char* backend = getenv("GL_HEADLESS");
+	if (!headless && backend && strcmp(backend, "0") != 0) {
+		if (strcmp(backend, "egl") != 0) cerr << "GL_HEADLESS=" << backend << " is not supported, using egl" << endl;
+		headless = HEADLESS_EGL;
+	}
+
+	const char* size = getenv("GL_HEADLESS_SIZE");
+	if (size && strchr(size, 'x')) {
+		headlessW = atoi(size);
+		headlessH = atoi(strchr(size, 'x') + 1);
+	}
+
+	const char* seconds = getenv("GL_HEADLESS_SECONDS");
+	if (seconds) headlessSeconds = (float)atof(seconds);
+}
+
+// The lessons own their loops, so their event polling ends an unattended run as if the window were closed
+void
+pollEvents(GLFWwindow* window)
+{
+	glfwPollEvents();
+	if (headlessDeadline > 0 && glfwGetTime() >= headlessDeadline) glfwSetWindowShouldClose(window, GLFW_TRUE);
+}
+
 GLFWwindow*
 initializeOpenGL(int argc, char* argv[], GLfloat bgColor[4])
 {
 	glfwSetErrorCallback(errorCallback);
 
+	selectHeadless();
+	if (headless) {
+#if HEADLESS_SUPPORTED
+		glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+#else
+		cerr << "Headless rendering requires GLFW 3.4 or later" << endl;
+		exit(EXIT_FAILURE);
+#endif
+	}
+
 	if (!glfwInit()) exit(EXIT_FAILURE);
 
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
 
-	glfwWindowHint(GLFW_SAMPLES, 4);
-
-	GLFWmonitor* monitor = glfwGetPrimaryMonitor();
-	int monitorW, monitorH;
-	glfwGetMonitorPhysicalSize(monitor, &monitorW, &monitorH);
-	cerr << "Status: Monitor " << monitorW << "mm x " << monitorH << "mm" << endl;
+	// Single-sampled offscreen for images comparable across runs
+	glfwWindowHint(GLFW_SAMPLES, headless ? 0 : 4);
+#if HEADLESS_SUPPORTED
+	if (headless) {
+		glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+	}
+#endif
 
-	const GLFWvidmode* videoMode = glfwGetVideoMode(monitor);
-	if (screenW == 0) screenW = int(videoMode->width * screenScale);
-	if (screenH == 0) screenH = int(videoMode->height * screenScale);
+	if (headless) {
+		screenW = headlessW;
+		screenH = headlessH;
+	}
+	else {
+		GLFWmonitor* monitor = glfwGetPrimaryMonitor();
+		int monitorW, monitorH;
+		glfwGetMonitorPhysicalSize(monitor, &monitorW, &monitorH);
+		cerr << "Status: Monitor " << monitorW << "mm x " << monitorH << "mm" << endl;
+
+		const GLFWvidmode* videoMode = glfwGetVideoMode(monitor);
+		if (screenW == 0) screenW = int(videoMode->width * screenScale);
+		if (screenH == 0) screenH = int(videoMode->height * screenScale);
+	}
 
 	GLFWwindow* window = glfwCreateWindow(screenW, screenH, argv[0], NULL, NULL);
 	if (!window) {
@@ -102,6 +164,8 @@ initializeOpenGL(int argc, char* argv[], GLfloat bgColor[4])
 
 	glfwSwapInterval(vsync);
 
+	if (headless && headlessSeconds > 0) headlessDeadline = glfwGetTime() + headlessSeconds;
+
 	return window;
 }
 
@@ -1,4 +1,5 @@
 #include "glSetup.h"
+#include "mesh.h"
 
 #ifdef _WIN32
 #define _USE_MATH_DEFINES    // To include the definition of M_PI in math.h
@@ -20,8 +21,11 @@ void    quit();
 void    render(GLFWwindow* window);
 void    keyboard(GLFWwindow* window, int key, int code, int action, int mods);
 
-bool    readMesh(const char* filename);
-void    deleteMesh();
+void    buildEdges();
+
+// Mesh read from an OFF file and its edges
+Mesh    mesh;
+set<set<int>> edges;
 
 // Camera configuation
 vec3    eye(3, 3, 3);
@@ -69,7 +73,7 @@ main(int argc, char* argv[])
     float   elapsed = 0;
     while (!glfwWindowShouldClose(window))
     {
-        glfwPollEvents();         // Events
+        pollEvents(window);       // Events
 
         render(window);           // Draw one frame
         glfwSwapBuffers(window);  // Swap buffers
@@ -89,7 +93,8 @@ void
 init()
 {
     // Prepare mesh
-    readMesh("m01_bunny.off");
+    readMesh("m01_bunny.off", mesh);
+    buildEdges();
     cout << endl;
 }
 
@@ -97,7 +102,8 @@ void
 quit()
 {
     // Delete mesh
-    deleteMesh();
+    deleteMesh(mesh);
+    edges.clear();
 }
 
 // Light
@@ -143,64 +149,17 @@ setDiffuseColor(const vec3& color)
 
 // Draw a sphere after setting up its material
 
-// Read a mesh from a given OFF file
-int     nVertices = 0, nFaces = 0, nEdges = 0;
-vec3* vertex = NULL;
-int* face[3] = { NULL, NULL, NULL };
-set<set<int>> edges;
-
-bool
-readMesh(const char* filename)
+// Collect the edges of the mesh
+void
+buildEdges()
 {
-    ifstream    is(filename);
-    if (is.fail()) return false;
-
-    char    magicNumber[256];
-    is >> magicNumber;
-
-    // # vertices, # faces, # edges
-    is >> nVertices >> nFaces >> nEdges;
-    cout << "# vertices = " << nVertices << endl;
-    cout << "# faces = " << nFaces << endl;
-
-
-    // Vertices
-    vertex = new vec3[nVertices];
-    for (int i = 0; i < nVertices; i++) 
-        is >> vertex[i].x >> vertex[i].y >> vertex[i].z;
-
-    // Faces
-    face[0] = new int[nFaces]; 
-    face[1] = new int[nFaces];
-    face[2] = new int[nFaces];
-
-    int n;
-    for (int i = 0; i < nFaces; i++)
-    {
-        is >> n >> face[0][i] >> face[1][i] >> face[2][i];
-        if (n != 3) cout << "# vertices of the " << i << "-th faces = " << n << endl;
-    }
-
-    for (int i = 0; i < nFaces; i++) {
-        edges.insert({ face[0][i], face[1][i] });
-        edges.insert({ face[1][i], face[2][i] });
-        edges.insert({ face[2][i], face[0][i] });
+    for (int i = 0; i < mesh.nFaces; i++) {
+        const uvec3& f = mesh.face[i];
+        edges.insert({ (int)f[0], (int)f[1] });
+        edges.insert({ (int)f[1], (int)f[2] });
+        edges.insert({ (int)f[2], (int)f[0] });
     }
     cout << "# edges = " << edges.size() << endl;
-
-    return true;
-}
-
-// Delete the vertices and faces of the mesh
-void
-deleteMesh()
-{
-    if (vertex) { delete[] vertex; vertex = NULL; }
-    if (face[0]) { delete[] face[0]; face[0] = NULL; }
-    if (face[1]) { delete[] face[1]; face[1] = NULL; }
-    if (face[2]) { delete[] face[2]; face[2] = NULL; }
-
-    if (!edges.empty()) { edges.clear(); }
 }
 
 // Draw the vertices of the mesh only
@@ -219,7 +178,7 @@ drawMesh()
     glBegin(GL_LINES);
     for (const auto& edge : edges) {
         for (int k : edge) {
-            glVertex3f(vertex[k].x, vertex[k].y, vertex[k].z);
+            glVertex3f(mesh.vertex[k].x, mesh.vertex[k].y, mesh.vertex[k].z);
         }
     }
     glEnd();
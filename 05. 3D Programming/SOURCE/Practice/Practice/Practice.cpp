@@ -1,4 +1,6 @@
 #include "glSetup.h"
+#include "mesh.h"
+#include "quadricCache.h"
 
 #ifdef _WIN32
 #define _USE_MATH_DEFINES    // To include the definition of M_PI in math.h
@@ -17,8 +19,8 @@ void    quit();
 void    render(GLFWwindow* window);
 void    keyboard(GLFWwindow* window, int key, int code, int action, int mods);
 
-bool    readMesh(const char* filename);
-void    deleteMesh();
+// Mesh read from an OFF file
+Mesh    mesh;
 
 // Camera configuation
 vec3    eye(3, 3, 3);
@@ -38,11 +40,6 @@ GLfloat bgColor[4] = { 1, 1, 1, 1 };
 // Selected example
 int selection = 1;
 
-// Sphere, cylinder
-GLUquadricObj* sphere = NULL;
-GLUquadricObj* cylinder = NULL;
-GLUquadricObj* disk = NULL;
-
 // Play configuration
 bool    pause = true;
 
@@ -85,7 +82,7 @@ main(int argc, char* argv[])
     float   elapsed = 0;
     while (!glfwWindowShouldClose(window))
     {
-        glfwPollEvents();         // Events
+        pollEvents(window);       // Events
 
         // Time passed during a single loop
         float   now = (float)glfwGetTime();
@@ -125,27 +122,8 @@ main(int argc, char* argv[])
 void
 init()
 {
-    // Prepare quadric shapes
-    sphere = gluNewQuadric();
-    gluQuadricDrawStyle(sphere, GLU_FILL);
-    gluQuadricNormals(sphere, GLU_SMOOTH);
-    gluQuadricOrientation(sphere, GLU_OUTSIDE);
-    gluQuadricTexture(sphere, GL_FALSE);
-
-    cylinder = gluNewQuadric();
-    gluQuadricDrawStyle(cylinder, GLU_FILL);
-    gluQuadricNormals(cylinder, GLU_SMOOTH);
-    gluQuadricOrientation(cylinder, GLU_OUTSIDE);
-    gluQuadricTexture(cylinder, GL_FALSE);
-
-    disk = gluNewQuadric();
-    gluQuadricDrawStyle(disk, GLU_FILL);
-    gluQuadricNormals(disk, GLU_SMOOTH);
-    gluQuadricOrientation(disk, GLU_OUTSIDE);
-    gluQuadricTexture(disk, GL_FALSE);
-
     // Prepare mesh
-    readMesh("m01_bunny.off");
+    readMesh("m01_bunny.off", mesh);
 
     // Keyboard
     cout << endl;
@@ -161,13 +139,11 @@ init()
 void
 quit()
 {
-    // Delete quadric shapes
-    gluDeleteQuadric(sphere);
-    gluDeleteQuadric(cylinder);
-    gluDeleteQuadric(disk);
+    // Delete the tessellations of the quadric shapes
+    deleteQuadricCache();
 
     // Delete mesh
-    deleteMesh();
+    deleteMesh(mesh);
 }
 
 // Light
@@ -219,7 +195,7 @@ drawSphere(float radius, const vec3& color)
     setDiffuseColor(color);
 
     // Sphere using GLU quadrics
-    gluSphere(sphere, radius, 36, 36);
+    drawQuadricSphere(radius, 36, 36);
 }
 
 // Draw a cylinder after setting up its material
@@ -230,7 +206,7 @@ drawCylinder(float radius, float height, const vec3& color)
     setDiffuseColor(color);
 
     // Cylinder using GLU quadrics
-    gluCylinder(cylinder, radius, radius, height, 72, 5);
+    drawQuadricCylinder(radius, radius, height, 72, 5);
 }
 
 // Draw a disk after setting up its material
@@ -241,56 +217,7 @@ drawDisk(float inner_radius, float outer_radius, const vec3& color)
     setDiffuseColor(color);
 
     // Disk using GLU quadrics
-    gluDisk(disk, inner_radius, outer_radius, 72, 5);
-}
-
-// Read a mesh from a given OFF file
-int     nVertices = 0, nFaces = 0, nEdges = 0;
-vec3* vertex = NULL;
-int* face[3] = { NULL, NULL, NULL };
-
-bool
-readMesh(const char* filename)
-{
-    ifstream    is(filename);
-    if (is.fail()) return false;
-
-    char    magicNumber[256];
-    is >> magicNumber;
-
-    // # vertices, # faces, # edges
-    is >> nVertices >> nFaces >> nEdges;
-    cout << "# vertices = " << nVertices << endl;
-    cout << "# faces = " << nFaces << endl;
-
-    // Vertices
-    vertex = new vec3[nVertices];
-    for (int i = 0; i < nVertices; i++)
-        is >> vertex[i].x >> vertex[i].y >> vertex[i].z;
-
-    // Faces
-    face[0] = new int[nFaces];    // Only support triangles
-    face[1] = new int[nFaces];
-    face[2] = new int[nFaces];
-
-    int n;
-    for (int i = 0; i < nFaces; i++)
-    {
-        is >> n >> face[0][i] >> face[1][i] >> face[2][i];
-        if (n != 3) cout << "# vertices of the " << i << "-th faces = " << n << endl;
-    }
-
-    return true;
-}
-
-// Delete the vertices and faces of the mesh
-void
-deleteMesh()
-{
-    if (vertex) { delete[] vertex; vertex = NULL; }
-    if (face[0]) { delete[] face[0]; face[0] = NULL; }
-    if (face[1]) { delete[] face[1]; face[1] = NULL; }
-    if (face[2]) { delete[] face[2]; face[2] = NULL; }
+    drawQuadricDisk(inner_radius, outer_radius, 72, 5);
 }
 
 // Draw the vertices of the mesh only
@@ -307,8 +234,8 @@ drawMesh()
     // Draw all the vertices of the bunny model
     glPointSize(3 * dpiScaling);
     glBegin(GL_POINTS);
-    for (int i = 0; i < nVertices; i++)
-        glVertex3f(vertex[i].x, vertex[i].y, vertex[i].z);
+    for (int i = 0; i < mesh.nVertices; i++)
+        glVertex3f(mesh.vertex[i].x, mesh.vertex[i].y, mesh.vertex[i].z);
     glEnd();
 }
 
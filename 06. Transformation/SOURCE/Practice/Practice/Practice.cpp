@@ -1,6 +1,7 @@
 #define GLM_ENABLE_EXPERIMENTAL
 
 #include "glSetup.h"
+#include "quadricCache.h"
 
 #ifdef _WIN32
 #define _USE_MATH_DEFINES   // To include the definition of M_PI in math.h
@@ -37,11 +38,6 @@ GLfloat bgColor[4] = { 1, 1, 1, 1 };
 // Selected example
 int selection = 1;
 
-// Sphere, cylinder
-GLUquadricObj* sphere = NULL;
-GLUquadricObj* cylinder = NULL;
-GLUquadricObj* disk = NULL;
-
 // Paly configuration
 bool    pause = false;
 
@@ -82,7 +78,7 @@ main(int argc, char* argv[])
     float   elapsed = 0;
     while (!glfwWindowShouldClose(window))
     {
-        glfwPollEvents();             // Events
+        pollEvents(window);           // Events
 
         // Time passed during a single loop
         float   now = (float)glfwGetTime();
@@ -118,25 +114,6 @@ main(int argc, char* argv[])
 void
 init()
 {
-    // Prepare quadric shapes
-    sphere = gluNewQuadric();
-    gluQuadricDrawStyle(sphere, GLU_FILL);
-    gluQuadricNormals(sphere, GLU_SMOOTH);
-    gluQuadricOrientation(sphere, GLU_OUTSIDE);
-    gluQuadricTexture(sphere, GL_FALSE);
-
-    cylinder = gluNewQuadric();
-    gluQuadricDrawStyle(cylinder, GLU_FILL);
-    gluQuadricNormals(cylinder, GLU_SMOOTH);
-    gluQuadricOrientation(cylinder, GLU_OUTSIDE);
-    gluQuadricTexture(cylinder, GL_FALSE);
-
-    disk = gluNewQuadric();
-    gluQuadricDrawStyle(disk, GLU_FILL);
-    gluQuadricNormals(disk, GLU_SMOOTH);
-    gluQuadricOrientation(disk, GLU_OUTSIDE);
-    gluQuadricTexture(disk, GL_FALSE);
-
     // Keyboard
     cout << endl;
     cout << "Keyboard input: space for play/pause" << endl;
@@ -153,10 +130,8 @@ init()
 void
 quit()
 {
-    // Delete quadric shapes
-    gluDeleteQuadric(sphere);
-    gluDeleteQuadric(cylinder);
-    gluDeleteQuadric(disk);
+    // Delete the tessellations of the quadric shapes
+    deleteQuadricCache();
 }
 
 // Light
@@ -205,7 +180,7 @@ drawSphere(float radius, const vec3& color)
     setDiffuseColor(color);
 
     // Sphere using GLU quadrics
-    gluSphere(sphere, radius, 72, 72);
+    drawQuadricSphere(radius, 72, 72);
 }
 
 // Draw a cylinder after setting up its material
@@ -216,7 +191,7 @@ drawCylinder(float radius, float height, const vec3& color)
     setDiffuseColor(color);
 
     // Cylinder using GLU quadrics
-    gluCylinder(cylinder, radius, radius, height, 72, 5);
+    drawQuadricCylinder(radius, radius, height, 72, 5);
 }
 
 // Draw a disk after setting up its material
@@ -227,7 +202,7 @@ drawDisk(float inner_radius, float outer_radius, const vec3& color)
     setDiffuseColor(color);
 
     // Disk using GLU quadrics
-    gluDisk(disk, inner_radius, outer_radius, 72, 5);
+    drawQuadricDisk(inner_radius, outer_radius, 72, 5);
 }
 
 // Draw a unit cube
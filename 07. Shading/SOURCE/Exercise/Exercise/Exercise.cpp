@@ -1,4 +1,6 @@
 #include "glSetup.h"
+#include "mesh.h"
+#include "meshHalfEdge.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -13,8 +15,9 @@ void	quit();
 void	render(GLFWwindow* window);
 void	keyboard(GLFWwindow* window, int key, int code, int action, int mods);
 
-bool	readMesh(const char* filename);
-void	deleteMesh();
+//mesh read from an OFF file and its half-edges
+Mesh		mesh;
+HalfEdges	halfEdges;
 
 //camera configuation
 vec3	eye(3, 3, 3);
@@ -50,6 +53,7 @@ float	period = 4.0;
 
 //drawing parameters
 bool	polygonFill = true;
+bool	borders = true;		//border and non-manifold edges
 
 //current frame
 int		frame = 0;
@@ -83,7 +87,7 @@ int main(int argc, char* argv[]) {
 	float	elapsed = 0;
 	while (!glfwWindowShouldClose(window))
 	{
-		glfwPollEvents();		//events
+		pollEvents(window);		//events
 
 		//time passed during a single loop
 		float	now = (float)glfwGetTime();
@@ -115,13 +119,19 @@ int main(int argc, char* argv[]) {
 
 void init() {
 	//prepare mesh
-	readMesh("m01_bunny.off");
+	readMesh("m01_bunny.off", mesh);
+	buildHalfEdges(mesh, halfEdges);
+
+	cout << "# border edges = " << halfEdges.nBoundaryEdges << endl;
+	cout << "# non-manifold edges = " << halfEdges.nNonManifoldEdges << endl;
+	cout << "# non-manifold vertices = " << halfEdges.nNonManifoldVertices << endl;
 
 	//keyboard
 	cout << endl;
 	cout << "Keyboard Input : space for play/pause" << endl;
 	cout << "Keyboard Input : s for turn on/off smooth shading" << endl;
 	cout << "Keyboard Input : f for polygon fill on/off" << endl;
+	cout << "Keyboard Input : b for border and non-manifold edges on/off" << endl;
 	cout << endl;
 	cout << "Keyboard Input : 1 for drawing normal vectors of triangles of the bunny model" << endl;
 	cout << "Keyboard Input : 2 for drawing normal vectors of of the bunny model" << endl;
@@ -129,7 +139,8 @@ void init() {
 
 void quit() {
 	//delete mesh
-	deleteMesh();
+	deleteHalfEdges(halfEdges);
+	deleteMesh(mesh);
 }
 
 // light
@@ -164,121 +175,68 @@ void setDiffuseColor(const vec3& color) {
 	glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, mat_diffuse);
 }
 
-//read a mesh from a given OFF file
-int		nVertices = 0, nFaces = 0, nEdges = 0;
-glm::vec3* vertex = NULL;
-glm::vec3* vnormal = NULL; //vetex normal
-glm::vec3* fnormal = NULL; //face normal
-int* face[3] = { NULL, NULL, NULL };
-
-bool readMesh(const char* filename) {
-	ifstream	is(filename);
-	if (is.fail()) return false;
-
-	char	magicNumber[256];
-	is >> magicNumber;
-
-	// # vertices, # faces, # edges
-	is >> nVertices >> nFaces >> nEdges;
-	cout << "# vertices = " << nVertices << endl;
-	cout << "# faces = " << nFaces << endl;
-
-	//vertices
-	vertex = new vec3[nVertices];
-	for (int i = 0; i < nVertices; i++)
-		is >> vertex[i].x >> vertex[i].y >> vertex[i].z;
-
-	//vertex normals
-	vnormal = new glm::vec3[nVertices];
-	for (int i = 0; i < nVertices; i++)
-		vnormal[i] = glm::vec3(0, 0, 0);
-
-	//face normals
-	fnormal = new glm::vec3[nFaces];
-
-	//faces
-	face[0] = new int[nFaces]; //only support triangles
-	face[1] = new int[nFaces];
-	face[2] = new int[nFaces];
-
-	int n;
-	for (int i = 0; i < nFaces; i++) {
-		is >> n >> face[0][i] >> face[1][i] >> face[2][i];
-		if (n != 3) cout << "# vertices of the " << i << "-th faces = " << n << endl;
-
-		//normal vector of the face
-		glm::vec3	v1 = vertex[face[1][i]] - vertex[face[0][i]];
-		glm::vec3	v2 = vertex[face[2][i]] - vertex[face[0][i]];
-		glm::vec3	v = normalize(cross(v1, v2));
-
-		fnormal[i] = v;
-
-		//add it to the normal vector of each vertex
-		vnormal[face[0][i]] += v;
-		vnormal[face[1][i]] += v;
-		vnormal[face[2][i]] += v;
-	}
-
-	//normalization of the normal vectors
-	for (int i = 0; i < nVertices; i++)
-		vnormal[i] = normalize(vnormal[i]);
-
-	return true;
-}
-
-//delete the vertices and faces of the mesh
-void deleteMesh() {
-	if (vertex) { delete[] vertex; vertex = NULL; }
-	if (vnormal) { delete[] vnormal; vnormal = NULL; }
-	if (fnormal) { delete[] fnormal; fnormal = NULL; }
-	if (face[0]) { delete[] face[0]; face[0] = NULL; }
-	if (face[1]) { delete[] face[1]; face[1] = NULL; }
-	if (face[2]) { delete[] face[2]; face[2] = NULL; }
-}
-
 void drawNormalTriangles() {
 
 	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < nFaces; i++) {
-		glNormal3fv(value_ptr(fnormal[i]));
+	for (int i = 0; i < mesh.nFaces; i++) {
+		glNormal3fv(value_ptr(mesh.fnormal[i]));
 		for (int j = 0; j < 3; j++)
-			glVertex3fv(value_ptr(vertex[face[j][i]]));
+			glVertex3fv(value_ptr(mesh.vertex[mesh.face[i][j]]));
 	}
 	glEnd();
 
 	glBegin(GL_LINES);
-	for (int i = 0; i < nFaces; i++) {
+	for (int i = 0; i < mesh.nFaces; i++) {
 		vec3 centerVertex = { 0,0,0 };
 		for (int j = 0; j < 3; j++) {
-			centerVertex.x += vertex[face[j][i]].x / 3;
-			centerVertex.y += vertex[face[j][i]].y / 3;
-			centerVertex.z += vertex[face[j][i]].z / 3;
+			centerVertex.x += mesh.vertex[mesh.face[i][j]].x / 3;
+			centerVertex.y += mesh.vertex[mesh.face[i][j]].y / 3;
+			centerVertex.z += mesh.vertex[mesh.face[i][j]].z / 3;
 		}
 
 		glVertex3f(centerVertex.x, centerVertex.y, centerVertex.z);
-		glVertex3f(centerVertex.x + fnormal[i].x / 10, centerVertex.y + fnormal[i].y / 10, centerVertex.z + fnormal[i].z / 10);
+		glVertex3f(centerVertex.x + mesh.fnormal[i].x / 10, centerVertex.y + mesh.fnormal[i].y / 10, centerVertex.z + mesh.fnormal[i].z / 10);
 	}
 	glEnd();
 }
 
 void drawNormalVertices() {
 	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < nFaces; i++)
+	for (int i = 0; i < mesh.nFaces; i++)
 		for (int j = 0; j < 3; j++) {
-			glNormal3fv(value_ptr(vnormal[face[j][i]]));
-			glVertex3fv(value_ptr(vertex[face[j][i]]));
+			glNormal3fv(value_ptr(mesh.vnormal[mesh.face[i][j]]));
+			glVertex3fv(value_ptr(mesh.vertex[mesh.face[i][j]]));
 		}
 	glEnd();
 
 	glBegin(GL_LINES);
-	for (int i = 0; i < nVertices; i++) {
-		glVertex3f(vertex[i].x, vertex[i].y, vertex[i].z);
-		glVertex3f(vertex[i].x + vnormal[i].x / 10, vertex[i].y + vnormal[i].y / 10, vertex[i].z + vnormal[i].z / 10);
+	for (int i = 0; i < mesh.nVertices; i++) {
+		glVertex3f(mesh.vertex[i].x, mesh.vertex[i].y, mesh.vertex[i].z);
+		glVertex3f(mesh.vertex[i].x + mesh.vnormal[i].x / 10, mesh.vertex[i].y + mesh.vnormal[i].y / 10, mesh.vertex[i].z + mesh.vnormal[i].z / 10);
 	}
 	glEnd();
 
 }
 
+//half-edges without a twin, border edges in red and non-manifold edges in magenta
+void drawBorders() {
+	glDisable(GL_LIGHTING);
+	glLineWidth(3 * dpiScaling);
+
+	glBegin(GL_LINES);
+	for (int h = 0; h < 3 * mesh.nFaces; h++) {
+		if (halfEdges.twin[h] >= 0) continue;
+
+		if (halfEdges.twin[h] == BORDER_EDGE)	glColor3f(1, 0, 0);
+		else									glColor3f(1, 0, 1);
+		glVertex3fv(value_ptr(mesh.vertex[edgeOrigin(mesh, h)]));
+		glVertex3fv(value_ptr(mesh.vertex[edgeTarget(mesh, h)]));
+	}
+	glEnd();
+
+	glLineWidth(1);
+}
+
 void render(GLFWwindow* window) {
 	//polygon mode
 	if (polygonFill)	glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
@@ -321,6 +279,8 @@ void render(GLFWwindow* window) {
 	case 1: drawNormalTriangles();												break;
 	case 2: drawNormalVertices();												break;
 	}
+
+	if (borders) drawBorders();
 }
 
 void keyboard(GLFWwindow* window, int key, int scancode, int action, int mods) {
@@ -338,6 +298,8 @@ void keyboard(GLFWwindow* window, int key, int scancode, int action, int mods) {
 		case GLFW_KEY_S: smooth = !smooth;	break;
 			//polygon fill on, off
 		case GLFW_KEY_F: polygonFill = !polygonFill; break;
+			//border and non-manifold edges on, off
+		case GLFW_KEY_B: borders = !borders; break;
 
 
 			// example selection
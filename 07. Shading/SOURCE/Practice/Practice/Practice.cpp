@@ -1,4 +1,8 @@
+#include <GL/glew.h>
 #include "glSetup.h"
+#include "mesh.h"
+#include "meshGL.h"
+#include "quadricCache.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -13,8 +17,13 @@ void	quit();
 void	render(GLFWwindow* window);
 void	keyboard(GLFWwindow* window, int key, int code, int action, int mods);
 
-bool	readMesh(const char* filename);
-void	deleteMesh();
+//mesh read from an OFF file and its vertex/index buffers
+Mesh	mesh;
+MeshGL	meshGL;
+
+//vertex-to-face adjacency for recomputing the vertex normals
+VertexFaces	adjacency;
+int		weighting = WEIGHT_UNIFORM;
 
 //camera configuation
 vec3	eye(3, 3, 3);
@@ -39,9 +48,6 @@ bool	smooth = true;
 //selected example
 int		selection = 1;
 
-//sphere, cylinder
-GLUquadricObj* sphere = NULL;
-
 // paly configuraion
 bool	pause = true;
 
@@ -68,6 +74,14 @@ int main(int argc, char* argv[]) {
 	GLFWwindow* window = initializeOpenGL(argc, argv, bgColor);
 	if (window == NULL) return -1;
 
+	//GLEW for the vertex and index buffers
+	GLenum	error = glewInit();
+	if (error != GLEW_OK)
+	{
+		cerr << "ERROR: " << glewGetErrorString(error) << endl;
+		return -1;
+	}
+
 	//callbacks
 	glfwSetKeyCallback(window, keyboard);
 
@@ -89,7 +103,7 @@ int main(int argc, char* argv[]) {
 	float	elapsed = 0;
 	while (!glfwWindowShouldClose(window))
 	{
-		glfwPollEvents();		//events
+		pollEvents(window);		//events
 
 		//time passed during a single loop
 		float	now = (float)glfwGetTime();
@@ -119,21 +133,17 @@ int main(int argc, char* argv[]) {
 	return 0;
 }
 void init() {
-	//prepare quadric shapes
-	sphere = gluNewQuadric();
-	gluQuadricDrawStyle(sphere, GLU_FILL);
-	gluQuadricNormals(sphere, GLU_SMOOTH);
-	gluQuadricOrientation(sphere, GLU_OUTSIDE);
-	gluQuadricTexture(sphere, GLU_FALSE);
-
 	//prepare mesh
-	readMesh("m01_bunny.off");
+	readMesh("m01_bunny.off", mesh);
+	createMeshGL(mesh, meshGL);
+	buildVertexFaces(mesh, adjacency);
 
 	//keyboard
 	cout << endl;
 	cout << "Keyboard Input : space for play/pause" << endl;
 	cout << "Keyboard Input : s for turn on/off smooth shading" << endl;
 	cout << "Keyboard Input : f for polygon fill on/off" << endl;
+	cout << "Keyboard Input : w for uniform/area/angle weighting of the vertex normals" << endl;
 	cout << endl;
 	cout << "Keyboard Input : 1 for sphere with	16 slices and 16 stacks" << endl;
 	cout << "Keyboard Input : 2 for sphere with	32 slices and 32 stacks" << endl;
@@ -141,14 +151,17 @@ void init() {
 	cout << "Keyboard Input : 4 for sphere with	128 slices and 128 stacks" << endl;
 	cout << "Keyboard Input : 5 for flat approximation of a bunny" << endl;
 	cout << "Keyboard Input : 6 for smooth approximation of a bunny" << endl;
+	cout << "Keyboard Input : 7 for sphere with slices and stacks from its size on screen" << endl;
 }
 
 void quit() {
-	//delete quadric shapes
-	gluDeleteQuadric(sphere);
+	//delete the tessellations of the quadric shapes
+	deleteQuadricCache();
 
 	//delete mesh
-	deleteMesh();
+	deleteVertexFaces(adjacency);
+	deleteMeshGL(meshGL);
+	deleteMesh(mesh);
 }
 
 // light
@@ -187,102 +200,30 @@ void drawSphere(float radius, int slices, int stacks, const vec3& color) {
 	//material
 	setDiffuseColor(color);
 
-	//sphere using glu quadrics
-	gluSphere(sphere, radius, slices, stacks);
+	//sphere using glu quadrics tessellated once per slices and stacks
+	drawQuadricSphere(radius, slices, stacks);
 }
 
-//read a mesh from a given OFF file
-int		nVertices = 0, nFaces = 0, nEdges = 0;
-glm::vec3* vertex = NULL;
-glm::vec3* vnormal = NULL; //vetex normal
-glm::vec3* fnormal = NULL; //face normal
-int* face[3] = { NULL, NULL, NULL };
-
-bool readMesh(const char* filename) {
-	ifstream	is(filename);
-	if (is.fail()) return false;
-
-	char	magicNumber[256];
-	is >> magicNumber;
-
-	// # vertices, # faces, # edges
-	is >> nVertices >> nFaces >> nEdges;
-	cout << "# vertices = " << nVertices << endl;
-	cout << "# faces = " << nFaces << endl;
-
-	//vertices
-	vertex = new vec3[nVertices];
-	for (int i = 0; i < nVertices; i++)
-		is >> vertex[i].x >> vertex[i].y >> vertex[i].z;
-
-	//vertex normals
-	vnormal = new glm::vec3[nVertices];
-	for (int i = 0; i < nVertices; i++)
-		vnormal[i] = glm::vec3(0, 0, 0);
-
-	//face normals
-	fnormal = new glm::vec3[nFaces];
-
-	//faces
-	face[0] = new int[nFaces]; //only support triangles
-	face[1] = new int[nFaces];
-	face[2] = new int[nFaces];
-
-	int n;
-	for (int i = 0; i < nFaces; i++) {
-		is >> n >> face[0][i] >> face[1][i] >> face[2][i];
-		if (n != 3) cout << "# vertices of the " << i << "-th faces = " << n << endl;
-
-		//normal vector of the face
-		glm::vec3	v1 = vertex[face[1][i]] - vertex[face[0][i]];
-		glm::vec3	v2 = vertex[face[2][i]] - vertex[face[0][i]];
-		glm::vec3	v = normalize(cross(v1, v2));
-
-		fnormal[i] = v;
-
-		//add it to the normal vector of each vertex
-		vnormal[face[0][i]] += v;
-		vnormal[face[1][i]] += v;
-		vnormal[face[2][i]] += v;
-	}
+//slices and stacks of the sphere from its projected radius, the tessellation deviating by at most half a pixel
+void drawSphereLOD(float radius, const vec3& color) {
+	static int	previous = 0;
 
-	//normalization of the normal vectors
-	for (int i = 0; i < nVertices; i++)
-		vnormal[i] = normalize(vnormal[i]);
-
-	return true;
-}
+	//material
+	setDiffuseColor(color);
 
-//delete the vertices and faces of the mesh
-void deleteMesh() {
-	if (vertex) { delete[] vertex; vertex = NULL; }
-	if (vnormal) { delete[] vnormal; vnormal = NULL; }
-	if (fnormal) { delete[] fnormal; fnormal = NULL; }
-	if (face[0]) { delete[] face[0]; face[0] = NULL; }
-	if (face[1]) { delete[] face[1]; face[1] = NULL; }
-	if (face[2]) { delete[] face[2]; face[2] = NULL; }
+	int		slices = drawQuadricSphereLOD(radius, SPHERE_PIXEL_ERROR);
+	if (slices != previous)
+		cout << "Sphere with " << slices << " slices and " << slices / 2 << " stacks" << endl;
+	previous = slices;
 }
 
 //draw a flat mesh by specifying its face normal vectors
 void drawFlatMesh() {
-	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < nFaces; i++) {
-		glNormal3fv(value_ptr(fnormal[i]));
-		for (int j = 0; j < 3; j++)
-			glVertex3fv(value_ptr(vertex[face[j][i]]));
-	}
-	glEnd();
+	drawFlatMeshGL(meshGL);
 }
 
 void drawSmoothMesh() {
-	//glShadeModel(GL_SMOOTH);//ӽ
-	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < nFaces; i++)
-	for (int j = 0; j < 3; j++) {
-			glNormal3fv(value_ptr(vnormal[face[j][i]]));
-			glVertex3fv(value_ptr(vertex[face[j][i]]));
-	}
-	glEnd();
+	drawSmoothMeshGL(meshGL);
 }
 
 void render(GLFWwindow* window) {
@@ -330,6 +271,7 @@ void render(GLFWwindow* window) {
 	case 4: drawSphere(1.0, 128, 128, vec3(0.95, 0.95, 0.95));		break;
 	case 5: drawFlatMesh();																	break;
 	case 6: drawSmoothMesh();																break;
+	case 7: drawSphereLOD(1.0, vec3(0.95, 0.95, 0.95));									break;
 	}
 }
 
@@ -348,6 +290,13 @@ void keyboard(GLFWwindow* window, int key, int scancode, int action, int mods) {
 		case GLFW_KEY_S: smooth = !smooth;	break;
 			//polygon fill on, off
 		case GLFW_KEY_F: polygonFill = !polygonFill; break;
+			//weighting of the face normals in the vertex normals
+		case GLFW_KEY_W:
+			weighting = (weighting + 1) % N_WEIGHTINGS;
+			computeNormals(mesh, adjacency, (NormalWeighting)weighting);
+			updateMeshGL(mesh, meshGL);
+			cout << normalWeightingName[weighting] << endl;
+			break;
 
 			// example selection
 		case GLFW_KEY_1: selection = 1; break;
@@ -356,6 +305,7 @@ void keyboard(GLFWwindow* window, int key, int scancode, int action, int mods) {
 		case GLFW_KEY_4: selection = 4; break;
 		case GLFW_KEY_5: selection = 5; break;
 		case GLFW_KEY_6: selection = 6; break;
+		case GLFW_KEY_7: selection = 7; break;
 		}
 	}
 }
@@ -1,4 +1,5 @@
 #include "glSetup.h"
+#include "quadricCache.h"
 
 #ifdef _WIN32
 #define _USE_MATH_DEFINES
@@ -112,7 +113,7 @@ int main(int argc, char* argv[]) {
 	float	previous = (float)glfwGetTime();
 	float	elapsed = 0;
 	while (!glfwWindowShouldClose(window)) {
-		glfwPollEvents();
+		pollEvents(window);
 
 		float	now = (float)glfwGetTime();
 		float	delta = now - previous;
@@ -138,18 +139,10 @@ int main(int argc, char* argv[]) {
 	return 0;
 }
 
-GLUquadricObj* sphere = NULL;
 void init() {
 	//animation system
 	reinitialize();
 
-	//prepare quadric shapes
-	sphere = gluNewQuadric();
-	gluQuadricDrawStyle(sphere, GLU_FILL);
-	gluQuadricNormals(sphere, GLU_SMOOTH);
-	gluQuadricOrientation(sphere, GLU_OUTSIDE);
-	gluQuadricTexture(sphere, GLU_FALSE);
-
 	//keyboard
 	cout << endl;
 	cout << "Keyboard Input : space for play/pause" << endl;
@@ -171,8 +164,8 @@ void init() {
 }
 
 void quit() {
-	//delete quadric shapes
-	gluDeleteQuadric(sphere);
+	//delete the tessellations of the quadric shapes
+	deleteQuadricCache();
 
 }
 
@@ -192,10 +185,10 @@ void setupWhiteShinyMaterial() {
 }
 
 
-//draw objects using a GLU quadric
+//draw objects using GLU quadrics tessellated once per shape
 void drawSphere(float radius, int slices, int stacks) {
 
-	gluSphere(sphere, radius, slices, stacks);
+	drawQuadricSphere(radius, slices, stacks);
 }
 
 
@@ -1,4 +1,9 @@
+#include <GL/glew.h>
 #include "glSetup.h"
+#include "mesh.h"
+#include "meshGL.h"
+#include "meshlet.h"
+#include "quadricCache.h"
 
 #ifdef _WIN32
 #define	_USE_MATH_DEFINES
@@ -10,6 +15,7 @@ using namespace glm;
 
 #include <iostream>
 #include <fstream>
+#include <vector>
 using namespace std;
 
 void	init();
@@ -17,8 +23,23 @@ void	quit();
 void	render(GLFWwindow* window);
 void	keyboard(GLFWwindow* window, int key, int code, int action, int mods);
 
-bool	readMesh(const char* filename);
-void	deleteMesh();
+//mesh read from an OFF file and its vertex/index buffers
+Mesh	mesh;
+MeshGL	meshGL;
+
+//meshlets of the mesh culled against the view frustum and by their normal cones
+Meshlets	meshlets;
+bool		meshletCulling = true;
+
+//gridSize x gridSize objects in the extent of the 3x3 ones, drawn in a single instanced call if supported
+int					gridSize = 3;
+bool				instanced = true;
+vector<InstanceGL>	grid;
+InstancesGL			gridGL;
+
+//sphere mesh of the instanced grid tessellated by the size of the spheres on screen
+MeshGL	sphereGL;
+int		sphereGLSlices = 0;
 
 //camera configuation
 vec3	eyeTopView(0, 10, 0); //top view
@@ -120,6 +141,9 @@ void animate()
 }
 
 int main(int argc, char* argv[]) {
+	//size of the object grid, e.g., 100 for 100x100 objects
+	if (argc > 1) gridSize = std::max(atoi(argv[1]), 1);
+
 	//vsync should be 0 for precise time stepping
 	vsync = 0;
 
@@ -129,6 +153,14 @@ int main(int argc, char* argv[]) {
 	GLFWwindow* window = initializeOpenGL(argc, argv, bgColor);
 	if (window == NULL) return -1;
 
+	//GLEW for the vertex and index buffers
+	GLenum	error = glewInit();
+	if (error != GLEW_OK)
+	{
+		cerr << "ERROR: " << glewGetErrorString(error) << endl;
+		return -1;
+	}
+
 	glfwSetKeyCallback(window, keyboard);
 
 	glEnable(GL_DEPTH_TEST);
@@ -142,7 +174,7 @@ int main(int argc, char* argv[]) {
 	float	previous = (float)glfwGetTime();
 	float	elapsed = 0;
 	while (!glfwWindowShouldClose(window)) {
-		glfwPollEvents();
+		pollEvents(window);
 
 		float	now = (float)glfwGetTime();
 		float	delta = now - previous;
@@ -168,33 +200,14 @@ int main(int argc, char* argv[]) {
 	return 0;
 }
 
-GLUquadricObj* sphere = NULL;
-GLUquadricObj* cylinder = NULL;
-GLUquadricObj* cone = NULL;
 void init() {
 	//animation system
 	reinitialize();
 
-	//prepare quadric shapes
-	sphere = gluNewQuadric();
-	gluQuadricDrawStyle(sphere, GLU_FILL);
-	gluQuadricNormals(sphere, GLU_SMOOTH);
-	gluQuadricOrientation(sphere, GLU_OUTSIDE);
-	gluQuadricTexture(sphere, GLU_FALSE);
-
-	cylinder = gluNewQuadric();
-	gluQuadricDrawStyle(cylinder, GLU_FILL);
-	gluQuadricNormals(cylinder, GLU_SMOOTH);
-	gluQuadricOrientation(cylinder, GLU_OUTSIDE);
-	gluQuadricTexture(cylinder, GLU_FALSE);
-
-	cone = gluNewQuadric();
-	gluQuadricDrawStyle(cone, GLU_FILL);
-	gluQuadricNormals(cone, GLU_SMOOTH);
-	gluQuadricOrientation(cone, GLU_OUTSIDE);
-	gluQuadricTexture(cone, GLU_FALSE);
-
-	readMesh("m01_bunny.off");
+	readMesh("m01_bunny.off", mesh);
+	buildMeshlets(mesh, meshlets);	//before the upload as it reorders the faces
+	createMeshGL(mesh, meshGL);
+	cout << "# meshlets = " << meshlets.nMeshlets << endl;
 
 	//keyboard
 	cout << endl;
@@ -213,21 +226,26 @@ void init() {
 	cout << "Keyboard Input : m for predefined material parameters" << endl;
 	cout << "Keyboard Input : l for rotation of lights" << endl;
 	cout << "Keyboard Input : o for rotation of objects" << endl;
-	cout << "Keyboard Input : 1 for 3x3 spheres" << endl;
-	cout << "Keyboard Input : 2 for 3x3 flat bunnies" << endl;
-	cout << "Keyboard Input : 3 for 3x3 smooth bunnies" << endl;
+	cout << "Keyboard Input : k for meshlet culling on/off" << endl;
+	cout << "Keyboard Input : n for instanced drawing on/off" << endl;
+	cout << "Keyboard Input : 1 for " << gridSize << "x" << gridSize << " spheres" << endl;
+	cout << "Keyboard Input : 2 for " << gridSize << "x" << gridSize << " flat bunnies" << endl;
+	cout << "Keyboard Input : 3 for " << gridSize << "x" << gridSize << " smooth bunnies" << endl;
 	cout << "Keyboard Input : 4 for a plane with many small squres" << endl;
 }
 
 void quit() {
-	//delete quadric shapes
-	//delete quadric shapes
-	gluDeleteQuadric(sphere);
-	gluDeleteQuadric(cylinder);
-	gluDeleteQuadric(cone);
+	//delete the tessellations of the quadric shapes
+	deleteQuadricCache();
+
+	//delete the instances
+	deleteInstancesGL(gridGL);
+	deleteMeshGL(sphereGL);
 
 	//delete mesh
-	deleteMesh();
+	deleteMeshGL(meshGL);
+	deleteMeshlets(meshlets);
+	deleteMesh(mesh);
 }
 
 //material
@@ -297,113 +315,86 @@ void drawSquare() {
 	glEnd();
 }
 
-//draw objects using a GLU quadric
+//draw objects using GLU quadrics tessellated once per shape
 void drawSphere(float radius, int slices, int stacks) {
 
-	gluSphere(sphere, radius, slices, stacks);
+	drawQuadricSphere(radius, slices, stacks);
 }
 
 void drawCylinder(float radius, float height, int slices, int stacks) {
 
-	gluCylinder(cylinder, radius, radius, height, slices, stacks);
+	drawQuadricCylinder(radius, radius, height, slices, stacks);
 }
 
 void drawCone(float radius, float height, int slices, int stacks) {
 
-	gluCylinder(cone, 0, radius, height, slices, stacks);
+	drawQuadricCylinder(0, radius, height, slices, stacks);
 }
 
-//read a mesh from a given OFF file
-int		nVertices = 0, nFaces = 0, nEdges = 0;
-glm::vec3* vertex = NULL;
-glm::vec3* vnormal = NULL; //vetex normal
-glm::vec3* fnormal = NULL; //face normal
-int* face[3] = { NULL, NULL, NULL };
-
-bool readMesh(const char* filename) {
-	ifstream	is(filename);
-	if (is.fail()) return false;
-
-	char	magicNumber[256];
-	is >> magicNumber;
-
-	// # vertices, # faces, # edges
-	is >> nVertices >> nFaces >> nEdges;
-	cout << "# vertices = " << nVertices << endl;
-	cout << "# faces = " << nFaces << endl;
-
-	//vertices
-	vertex = new vec3[nVertices];
-	for (int i = 0; i < nVertices; i++)
-		is >> vertex[i].x >> vertex[i].y >> vertex[i].z;
-
-	//vertex normals
-	vnormal = new glm::vec3[nVertices];
-	for (int i = 0; i < nVertices; i++)
-		vnormal[i] = glm::vec3(0, 0, 0);
-
-	//face normals
-	fnormal = new glm::vec3[nFaces];
-
-	//faces
-	face[0] = new int[nFaces]; //only support triangles
-	face[1] = new int[nFaces];
-	face[2] = new int[nFaces];
-
-	int n;
-	for (int i = 0; i < nFaces; i++) {
-		is >> n >> face[0][i] >> face[1][i] >> face[2][i];
-		if (n != 3) cout << "# vertices of the " << i << "-th faces = " << n << endl;
-
-		//normal vector of the face
-		glm::vec3	v1 = vertex[face[1][i]] - vertex[face[0][i]];
-		glm::vec3	v2 = vertex[face[2][i]] - vertex[face[0][i]];
-		glm::vec3	v = normalize(cross(v1, v2));
-
-		fnormal[i] = v;
-
-		//add it to the normal vector of each vertex
-		vnormal[face[0][i]] += v;
-		vnormal[face[1][i]] += v;
-		vnormal[face[2][i]] += v;
+//sphere mesh tessellated by its size on screen at the origin of the current modelview matrix
+const MeshGL& sphereMeshGL(float radius) {
+	int		slices = sphereSlices(radius, currentPixelsPerUnit());
+	if (slices != sphereGLSlices) {
+		Mesh	sphere;
+		createSphereMesh(sphere, radius, slices, slices / 2);
+		deleteMeshGL(sphereGL);
+		createMeshGL(sphere, sphereGL);
+		deleteMesh(sphere);
+
+		sphereGLSlices = slices;
 	}
+	return sphereGL;
+}
+
+//position of the object in the i-th row and j-th column of the grid
+vec3 gridPosition(int i, int j) {
+	float	c = (gridSize - 1) / 2.0f;
+	return vec3((j - c) * 4.0f, (c - i) * 2.0f, 0);
+}
+
+//the whole grid in a single call, the meshlets not culled per object
+void drawGridInstanced(const vec3& axis) {
+	mat4	R = rotate(mat4(1.0), radians(thetaModel), axis);
 
-	//normalization of the normal vectors
-	for (int i = 0; i < nVertices; i++)
-		vnormal[i] = normalize(vnormal[i]);
+	grid.resize(gridSize * gridSize);
+	for (int i = 0; i < gridSize; i++)
+		for (int j = 0; j < gridSize; j++) {
+			InstanceGL&	instance = grid[i * gridSize + j];
+			instance.model = translate(mat4(1.0), gridPosition(i, j)) * R;
+			instance.material = 0;
+		}
+	uploadInstancesGL(grid.data(), (int)grid.size(), gridGL);
 
-	return true;
+	//the material set up for the objects
+	switch (selection) {
+	case 1: drawSmoothMeshGL(sphereMeshGL(0.7f), gridGL);	break;
+	case 2: drawFlatMeshGL(meshGL, gridGL);					break;
+	case 3: drawSmoothMeshGL(meshGL, gridGL);				break;
+	}
 }
 
-void deleteMesh() {
-	if (vertex) { delete[] vertex; vertex = NULL; }
-	if (vnormal) { delete[] vnormal; vnormal = NULL; }
-	if (fnormal) { delete[] fnormal; fnormal = NULL; }
-	if (face[0]) { delete[] face[0]; face[0] = NULL; }
-	if (face[1]) { delete[] face[1]; face[1] = NULL; }
-	if (face[2]) { delete[] face[2]; face[2] = NULL; }
+//cull the meshlets with the current modelview and projection matrices
+void updateMeshlets() {
+	GLfloat	modelView[16], projection[16];
+	glGetFloatv(GL_MODELVIEW_MATRIX, modelView);
+	glGetFloatv(GL_PROJECTION_MATRIX, projection);
+
+	cullMeshlets(meshlets, make_mat4(modelView), make_mat4(projection));
 }
 
 //draw a flat mesh by specifying its face normal vectors
 void drawFlatMesh() {
-	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < nFaces; i++) {
-		glNormal3fv(value_ptr(fnormal[i]));
-		for (int j = 0; j < 3; j++)
-			glVertex3fv(value_ptr(vertex[face[j][i]]));
-	}
-	glEnd();
+	if (!meshletCulling) { drawFlatMeshGL(meshGL); return; }
+
+	updateMeshlets();
+	drawFlatMeshGL(meshGL, meshlets);
 }
 
 void drawSmoothMesh() {
-	//glShadeModel(GL_SMOOTH);//ӽ
-	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < nFaces; i++)
-		for (int j = 0; j < 3; j++) {
-			glNormal3fv(value_ptr(vnormal[face[j][i]]));
-			glVertex3fv(value_ptr(vertex[face[j][i]]));
-		}
-	glEnd();
+	if (!meshletCulling) { drawSmoothMeshGL(meshGL); return; }
+
+	updateMeshlets();
+	drawSmoothMeshGL(meshGL, meshlets);
 }
 
 
@@ -625,32 +616,28 @@ void render(GLFWwindow* window) {
 			}
 	}
 	else {
-		glScalef(0.4f, 0.4f, 0.4f);
-
-		vec3	u[3];
-		vec3	v[3];
-		u[0] = vec3(0, 1, 0) * 2.0f;	u[1] = vec3(0, 0, 0);	u[2] = -u[0];
-		v[0] = -vec3(1, 0, 0) * 4.0f;	v[1] = vec3(0, 0, 0);	v[2] = -v[0];
-
-		for (int i = 0; i < 3; i++) {
-			glPushMatrix();
-			glTranslatef(u[i].x, u[i].y, u[i].z);
-
-			for (int j = 0; j < 3; j++) {
-				glPushMatrix();
-
-				glTranslatef(v[j].x, v[j].y, v[j].z);
-				glRotatef(thetaModel, axis.x, axis.y, axis.z);
-
-				switch (selection) {
-				case 1: drawSphere(0.7f, 64, 64);	break;
-				case 2: drawFlatMesh();				break;
-				case 3: drawSmoothMesh();			break;
+		//scaled to the extent of the 3x3 grid
+		float	s = 1.2f / gridSize;
+		glScalef(s, s, s);
+
+		if (instanced && instancingSupported()) drawGridInstanced(axis);
+		else {
+			for (int i = 0; i < gridSize; i++)
+				for (int j = 0; j < gridSize; j++) {
+					glPushMatrix();
+
+					vec3	p = gridPosition(i, j);
+					glTranslatef(p.x, p.y, p.z);
+					glRotatef(thetaModel, axis.x, axis.y, axis.z);
+
+					switch (selection) {
+					case 1: drawQuadricSphereLOD(0.7f);	break;
+					case 2: drawFlatMesh();				break;
+					case 3: drawSmoothMesh();			break;
+					}
+
+					glPopMatrix();
 				}
-
-				glPopMatrix();
-			}
-			glPopMatrix();
 		}
 	}
 }
@@ -683,6 +670,15 @@ void keyboard(GLFWwindow* window, int key, int scancode, int action, int mods) {
 		case GLFW_KEY_E: exponent = !exponent;				break;
 		case GLFW_KEY_C: cutoff = !cutoff;					break;
 		case GLFW_KEY_M: material = (material+1)%3;			break;
+		case GLFW_KEY_K:
+			meshletCulling = !meshletCulling;
+			cout << "Meshlet culling " << (meshletCulling ? "on" : "off") << endl;
+			break;
+		case GLFW_KEY_N:
+			instanced = !instanced;
+			if (instanced && !instancingSupported()) cout << "Instanced drawing is not supported" << endl;
+			else cout << "Instanced drawing " << (instanced ? "on" : "off") << endl;
+			break;
 
 			// example selection
 		case GLFW_KEY_1: selection = 1; break;
@@ -1,4 +1,10 @@
+#include <GL/glew.h>
 #include "glSetup.h"
+#include "mesh.h"
+#include "meshGL.h"
+#include "meshSimplify.h"
+#include "meshCompact.h"
+#include "quadricCache.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -6,6 +12,7 @@ using namespace glm;
 
 #include <iostream>
 #include <fstream>
+#include <algorithm>
 using namespace std;
 
 void	init();
@@ -13,8 +20,17 @@ void	quit();
 void	render(GLFWwindow* window);
 void	keyboard(GLFWwindow* window, int key, int code, int action, int mods);
 
-bool	readMesh(const char* filename);
-void	deleteMesh();
+//mesh read from an OFF file, its levels of detail and their vertex/index buffers
+Mesh	mesh;
+MeshLOD	lod;
+MeshGL	lodGL[MAX_LOD_LEVELS];
+MeshGL	compactGL[MAX_LOD_LEVELS];	//quantized copies decoded by a vertex shader
+
+bool	compactEnabled = false;
+
+//level of detail whose deviation covers at most maxPixelError pixels
+bool	lodEnabled = true;
+float	maxPixelError = 1.0f;
 
 // camera configuation
 struct Camera
@@ -61,6 +77,14 @@ int main(int argc, char* argv[]) {
 	GLFWwindow* window = initializeOpenGL(argc, argv, bgColor);
 	if (window == NULL) return -1;
 
+	//GLEW for the vertex and index buffers
+	GLenum	error = glewInit();
+	if (error != GLEW_OK)
+	{
+		cerr << "ERROR: " << glewGetErrorString(error) << endl;
+		return -1;
+	}
+
 	glfwSetKeyCallback(window, keyboard);
 
 	glEnable(GL_DEPTH_TEST);
@@ -73,7 +97,7 @@ int main(int argc, char* argv[]) {
 
 	while (!glfwWindowShouldClose(window))
 	{
-		glfwPollEvents();
+		pollEvents(window);
 		render(window);				//draw one frame
 		glfwSwapBuffers(window);	// swap buffers
 	}
@@ -87,29 +111,32 @@ int main(int argc, char* argv[]) {
 }
 
 
-// sphere, cylinder
-GLUquadricObj* sphere = NULL;
-
 void init() {
 	//forward and backwoard direction for navigation
 	C.f = normalize(C.a - C.e);				// forward direction
 	C.r = normalize(cross(C.f, C.u));		// right direction
 	C.u = normalize(cross(C.r, C.f));		// up vector (orthogonal to f and r)
 
-	//prepare quadric shapes
-	sphere = gluNewQuadric();
-	gluQuadricDrawStyle(sphere, GLU_FILL);
-	gluQuadricNormals(sphere, GLU_SMOOTH);
-	gluQuadricOrientation(sphere, GLU_OUTSIDE);
-	gluQuadricTexture(sphere, GLU_FALSE);
+	readMesh("m01_bunny.off", mesh);
+	buildMeshLOD(mesh, lod);
+	for (int l = 0; l < lod.nLevels; l++)
+	{
+		createMeshGL(*lod.level[l], lodGL[l]);
 
-	readMesh("m01_bunny.off");
+		//the quantized copy is needed only for the upload
+		CompactMesh	compact;
+		createCompactMesh(*lod.level[l], compact);
+		createMeshGL(compact, compactGL[l]);
+		deleteCompactMesh(compact);
+	}
 
 	//keyboard
 	cout << endl;
 	cout << "Keyboard Input : up, down, left, right for viewing" << endl;
 	cout << "Keyboard Input : p for perspective/orthographic viewing" << endl;
 	cout << "Keyboard Input : f to change field of view angle" << endl;
+	cout << "Keyboard Input : l for level of detail on/off" << endl;
+	cout << "Keyboard Input : c for compact vertices on/off" << endl;
 	cout << endl;
 
 	cout << "Keyboard Input : up, down, left, right with modifier key(shift) for turning, moving" << endl;
@@ -121,11 +148,17 @@ void init() {
 }
 
 void quit() {
-	//delete quadric shapes
-	gluDeleteQuadric(sphere);
+	//delete the tessellations of the quadric shapes
+	deleteQuadricCache();
 
 	//delete mesh
-	deleteMesh();
+	for (int l = 0; l < lod.nLevels; l++)
+	{
+		deleteMeshGL(lodGL[l]);
+		deleteMeshGL(compactGL[l]);
+	}
+	deleteMeshLOD(lod);
+	deleteMesh(mesh);
 }
 
 //material
@@ -142,103 +175,37 @@ void setupColoredMaterial(const vec3& color) {
 	glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, mat_shininess);
 }
 
-// draw objects using a GLU quadric
+// draw objects using GLU quadrics tessellated once per shape
 void drawSphere(float radius, int slices, int stacks) {
 
-	gluSphere(sphere, radius, slices, stacks);
+	drawQuadricSphere(radius, slices, stacks);
 }
 
-//read a mesh from a given OFF file
-int		nVertices = 0, nFaces = 0, nEdges = 0;
-glm::vec3* vertex = NULL;
-glm::vec3* vnormal = NULL; //vetex normal
-glm::vec3* fnormal = NULL; //face normal
-int* face[3] = { NULL, NULL, NULL };
-
-bool readMesh(const char* filename) {
-	ifstream	is(filename);
-	if (is.fail()) return false;
-
-	char	magicNumber[256];
-	is >> magicNumber;
-
-	// # vertices, # faces, # edges
-	is >> nVertices >> nFaces >> nEdges;
-	cout << "# vertices = " << nVertices << endl;
-	cout << "# faces = " << nFaces << endl;
-
-	//vertices
-	vertex = new vec3[nVertices];
-	for (int i = 0; i < nVertices; i++)
-		is >> vertex[i].x >> vertex[i].y >> vertex[i].z;
-
-	//vertex normals
-	vnormal = new glm::vec3[nVertices];
-	for (int i = 0; i < nVertices; i++)
-		vnormal[i] = glm::vec3(0, 0, 0);
-
-	//face normals
-	fnormal = new glm::vec3[nFaces];
-
-	//faces
-	face[0] = new int[nFaces]; //only support triangles
-	face[1] = new int[nFaces];
-	face[2] = new int[nFaces];
-
-	int n;
-	for (int i = 0; i < nFaces; i++) {
-		is >> n >> face[0][i] >> face[1][i] >> face[2][i];
-		if (n != 3) cout << "# vertices of the " << i << "-th faces = " << n << endl;
-
-		//normal vector of the face
-		glm::vec3	v1 = vertex[face[1][i]] - vertex[face[0][i]];
-		glm::vec3	v2 = vertex[face[2][i]] - vertex[face[0][i]];
-		glm::vec3	v = normalize(cross(v1, v2));
-
-		fnormal[i] = v;
-
-		//add it to the normal vector of each vertex
-		vnormal[face[0][i]] += v;
-		vnormal[face[1][i]] += v;
-		vnormal[face[2][i]] += v;
-	}
+//level of detail for the bunny drawn with the given scale
+int selectLevel(float scale) {
+	if (!lodEnabled) return 0;
 
-	//normalization of the normal vectors
-	for (int i = 0; i < nVertices; i++)
-		vnormal[i] = normalize(vnormal[i]);
+	//nearest point of the bounding sphere from the eye
+	float	distance = length(C.e - scale * lod.center) - scale * lod.radius;
+	float	ppu = perspectiveView ? pixelsPerUnit(std::max(distance, 0.1f), fovy, windowH) : windowH / 2.0f;
 
-	return true;
-}
+	int		previous = lod.current;
+	int		l = selectLOD(lod, scale * ppu, maxPixelError);
+	if (l != previous)
+		cout << "Level of detail " << l << " with " << lod.level[l]->nFaces << " faces" << endl;
 
-void deleteMesh() {
-	if (vertex) { delete[] vertex; vertex = NULL; }
-	if (vnormal) { delete[] vnormal; vnormal = NULL; }
-	if (fnormal) { delete[] fnormal; fnormal = NULL; }
-	if (face[0]) { delete[] face[0]; face[0] = NULL; }
-	if (face[1]) { delete[] face[1]; face[1] = NULL; }
-	if (face[2]) { delete[] face[2]; face[2] = NULL; }
+	return l;
 }
 
 //draw a flat mesh by specifying its face normal vectors
 void drawFlatMesh() {
-	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < nFaces; i++) {
-		glNormal3fv(value_ptr(fnormal[i]));
-		for (int j = 0; j < 3; j++)
-			glVertex3fv(value_ptr(vertex[face[j][i]]));
-	}
-	glEnd();
+	int		l = selectLevel(0.7f);
+	drawFlatMeshGL(compactEnabled && compactGL[l].vertexBuffer ? compactGL[l] : lodGL[l]);
 }
 
 void drawSmoothMesh() {
-	//glShadeModel(GL_SMOOTH);//ӽ
-	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < nFaces; i++)
-		for (int j = 0; j < 3; j++) {
-			glNormal3fv(value_ptr(vnormal[face[j][i]]));
-			glVertex3fv(value_ptr(vertex[face[j][i]]));
-		}
-	glEnd();
+	int		l = selectLevel(0.7f);
+	drawSmoothMeshGL(compactEnabled && compactGL[l].vertexBuffer ? compactGL[l] : lodGL[l]);
 }
 
 // light
@@ -383,6 +350,18 @@ void keyboard(GLFWwindow* window, int key, int scancode, int action, int mods) {
 		case GLFW_KEY_1: selection = 1; break;
 		case GLFW_KEY_2: selection = 2; break;
 		case GLFW_KEY_3: selection = 3; break;
+
+			//level of detail on/off
+		case GLFW_KEY_L:
+			lodEnabled = !lodEnabled;
+			cout << "Level of detail " << (lodEnabled ? "on" : "off") << endl;
+			break;
+
+			//compact vertices on/off
+		case GLFW_KEY_C:
+			compactEnabled = !compactEnabled;
+			cout << "Compact vertices " << (compactEnabled ? "on" : "off") << endl;
+			break;
 		}
 	}
 
@@ -4,7 +4,9 @@
 
 #ifndef __GL_SETUP_H_
 #define __GL_SETUP_H_
+#ifdef _WIN32
 #include <Windows.h> 
+#endif
 #include <GL/glu.h> 
 #include <GLFW/glfw3.h>
 
@@ -16,6 +18,14 @@ extern float	dpiScaling;
 
 extern int		vsync;
 
+//offscreen rendering without a window or a display for unattended runs (GLFW 3.4 or later),
+//chosen before initializeOpenGL() or by GL_HEADLESS=egl
+enum HeadlessBackend { HEADLESS_NONE = 0, HEADLESS_EGL };
+
+extern int		headless;
+extern int		headlessW, headlessH;	//framebuffer size, GL_HEADLESS_SIZE=WxH
+extern float	headlessSeconds;		//closing the window after, GL_HEADLESS_SECONDS, 0 for never
+
 extern bool		perspectiveView;
 extern float	fovy;
 extern float	nearDits;
@@ -23,6 +33,7 @@ extern float	farDist;
 
 GLFWwindow* initializeOpenGL(int argc, char* argv[], GLfloat bg[4]);
 void		reshape(GLFWwindow* window, int w, int n);
+void		pollEvents(GLFWwindow* window);	//glfwPollEvents() closing the window after headlessSeconds
 void		setupProjectionMatrix();
 
 void		drawAxes(float l, float w);
@@ -450,7 +450,7 @@ int main(int argc, char* argv[])
 	float elapsed = 0;
 	while (!glfwWindowShouldClose(window))
 	{
-		glfwPollEvents();
+		pollEvents(window);
 
 		float now = (float)glfwGetTime();
 		float delta = now - previous;
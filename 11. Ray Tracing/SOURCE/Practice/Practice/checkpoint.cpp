@@ -0,0 +1,115 @@
+#include "checkpoint.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <iostream>
+using namespace std;
+
+//file layout: magic, version, header, accumulation buffer
+static const char	MAGIC[4] = { 'R', 'T', 'C', 'K' };
+static const int	VERSION = 1;
+
+unsigned long long hashBytes(unsigned long long h, const void* data, size_t size)
+{
+	const unsigned char* p = (const unsigned char*)data;
+	for (size_t i = 0; i < size; i++)
+	{
+		h ^= p[i];
+		h *= 1099511628211ULL;
+	}
+	return h;
+}
+
+bool writeCheckpoint(const char* filename, const CheckpointHeader& header, const float* accum)
+{
+	//written to a temporary file and renamed not to leave a broken checkpoint on a crash
+	string	temp = string(filename) + ".tmp";
+
+	FILE*	fp = fopen(temp.c_str(), "wb");
+	if (fp == NULL)
+	{
+		cerr << "Can't write " << temp << endl;
+		return false;
+	}
+
+	size_t	nFloats = (size_t)3 * header.m * header.n;
+	bool	success = fwrite(MAGIC, sizeof(MAGIC), 1, fp) == 1
+		&& fwrite(&VERSION, sizeof(VERSION), 1, fp) == 1
+		&& fwrite(&header, sizeof(header), 1, fp) == 1
+		&& fwrite(accum, sizeof(float), nFloats, fp) == nFloats;
+	success = (fclose(fp) == 0) && success;
+
+	if (success)
+	{
+		remove(filename);
+		success = rename(temp.c_str(), filename) == 0;
+	}
+	if (!success) cerr << "Failed in writing " << filename << endl;
+
+	return success;
+}
+
+bool readCheckpoint(const char* filename, CheckpointHeader& header, float*& accum)
+{
+	FILE*	fp = fopen(filename, "rb");
+	if (fp == NULL)
+	{
+		cerr << "Can't open " << filename << endl;
+		return false;
+	}
+
+	char	magic[4];
+	int		version = 0;
+	bool	success = fread(magic, sizeof(magic), 1, fp) == 1 && memcmp(magic, MAGIC, sizeof(MAGIC)) == 0
+		&& fread(&version, sizeof(version), 1, fp) == 1 && version == VERSION
+		&& fread(&header, sizeof(header), 1, fp) == 1
+		&& header.m > 0 && header.n > 0;
+
+	accum = NULL;
+	if (success)
+	{
+		size_t	nFloats = (size_t)3 * header.m * header.n;
+		accum = new float[nFloats];
+		success = fread(accum, sizeof(float), nFloats, fp) == nFloats;
+		if (!success) { delete[] accum; accum = NULL; }
+	}
+	fclose(fp);
+
+	if (!success) cerr << "Invalid checkpoint " << filename << endl;
+
+	return success;
+}
+
+//at most one write in flight
+static thread	writer;
+static atomic<bool>	writing(false);
+
+bool writeCheckpointAsync(const char* filename, const CheckpointHeader& header, const float* accum)
+{
+	if (writing) return false;
+	if (writer.joinable()) writer.join();
+
+	//snapshot of the buffer so that the tracer can keep accumulating
+	size_t	nFloats = (size_t)3 * header.m * header.n;
+	float*	copy = new float[nFloats];
+	memcpy(copy, accum, sizeof(float) * nFloats);
+
+	string	name = filename;
+
+	writing = true;
+	writer = thread([=]() {
+		writeCheckpoint(name.c_str(), header, copy);
+		delete[] copy;
+		writing = false;
+	});
+
+	return true;
+}
+
+void waitForCheckpoint()
+{
+	if (writer.joinable()) writer.join();
+}
@@ -0,0 +1,35 @@
+#ifndef __CHECKPOINT_H_
+#define __CHECKPOINT_H_
+
+#include <stddef.h>
+
+//state of a progressive render to continue exactly where it left off
+struct CheckpointHeader
+{
+	unsigned long long	sceneHash;	//hash of everything that affects the image
+
+	int		m, n;			//image size
+	int		nSamples;		//samples accumulated in every pixel
+	unsigned int	seed;	//seed of the counter-based random numbers
+
+	//interactive parameters restored on resume
+	float	currTime;
+	int		depth;
+	float	specular[3];
+	int		textureMode;
+};
+
+//FNV-1a hash of size bytes continuing from h
+unsigned long long hashBytes(unsigned long long h, const void* data, size_t size);
+const unsigned long long HASH_SEED = 14695981039346656037ULL;
+
+//accumulation buffer: 3 floats per pixel
+bool writeCheckpoint(const char* filename, const CheckpointHeader& header, const float* accum);
+bool readCheckpoint(const char* filename, CheckpointHeader& header, float*& accum);
+
+//write a copy of the accumulation buffer in a background thread
+//returns false without writing if the previous write is still in progress
+bool writeCheckpointAsync(const char* filename, const CheckpointHeader& header, const float* accum);
+void waitForCheckpoint();
+
+#endif
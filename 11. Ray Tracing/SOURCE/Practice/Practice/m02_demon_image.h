@@ -0,0 +1,2493 @@
+/* 128x128 RGB8 image for a demon head */
+26,15,5, 98,54,20, 130,68,21, 135,71,21, 136,72,22, 136,72,22,
+136,71,22, 136,71,22, 136,71,22, 136,71,22, 135,71,22, 135,71,22,
+135,71,22, 135,71,22, 134,71,22, 134,69,22, 134,70,22, 134,70,22,
+134,70,21, 133,69,21, 133,70,22, 130,68,21, 51,29,13, 14,13,14, 16,14,12,
+17,11,7, 29,18,8, 44,28,14, 46,29,16, 35,21,7, 24,15,4, 21,17,6, 15,12,7,
+21,20,15, 17,15,6, 15,13,7, 28,24,14, 50,46,31, 83,78,50, 124,116,87,
+133,125,94, 149,143,105, 166,160,122, 167,159,116, 175,165,118,
+154,146,106, 127,117,81, 152,137,95, 153,138,99, 142,134,108,
+139,130,103, 150,134,95, 158,134,91, 204,176,128, 204,181,131,
+239,211,162, 243,221,165, 238,206,152, 248,216,159, 251,221,160,
+250,224,162, 254,241,179, 250,225,159, 254,239,173, 255,254,193,
+254,253,193, 253,250,186, 253,252,189, 253,252,194, 253,248,184,
+252,241,182, 252,229,169, 253,240,179, 253,250,189, 253,246,183,
+250,233,174, 245,218,157, 177,150,103, 121,110,87, 174,162,132,
+207,176,119, 194,170,121, 176,161,131, 184,165,132, 210,185,143,
+231,203,151, 222,194,141, 159,138,99, 128,122,111, 165,163,158,
+220,212,170, 240,238,194, 238,237,198, 217,211,169, 166,155,122,
+117,111,93, 119,119,94, 103,102,60, 122,118,79, 100,96,63, 96,95,76,
+95,93,68, 99,96,72, 106,104,77, 109,106,81, 105,101,82, 90,88,88,
+76,78,88, 71,74,86, 71,75,84, 62,68,72, 61,68,73, 65,71,74, 68,73,77,
+72,78,80, 73,82,83, 76,83,86, 74,79,84, 82,86,90, 85,90,92, 87,93,94,
+99,104,105, 111,116,118, 92,80,78, 56,29,21, 42,15,5, 44,16,7, 49,25,19,
+31,17,5, 110,59,20, 132,69,21, 134,71,21, 134,71,21, 134,70,21,
+135,71,22, 134,70,22, 135,70,22, 135,70,22, 134,70,22, 134,70,21,
+133,69,21, 134,69,21, 134,69,21, 134,70,21, 133,69,21, 133,69,21,
+134,70,21, 133,69,21, 131,68,22, 101,53,17, 18,16,13, 19,14,11, 31,21,14,
+33,20,8, 50,30,12, 53,33,16, 47,30,18, 26,16,4, 25,17,6, 22,19,10, 7,4,0,
+17,16,10, 12,10,1, 19,15,5, 55,47,28, 73,64,40, 105,95,67, 136,123,93,
+134,122,89, 150,142,106, 165,161,125, 167,161,126, 165,155,116,
+160,150,111, 176,161,116, 188,168,118, 116,110,84, 133,120,89,
+177,154,108, 198,172,121, 161,136,93, 180,159,114, 200,177,126,
+247,223,166, 249,228,168, 239,207,150, 243,209,149, 253,227,165,
+254,235,171, 254,237,178, 254,245,182, 254,245,180, 254,253,189,
+254,253,197, 253,252,192, 254,252,193, 253,253,193, 254,250,189,
+253,250,187, 253,249,185, 253,246,177, 253,251,187, 251,245,178,
+244,219,158, 161,134,95, 130,118,95, 169,149,112, 178,155,120,
+186,164,132, 204,176,137, 226,197,150, 239,204,149, 237,206,152,
+244,223,166, 245,235,177, 235,225,170, 170,162,134, 157,153,144,
+223,216,187, 244,243,223, 244,243,223, 239,238,211, 225,215,169,
+171,159,125, 126,122,95, 121,118,81, 128,122,77, 109,105,65, 110,108,77,
+101,98,69, 106,103,74, 116,113,84, 117,114,83, 105,100,77, 88,83,86,
+81,80,95, 78,79,90, 70,75,81, 64,69,71, 65,71,70, 71,76,72, 77,81,74,
+78,82,76, 77,85,79, 80,88,84, 80,84,86, 83,85,88, 82,86,88, 86,89,91,
+90,94,94, 113,119,122, 110,107,106, 71,47,41, 45,17,8, 42,14,4, 46,20,12,
+46,26,10, 119,63,21, 133,69,21, 134,70,22, 134,70,22, 133,70,21,
+134,70,21, 133,70,21, 133,69,21, 133,69,21, 133,68,21, 134,69,21,
+133,69,21, 133,69,21, 133,69,21, 133,69,21, 133,69,21, 133,69,21,
+132,68,21, 131,68,21, 126,65,21, 45,29,16, 30,24,19, 37,22,11, 45,25,13,
+41,22,7, 45,29,15, 37,21,9, 32,20,11, 22,14,8, 23,17,10, 14,9,2, 5,4,0,
+17,15,6, 21,15,5, 32,24,11, 61,50,31, 82,67,43, 106,89,64, 143,117,98,
+146,129,101, 152,140,106, 165,156,122, 170,161,122, 171,163,120,
+189,178,134, 211,195,148, 156,144,106, 106,100,74, 136,119,86,
+181,155,111, 172,150,102, 152,130,84, 171,147,101, 218,184,134,
+251,221,165, 253,243,181, 242,209,150, 248,210,149, 252,222,160,
+255,238,175, 254,244,185, 254,243,178, 255,246,177, 254,252,178,
+254,253,187, 254,250,174, 253,253,187, 253,253,197, 253,250,189,
+253,251,184, 253,252,192, 251,251,198, 252,250,188, 232,213,153,
+141,121,86, 158,146,124, 175,155,124, 190,167,134, 209,176,136,
+226,190,141, 246,220,168, 247,225,174, 245,218,165, 246,225,170,
+249,234,172, 249,242,179, 243,239,186, 192,186,161, 154,148,136,
+216,205,186, 244,243,228, 244,244,230, 245,245,226, 240,238,208,
+221,209,168, 159,149,115, 126,122,92, 127,120,73, 112,108,66, 116,114,77,
+110,106,71, 114,110,76, 119,115,82, 111,108,77, 97,95,73, 86,84,82,
+78,77,90, 75,77,87, 69,74,75, 72,76,77, 70,74,73, 82,84,70, 90,90,72,
+89,89,73, 85,88,74, 81,86,78, 82,86,84, 84,89,85, 85,89,87, 79,80,82,
+82,82,84, 110,114,119, 112,114,115, 81,61,56, 48,20,10, 44,16,5, 45,18,8,
+67,39,17, 124,65,20, 133,69,21, 133,70,22, 133,70,22, 132,70,22,
+132,70,22, 133,70,21, 133,69,21, 133,69,21, 133,68,21, 133,68,20,
+133,69,21, 133,69,21, 133,68,21, 133,68,21, 133,68,21, 132,68,20,
+132,68,21, 130,67,21, 83,43,16, 21,17,12, 27,19,13, 26,15,8, 25,14,7,
+22,14,8, 33,17,6, 29,14,4, 18,9,3, 25,20,16, 16,10,3, 7,5,0, 10,8,1,
+18,15,5, 20,13,3, 62,47,24, 127,102,62, 135,111,69, 164,134,90,
+161,135,106, 171,147,114, 205,177,129, 186,166,119, 181,170,124,
+180,174,131, 210,202,159, 195,181,132, 134,122,92, 129,123,102,
+144,133,109, 176,156,119, 165,139,97, 175,146,103, 163,141,102,
+202,174,124, 249,221,161, 254,231,167, 253,221,157, 253,228,160,
+254,234,167, 254,227,164, 254,236,176, 255,250,192, 255,254,192,
+254,253,210, 254,254,211, 254,251,180, 254,254,215, 254,253,233,
+253,253,223, 253,253,212, 252,251,193, 238,226,165, 200,186,142,
+146,133,104, 179,167,141, 208,186,153, 235,209,161, 246,223,174,
+240,220,170, 244,221,171, 246,224,176, 249,228,178, 249,238,199,
+250,247,212, 250,247,208, 248,246,197, 232,222,183, 157,153,135,
+166,162,159, 209,197,174, 246,244,211, 245,245,227, 245,246,231,
+243,242,213, 236,232,187, 198,184,143, 126,118,96, 123,118,75,
+120,114,74, 119,116,84, 116,111,82, 114,109,80, 111,107,79, 108,106,78,
+103,102,77, 92,90,80, 82,80,85, 78,78,83, 67,70,68, 68,72,68, 75,77,71,
+87,87,74, 94,91,71, 92,88,69, 88,87,71, 79,81,75, 82,86,78, 86,91,82,
+86,89,84, 82,81,82, 81,80,83, 111,117,125, 115,119,123, 86,70,69,
+51,25,16, 45,16,5, 46,16,5, 82,45,17, 126,66,20, 133,69,21, 133,69,22,
+132,69,21, 132,69,22, 132,69,21, 132,69,21, 132,69,20, 132,69,21,
+132,69,21, 132,68,20, 132,68,21, 133,68,21, 133,68,20, 133,68,21,
+132,67,20, 132,68,20, 130,66,20, 119,61,19, 27,18,12, 12,10,8, 9,6,4,
+12,9,7, 15,11,8, 17,9,4, 35,19,7, 27,13,6, 20,12,8, 16,9,5, 10,8,4,
+4,2,0, 11,8,1, 16,12,4, 43,31,13, 114,91,53, 147,120,74, 168,135,88,
+184,147,106, 200,163,126, 217,183,131, 196,169,118, 200,180,127,
+200,180,128, 202,182,132, 199,178,131, 149,128,92, 159,132,95,
+176,151,112, 173,149,106, 161,145,112, 147,130,94, 148,127,88,
+166,146,106, 217,187,128, 241,208,147, 248,214,154, 250,217,160,
+251,230,173, 250,231,180, 253,239,190, 254,238,182, 255,254,209,
+254,254,222, 254,254,238, 254,254,249, 254,254,226, 254,253,226,
+248,245,217, 243,240,224, 238,231,208, 207,195,161, 187,175,153,
+197,182,154, 221,192,147, 238,212,161, 250,237,180, 252,246,189,
+251,247,195, 252,250,197, 251,249,206, 251,248,220, 251,250,234,
+251,249,232, 250,249,226, 250,249,221, 246,243,202, 201,189,157,
+155,152,149, 175,171,174, 222,209,186, 244,242,204, 245,245,212,
+247,247,226, 247,246,222, 239,237,195, 222,210,165, 144,132,104,
+122,117,83, 120,114,94, 110,104,103, 106,100,97, 101,95,90, 99,94,83,
+104,101,85, 106,104,83, 94,92,80, 85,83,81, 85,85,80, 74,76,65, 71,74,66,
+78,79,67, 88,85,66, 90,85,70, 87,83,71, 88,83,69, 81,80,74, 85,88,76,
+92,99,84, 88,91,84, 81,78,79, 83,81,83, 108,113,123, 118,124,130,
+97,83,81, 55,30,22, 47,23,16, 46,17,7, 97,52,17, 128,66,20, 133,68,20,
+133,68,20, 133,68,20, 133,68,21, 132,68,21, 132,69,20, 132,68,20,
+131,68,20, 132,68,20, 132,68,20, 132,68,20, 131,68,20, 132,68,21,
+131,67,20, 132,67,21, 131,68,21, 130,66,21, 67,35,12, 14,11,9, 10,9,7,
+6,5,4, 14,12,11, 13,8,3, 18,7,0, 32,14,3, 25,13,6, 12,5,1, 8,4,0, 10,9,6,
+4,4,0, 13,10,2, 21,16,6, 104,81,46, 140,117,73, 170,140,94, 164,133,89,
+199,162,120, 185,147,113, 211,183,134, 225,197,146, 231,200,149,
+227,190,140, 210,174,128, 213,178,129, 236,200,143, 232,199,142,
+239,210,154, 245,214,154, 204,174,118, 188,156,103, 160,131,90,
+188,160,108, 224,194,140, 247,228,170, 236,209,154, 236,205,152,
+251,234,177, 254,247,191, 254,244,187, 255,249,195, 255,254,210,
+254,254,218, 254,254,209, 254,253,212, 245,240,205, 231,223,189,
+210,194,155, 234,221,186, 243,239,207, 248,239,199, 245,229,173,
+247,221,161, 252,241,177, 251,248,191, 252,245,186, 252,240,187,
+252,243,191, 251,248,199, 250,247,211, 249,247,217, 249,248,225,
+250,248,226, 250,250,226, 250,249,218, 238,228,192, 169,156,135,
+152,151,164, 189,186,187, 240,232,195, 246,245,203, 245,244,205,
+244,243,204, 245,244,207, 243,241,200, 234,228,175, 178,162,129,
+131,124,103, 114,108,114, 100,93,99, 103,95,93, 96,88,89, 95,87,91,
+98,91,91, 98,92,86, 93,88,85, 85,83,81, 85,85,77, 79,81,64, 79,80,65,
+80,80,68, 84,82,68, 84,80,69, 82,78,70, 85,82,72, 76,76,72, 83,83,72,
+80,71,58, 83,77,69, 79,73,73, 83,78,81, 99,101,110, 117,124,132,
+106,98,98, 61,31,22, 46,17,7, 47,21,14, 110,58,19, 129,67,19, 132,67,20,
+132,68,21, 132,68,20, 132,68,20, 131,68,20, 131,68,20, 131,67,20,
+131,68,20, 131,67,20, 132,67,21, 131,67,20, 132,68,21, 131,67,21,
+131,67,21, 131,67,20, 131,67,20, 125,64,20, 28,16,7, 12,10,8, 7,5,3,
+11,9,8, 14,10,9, 11,6,2, 14,5,0, 21,11,5, 15,6,1, 13,5,0, 7,4,0,
+5,6,3, 12,11,5, 11,7,0, 55,42,23, 116,97,59, 145,121,75, 164,135,86,
+220,184,132, 234,199,151, 226,193,148, 240,207,158, 248,213,161,
+251,212,156, 252,215,155, 254,224,159, 254,229,167, 254,244,181,
+254,234,174, 253,225,164, 239,203,141, 210,177,118, 196,165,107,
+169,142,90, 186,162,109, 211,182,125, 222,189,126, 214,184,123,
+237,216,151, 253,246,188, 254,252,204, 254,252,208, 255,247,182,
+255,252,200, 255,255,239, 255,254,234, 254,249,193, 236,221,185,
+248,239,205, 254,244,202, 253,251,197, 253,253,214, 253,252,203,
+253,250,194, 250,245,182, 245,230,172, 246,235,181, 249,238,187,
+248,236,183, 237,225,177, 244,234,191, 245,237,198, 247,239,203,
+237,227,193, 232,222,181, 237,230,197, 249,246,225, 217,207,172,
+135,126,111, 154,156,180, 203,200,193, 245,243,202, 246,246,205,
+247,247,198, 247,247,194, 244,242,194, 240,235,182, 239,235,178,
+209,195,152, 132,122,105, 92,84,90, 89,81,79, 100,94,91, 105,99,89,
+103,96,85, 99,90,84, 95,86,85, 93,86,84, 87,84,75, 85,84,72, 78,77,61,
+80,78,62, 83,80,64, 80,76,64, 74,69,65, 72,67,66, 79,72,65, 77,72,68,
+74,67,61, 78,64,52, 82,71,60, 78,69,67, 83,76,77, 97,94,102, 109,114,122,
+110,109,110, 72,44,37, 50,19,8, 47,16,5, 119,62,20, 130,66,20, 132,67,20,
+132,67,21, 132,67,21, 132,67,21, 131,67,20, 131,68,20, 130,67,20,
+131,67,20, 131,67,20, 130,67,20, 130,67,20, 130,67,20, 131,67,20,
+131,67,20, 130,67,20, 129,67,20, 103,53,16, 13,10,5, 10,7,5, 11,8,6,
+15,8,3, 16,8,4, 20,9,3, 28,13,5, 30,11,2, 17,6,0, 16,6,0, 5,4,0, 9,9,5,
+13,10,4, 26,19,6, 90,78,47, 145,130,83, 170,147,95, 214,185,128,
+249,224,163, 252,231,170, 251,223,164, 253,220,160, 253,232,165,
+253,235,164, 254,234,167, 254,230,161, 249,216,152, 252,230,166,
+254,227,159, 254,220,154, 251,225,161, 249,225,162, 214,190,133,
+198,172,112, 196,170,111, 209,183,122, 199,172,117, 207,180,129,
+235,208,150, 252,241,180, 255,254,208, 255,254,226, 255,252,199,
+255,254,212, 254,254,218, 254,254,214, 244,230,172, 246,239,217,
+254,254,247, 247,241,204, 250,241,187, 253,253,216, 253,252,221,
+245,238,191, 240,226,171, 248,234,180, 250,242,192, 250,245,199,
+251,248,203, 253,252,215, 252,252,227, 252,251,239, 250,249,238,
+252,251,241, 252,251,232, 251,250,234, 247,247,237, 207,199,173,
+123,120,115, 159,163,184, 205,200,184, 244,240,200, 245,243,203,
+247,247,204, 247,247,195, 246,246,195, 244,243,184, 238,236,182,
+227,216,164, 157,144,118, 102,94,91, 102,95,74, 108,101,87,
+99,91,84, 110,102,84, 112,105,86, 105,97,77, 99,92,69, 96,90,66,
+90,87,70, 79,77,59, 81,78,61, 85,82,63, 76,73,63, 68,64,64, 69,63,63,
+76,68,64, 78,71,65, 83,73,61, 78,69,59, 80,67,58, 79,67,63, 81,72,72,
+88,81,87, 104,104,111, 105,104,107, 83,57,53, 52,21,9, 50,18,7,
+123,62,19, 130,66,19, 131,67,20, 131,67,20, 131,66,21, 131,66,20,
+131,67,20, 130,67,20, 130,66,20, 130,67,20, 130,66,20, 130,67,20,
+130,66,20, 130,66,20, 130,67,20, 130,67,20, 130,66,20, 128,66,19,
+65,33,10, 13,10,7, 14,9,5, 10,6,2, 11,5,0, 14,6,1, 23,12,6, 20,8,1,
+32,12,2, 14,5,0, 11,4,0, 7,7,4, 7,6,3, 19,12,5, 80,63,34, 107,98,66,
+132,123,88, 165,148,106, 209,177,122, 246,212,154, 252,230,173,
+253,241,181, 253,241,178, 253,238,173, 254,236,170, 252,226,163,
+254,232,170, 254,230,168, 252,228,167, 253,228,166, 248,222,162,
+249,226,166, 219,195,137, 211,188,130, 231,212,147, 191,173,114,
+192,174,116, 191,168,115, 221,192,138, 248,222,157, 254,246,175,
+254,246,195, 255,253,203, 255,253,215, 254,254,233, 252,248,199,
+247,233,174, 238,228,201, 253,253,247, 253,251,231, 244,234,169,
+253,251,196, 249,246,198, 245,233,177, 245,232,176, 247,233,181,
+247,233,187, 233,217,173, 229,213,171, 229,213,168, 236,222,176,
+237,224,179, 237,225,182, 236,223,183, 239,227,194, 248,238,205,
+249,245,227, 246,245,234, 191,185,168, 115,114,115, 161,163,175,
+197,186,158, 236,226,179, 243,241,197, 244,243,197, 245,245,195,
+246,246,188, 244,242,184, 241,236,178, 234,223,168, 186,169,135,
+121,112,91, 113,105,76, 118,110,80, 104,95,83, 105,96,83, 113,105,76,
+114,108,77, 112,107,80, 109,103,72, 101,98,72, 88,85,63, 86,80,63,
+87,83,64, 75,72,64, 69,65,66, 72,67,67, 78,71,69, 82,75,68, 86,77,63,
+85,71,56, 77,62,54, 71,59,57, 81,71,70, 90,79,83, 96,92,98, 101,97,103,
+81,58,57, 54,22,10, 51,19,7, 125,63,19, 130,65,19, 130,66,20, 130,66,20,
+130,67,20, 130,66,19, 130,66,20, 130,66,19, 131,66,19, 129,66,20,
+129,66,20, 129,65,19, 129,66,19, 129,66,20, 130,67,20, 129,66,19,
+129,66,19, 123,64,18, 33,17,5, 19,13,9, 13,6,1, 7,4,0, 5,3,0, 16,9,4,
+23,11,5, 18,7,1, 19,7,0, 14,5,0, 10,6,2, 7,8,4, 10,5,1, 114,80,47,
+199,173,121, 207,188,140, 203,187,145, 193,180,141, 180,161,122,
+223,199,148, 241,222,170, 235,216,166, 253,235,183, 253,243,187,
+251,228,170, 254,230,173, 254,236,177, 254,238,179, 254,239,180,
+253,237,176, 249,230,169, 220,196,139, 208,188,132, 225,208,154,
+233,215,151, 172,154,99, 182,162,106, 205,182,120, 238,209,141,
+248,222,147, 246,217,148, 253,243,179, 254,254,225, 255,255,252,
+255,254,246, 248,237,178, 238,222,186, 250,247,227, 254,254,253,
+254,254,222, 252,249,195, 233,219,158, 244,230,173, 248,232,179,
+250,238,188, 242,226,177, 225,201,154, 203,179,135, 197,176,135,
+187,165,125, 196,179,142, 212,197,163, 213,200,168, 224,210,175,
+233,214,170, 233,217,177, 226,209,175, 230,217,195, 161,155,149,
+125,124,138, 160,159,167, 213,202,165, 244,235,186, 244,241,196,
+248,244,192, 244,242,195, 242,241,206, 240,239,202, 242,231,177,
+239,217,162, 214,190,152, 143,130,102, 115,106,78, 117,109,76, 102,94,70,
+100,90,82, 109,100,77, 116,108,73, 116,110,76, 117,112,80, 108,104,78,
+100,94,66, 97,90,65, 91,86,66, 79,76,68, 73,69,70, 76,70,69, 81,74,71,
+86,80,72, 85,74,63, 81,65,57, 78,60,55, 80,65,61, 81,70,69, 94,80,83,
+96,86,93, 98,92,98, 81,55,55, 55,26,18, 53,21,10, 126,64,19, 129,65,19,
+130,66,20, 130,66,20, 130,66,20, 130,66,19, 129,66,19, 129,66,19,
+130,66,20, 129,66,19, 129,66,19, 129,66,19, 129,66,19, 129,66,19,
+129,66,19, 128,66,18, 127,65,19, 105,53,15, 19,10,3, 18,10,4, 15,7,1,
+7,4,1, 9,6,4, 12,7,3, 16,9,4, 23,9,1, 31,11,1, 20,9,2, 12,7,2, 5,4,1,
+102,72,41, 194,171,114, 224,203,143, 246,223,166, 245,223,172,
+209,188,143, 197,176,135, 207,181,141, 216,188,142, 222,201,154,
+245,223,170, 242,218,163, 243,218,163, 252,230,174, 251,240,183,
+251,241,184, 243,227,169, 233,211,152, 222,202,145, 234,215,158,
+232,216,161, 201,185,131, 188,166,108, 194,171,113, 194,166,105,
+214,185,119, 251,232,162, 246,214,144, 227,197,129, 249,237,171,
+254,255,221, 254,254,242, 254,254,218, 249,227,161, 229,213,183,
+253,251,220, 254,254,242, 253,250,215, 233,214,159, 243,226,175,
+251,245,197, 217,198,149, 227,205,152, 219,194,147, 222,195,148,
+216,189,143, 200,176,144, 182,162,131, 181,161,126, 178,161,126,
+175,161,128, 185,172,141, 183,167,132, 184,168,136, 181,164,142,
+189,169,156, 150,145,147, 143,146,175, 160,159,159, 221,207,168,
+242,232,180, 241,235,185, 247,236,175, 246,234,174, 246,241,189,
+241,239,197, 237,227,177, 238,208,159, 227,195,155, 188,167,127,
+131,119,89, 125,118,85, 112,103,70, 109,100,87, 114,105,92, 123,117,86,
+125,121,87, 125,120,86, 121,116,84, 109,104,75, 106,99,69, 100,92,67,
+86,81,68, 77,72,69, 77,71,69, 83,76,71, 85,76,70, 81,66,62, 78,59,56,
+75,57,55, 82,66,62, 83,70,70, 95,82,83, 99,86,90, 94,84,89, 76,50,49,
+54,19,8, 53,22,13, 128,64,18, 130,65,19, 130,66,19, 130,66,19,
+130,66,19, 130,65,19, 129,65,19, 129,65,19, 129,65,19, 129,66,20,
+129,65,19, 129,66,19, 129,65,19, 129,65,19, 129,65,19, 129,65,19,
+127,64,18, 75,37,12, 18,10,3, 23,11,4, 16,7,1, 18,9,4, 18,10,4, 19,8,1,
+24,9,3, 35,14,3, 32,13,3, 20,9,3, 11,5,0, 74,42,18, 152,120,72,
+173,150,98, 215,191,135, 248,227,169, 252,246,187, 237,215,158,
+218,190,139, 231,201,158, 250,219,169, 253,227,167, 253,240,175,
+251,237,175, 250,233,174, 249,231,174, 248,234,175, 252,242,182,
+249,232,173, 242,222,163, 238,219,161, 240,221,158, 226,206,145,
+196,173,113, 209,182,121, 189,162,102, 183,158,97, 222,194,127,
+229,203,132, 229,204,129, 242,219,139, 246,233,154, 243,229,163,
+252,244,184, 246,236,179, 216,199,166, 245,226,184, 253,247,195,
+253,247,194, 216,198,143, 215,199,152, 251,244,199, 234,218,166,
+236,211,162, 224,198,145, 215,187,138, 219,191,145, 211,184,143,
+200,176,142, 176,151,114, 174,153,116, 179,160,127, 180,162,136,
+179,167,149, 178,169,157, 184,177,172, 185,177,173, 169,162,162,
+138,136,142, 143,142,157, 168,164,157, 229,216,176, 244,242,196,
+243,238,190, 247,243,188, 246,232,174, 244,235,174, 241,237,191,
+241,232,176, 230,204,163, 223,197,155, 212,189,149, 174,154,111,
+141,128,92, 128,118,79, 124,114,88, 119,109,99, 122,116,94, 121,117,87,
+122,119,88, 120,116,88, 113,107,73, 110,101,74, 106,97,71, 96,88,67,
+86,78,69, 85,77,69, 86,80,73, 86,76,69, 81,63,60, 80,61,57, 77,57,56,
+85,65,61, 83,69,69, 95,78,78, 94,76,79, 94,72,76, 67,41,39, 52,22,14,
+52,17,5, 129,63,18, 130,65,19, 130,65,19, 130,65,19, 130,64,18,
+129,65,19, 129,65,19, 130,65,19, 130,65,18, 129,65,20, 129,65,18,
+129,65,18, 129,65,18, 129,65,19, 129,65,18, 129,65,18, 125,63,18,
+48,23,7, 20,9,1, 24,11,4, 16,8,3, 21,11,5, 28,12,2, 30,12,2, 21,8,2,
+27,11,5, 15,8,4, 10,4,0, 31,12,3, 101,62,32, 111,86,52, 128,109,67,
+167,145,98, 224,196,142, 243,222,161, 229,198,137, 237,213,163,
+219,185,146, 245,209,153, 254,240,175, 254,244,180, 252,242,176,
+252,237,171, 253,247,181, 254,251,185, 252,245,179, 253,237,173,
+249,228,166, 247,229,169, 253,244,180, 253,240,175, 234,207,143,
+205,177,114, 169,143,85, 183,158,95, 207,182,114, 226,205,128,
+204,178,111, 228,201,134, 242,220,160, 240,214,163, 222,201,156,
+223,211,182, 238,231,204, 252,238,187, 253,246,188, 246,235,181,
+178,160,111, 229,220,169, 239,222,169, 224,202,151, 228,201,154,
+225,195,149, 229,201,156, 228,198,154, 224,194,153, 213,189,159,
+198,177,149, 187,171,151, 180,168,160, 178,173,177, 171,170,183,
+158,159,165, 141,138,135, 110,104,89, 102,94,72, 90,83,68, 79,74,66,
+163,159,148, 227,209,157, 247,246,193, 244,243,203, 244,242,207,
+242,238,194, 240,224,165, 238,220,164, 243,229,170, 239,216,171,
+226,206,166, 220,197,154, 201,177,131, 164,144,103, 142,128,85,
+131,120,87, 122,112,98, 120,112,100, 116,113,94, 115,114,93,
+118,113,91, 116,108,81, 117,105,75, 111,101,75, 102,95,76, 96,88,72,
+93,86,71, 91,83,73, 87,74,69, 84,65,61, 85,61,54, 81,62,58, 87,66,62,
+87,71,69, 81,63,63, 91,66,67, 85,57,57, 61,29,23, 50,19,8, 51,23,16,
+128,63,18, 129,64,18, 129,64,18, 129,64,19, 129,64,18, 128,64,19,
+129,65,19, 129,65,19, 129,65,18, 129,65,19, 129,64,17, 129,64,18,
+128,64,18, 129,64,18, 129,65,18, 128,64,18, 114,57,16, 30,14,4, 22,8,1,
+31,14,6, 21,11,4, 16,7,1, 34,13,2, 31,12,2, 22,10,2, 19,10,5, 8,4,0,
+21,7,0, 119,44,11, 98,61,29, 90,59,29, 80,53,28, 73,52,28, 96,66,40,
+142,110,73, 186,149,103, 164,133,100, 196,164,108, 221,196,133,
+218,198,136, 213,192,132, 200,177,120, 198,176,119, 207,186,131,
+205,186,130, 196,176,123, 212,194,139, 226,207,151, 232,210,152,
+246,219,155, 251,224,156, 244,221,151, 217,188,120, 207,184,118,
+226,206,138, 219,197,133, 211,187,129, 187,165,119, 193,174,131,
+208,190,147, 232,213,168, 229,210,159, 248,235,181, 254,250,203,
+245,222,155, 253,247,201, 243,235,198, 194,172,119, 242,221,166,
+232,208,152, 223,197,146, 223,197,153, 218,190,146, 215,187,148,
+218,194,162, 209,190,169, 202,187,173, 176,160,143, 143,132,119,
+135,131,127, 167,173,185, 148,146,136, 155,145,114, 188,174,136,
+222,211,177, 239,234,197, 222,209,171, 103,91,68, 162,155,148,
+214,212,172, 245,244,210, 243,240,199, 245,237,179, 242,223,160,
+235,208,146, 227,200,150, 240,217,163, 239,211,165, 229,208,168,
+222,200,158, 212,184,135, 185,159,116, 151,133,96, 131,117,88,
+121,109,93, 119,110,103, 115,110,103, 113,112,100, 118,114,98,
+121,113,90, 120,108,83, 117,107,80, 112,104,85, 101,96,84, 100,92,77,
+94,84,73, 88,74,68, 87,66,60, 90,66,55, 86,65,59, 88,67,62, 91,72,71,
+90,66,64, 77,54,55, 74,40,37, 54,22,13, 48,13,3, 50,15,5, 128,63,18,
+128,63,18, 128,63,18, 128,63,18, 128,63,18, 128,64,19, 128,64,19,
+128,64,19, 128,64,18, 128,64,19, 128,63,17, 128,64,18, 128,63,17,
+128,63,17, 128,64,17, 127,63,17, 106,52,14, 24,11,3, 25,11,3, 27,13,5,
+22,9,2, 18,8,2, 35,13,2, 37,14,2, 20,11,4, 21,11,4, 12,6,1, 85,27,4,
+181,59,10, 109,49,12, 104,54,17, 110,77,37, 145,121,77, 113,70,38,
+103,64,35, 138,109,77, 131,108,71, 160,136,83, 167,146,92, 148,128,78,
+152,133,82, 154,133,83, 145,125,76, 183,161,107, 178,158,108,
+153,136,88, 167,150,101, 205,185,131, 219,196,139, 216,189,134,
+208,181,129, 198,175,122, 157,136,88, 143,124,79, 163,141,94, 158,137,93,
+128,114,78, 118,106,72, 131,118,77, 154,136,90, 186,164,109, 214,188,128,
+244,223,159, 253,242,181, 252,230,167, 253,246,200, 242,216,161,
+215,188,133, 225,196,140, 224,196,146, 203,176,131, 192,169,132,
+184,164,131, 194,178,156, 194,181,167, 178,163,145, 139,126,105,
+103,92,72, 54,50,31, 119,117,99, 156,157,145, 195,184,150, 237,223,172,
+247,240,205, 247,246,228, 245,244,226, 239,230,195, 155,139,108,
+154,143,141, 182,187,185, 217,220,193, 232,226,183, 236,218,160,
+238,210,144, 238,210,143, 236,212,158, 234,210,160, 231,203,160,
+224,204,164, 222,201,160, 214,187,141, 199,169,122, 159,137,104,
+132,119,102, 119,105,91, 115,103,93, 114,107,102, 113,108,107,
+117,112,105, 122,117,98, 121,111,89, 115,107,86, 116,108,91, 114,106,89,
+98,90,79, 92,81,73, 92,74,68, 92,70,62, 92,67,57, 91,69,61, 89,66,62,
+92,69,68, 89,60,56, 84,51,50, 62,33,28, 49,19,13, 49,13,2, 49,13,3,
+127,63,18, 127,63,18, 127,63,18, 127,63,18, 127,63,18, 127,63,18,
+127,63,19, 127,63,18, 127,63,18, 128,63,18, 128,63,18, 128,63,17,
+127,63,18, 127,63,18, 127,63,18, 126,62,17, 99,48,13, 21,11,4, 28,13,5,
+30,12,3, 17,8,3, 21,9,1, 35,12,2, 28,12,4, 24,11,4, 18,8,3, 9,4,0,
+107,36,5, 143,54,10, 134,98,50, 147,105,53, 149,111,58, 165,145,91,
+142,100,56, 106,72,38, 121,96,65, 126,105,68, 162,143,93, 186,165,111,
+185,162,106, 158,134,82, 116,96,50, 161,137,85, 161,138,86, 123,105,60,
+123,107,62, 117,102,59, 135,120,76, 164,144,96, 156,134,89, 134,111,68,
+124,103,62, 119,101,60, 96,79,44, 101,81,48, 123,104,69, 119,103,64,
+120,103,60, 156,136,85, 196,172,115, 243,220,152, 246,221,154,
+245,216,154, 240,204,142, 241,213,153, 251,222,159, 231,191,131,
+222,190,138, 212,185,136, 205,179,134, 170,151,112, 157,143,114,
+164,152,127, 156,147,122, 153,140,114, 182,168,137, 226,215,179,
+212,191,144, 88,79,48, 141,135,113, 164,157,130, 213,197,152,
+230,207,156, 225,206,157, 223,209,163, 243,238,211, 243,241,228,
+219,210,179, 129,118,97, 137,131,136, 132,128,128, 169,166,157,
+208,203,175, 231,217,162, 233,202,146, 222,184,135, 221,187,135,
+218,196,156, 217,199,162, 221,200,158, 210,186,144, 205,176,128,
+179,151,112, 138,120,103, 126,114,106, 118,104,93, 116,105,92,
+119,111,101, 121,115,106, 127,122,103, 121,115,95, 119,112,93,
+118,109,92, 115,104,87, 106,93,77, 91,79,73, 96,77,68, 96,72,61,
+92,68,58, 94,69,61, 90,65,62, 92,67,64, 81,46,40, 78,42,36, 57,19,8,
+46,20,16, 47,19,13, 49,13,3, 127,62,17, 128,62,18, 128,62,18, 127,62,18,
+126,62,18, 127,63,18, 127,62,18, 126,62,18, 127,62,17, 126,63,18,
+126,63,18, 127,63,18, 126,63,17, 127,62,17, 125,61,17, 123,61,17,
+61,31,11, 33,15,6, 27,12,3, 42,15,4, 20,10,3, 23,9,2, 37,13,3, 24,9,2,
+21,9,2, 28,11,3, 14,7,1, 133,46,7, 142,51,9, 115,56,15, 108,61,19,
+107,76,31, 115,102,53, 120,83,39, 92,56,24, 105,86,54, 87,73,42,
+120,106,64, 146,130,81, 192,169,113, 207,179,121, 166,141,88,
+179,153,99, 161,136,84, 152,130,80, 107,91,50, 74,64,29, 94,82,46,
+100,86,48, 107,89,49, 118,97,55, 108,89,49, 115,97,57, 86,73,39,
+50,41,17, 96,82,49, 170,145,95, 143,121,75, 158,133,83, 185,157,103,
+224,191,130, 239,204,140, 241,213,150, 253,242,188, 254,251,198,
+252,236,168, 208,175,117, 188,165,120, 163,145,107, 171,156,121,
+193,176,140, 155,140,108, 141,128,97, 161,146,110, 186,169,126,
+216,196,146, 238,218,166, 225,202,147, 94,86,55, 138,134,114,
+156,147,113, 176,160,113, 196,175,121, 191,171,119, 156,141,95,
+154,141,96, 188,174,128, 206,193,146, 153,143,111, 149,142,130,
+161,149,125, 138,124,97, 143,133,116, 185,170,147, 233,209,151,
+229,198,152, 229,199,154, 223,202,156, 217,200,165, 219,198,158,
+204,182,146, 207,180,132, 192,164,123, 155,133,109, 131,116,104,
+127,116,106, 129,121,103, 133,127,105, 134,127,108, 135,128,105,
+126,116,96, 123,111,92, 122,108,91, 115,99,81, 105,89,75, 97,81,74,
+99,80,69, 100,75,64, 92,67,60, 94,66,59, 91,65,63, 92,67,65, 78,41,35,
+68,28,18, 51,14,4, 49,17,11, 50,14,5, 47,21,15, 126,62,18, 126,63,18,
+126,63,17, 126,62,17, 126,61,17, 125,62,18, 126,62,18, 126,63,18,
+126,62,18, 126,62,17, 126,62,17, 126,61,17, 126,62,17, 125,61,17,
+123,60,17, 76,39,12, 31,16,6, 33,15,5, 30,13,4, 41,17,5, 24,10,4,
+26,10,3, 36,13,2, 26,10,1, 22,8,1, 23,9,1, 25,11,2, 150,52,8, 141,51,7,
+116,63,20, 112,88,42, 105,60,19, 111,97,50, 126,92,48, 92,49,19,
+103,85,54, 109,93,56, 131,117,74, 133,118,71, 141,123,75, 142,123,76,
+144,123,74, 139,115,67, 143,118,70, 152,129,79, 120,103,59, 100,86,47,
+87,76,40, 69,57,27, 73,61,29, 92,77,40, 65,55,26, 88,75,40, 60,51,23,
+17,17,3, 28,26,10, 142,119,77, 164,138,88, 169,143,91, 217,190,133,
+231,198,141, 219,190,134, 250,239,182, 254,246,190, 254,245,189,
+251,239,180, 174,151,105, 141,128,93, 153,140,106, 187,169,132,
+184,165,126, 123,110,75, 127,112,74, 171,155,106, 181,164,113,
+192,173,120, 207,187,134, 195,175,125, 79,72,43, 115,110,87, 133,121,85,
+112,99,58, 137,122,75, 145,127,81, 138,121,76, 116,102,61, 115,104,64,
+127,116,77, 115,107,78, 136,131,113, 182,169,140, 205,187,145,
+172,157,122, 157,146,128, 208,191,151, 235,203,149, 223,187,141,
+214,194,154, 221,203,166, 216,198,161, 203,182,147, 204,181,138,
+198,171,129, 171,148,116, 137,121,106, 128,114,103, 131,124,105,
+137,131,112, 144,139,115, 144,138,114, 136,126,104, 132,119,97,
+129,112,91, 120,101,81, 108,90,78, 103,82,73, 97,77,69, 99,71,61,
+90,63,59, 94,63,58, 91,64,61, 93,67,65, 79,39,32, 58,19,8, 49,12,4,
+51,18,11, 51,12,2, 50,11,2, 125,61,18, 126,61,18, 126,61,17, 125,61,18,
+126,61,17, 126,61,17, 125,61,17, 125,61,17, 125,61,17, 125,61,17,
+125,61,17, 124,61,17, 124,60,17, 123,60,17, 90,44,13, 41,19,5, 24,10,2,
+24,12,5, 39,17,5, 36,14,4, 35,13,3, 28,10,2, 43,14,2, 30,11,2, 13,6,1,
+8,4,0, 58,21,3, 159,56,9, 142,52,7, 106,50,12, 100,77,35, 101,64,24,
+98,72,31, 127,106,59, 96,51,18, 83,66,37, 88,75,42, 103,90,51,
+128,113,69, 137,120,75, 122,103,60, 129,108,64, 120,97,55, 133,111,66,
+152,129,80, 147,124,75, 143,121,73, 142,122,73, 113,93,52, 94,79,44,
+95,81,43, 78,68,33, 103,89,49, 131,112,67, 99,83,48, 24,21,6,
+72,59,31, 188,162,109, 204,178,124, 224,202,146, 231,204,148,
+170,152,107, 219,202,154, 229,212,157, 229,211,156, 237,223,172,
+168,153,115, 148,134,101, 162,144,105, 179,160,117, 199,177,128,
+158,139,92, 81,73,44, 94,84,46, 131,117,74, 141,126,82, 147,130,84,
+129,113,70, 41,39,16, 102,97,71, 134,121,80, 112,97,56, 114,100,58,
+127,110,65, 133,117,71, 132,116,72, 117,106,65, 98,90,54, 91,84,56,
+96,89,67, 123,111,80, 154,137,92, 154,134,91, 126,110,78, 158,141,117,
+198,165,125, 205,166,122, 212,188,146, 223,201,165, 223,200,163,
+204,182,147, 198,176,135, 197,171,130, 182,157,119, 149,129,108,
+133,119,105, 138,127,106, 147,141,117, 144,139,117, 152,143,115,
+146,132,107, 142,125,102, 139,119,94, 127,106,83, 110,91,79, 104,81,73,
+100,76,69, 97,68,62, 88,61,58, 93,61,57, 93,64,61, 93,63,60, 72,30,21,
+53,14,4, 49,13,3, 51,16,9, 50,11,2, 47,10,1, 124,60,17, 124,60,17,
+124,60,17, 124,60,17, 124,60,17, 124,60,17, 124,60,17, 124,60,17,
+124,60,17, 125,60,17, 125,61,17, 124,60,17, 123,60,17, 100,48,14,
+48,22,6, 33,13,2, 18,6,1, 18,9,3, 46,19,6, 27,12,4, 37,14,4, 30,11,2,
+37,13,2, 38,14,2, 13,5,0, 4,2,0, 88,30,5, 157,56,9, 131,48,7, 102,44,8,
+105,67,26, 115,96,51, 97,55,16, 85,69,32, 81,49,17, 77,61,33, 92,76,44,
+79,68,34, 118,102,60, 117,99,57, 120,101,59, 107,90,51, 103,85,47,
+111,93,51, 112,94,52, 118,101,58, 135,117,72, 136,115,67, 118,99,57,
+134,118,73, 125,106,62, 106,91,50, 148,130,83, 159,140,92, 142,122,76,
+45,37,15, 34,28,9, 117,102,64, 150,131,87, 175,154,105, 217,190,135,
+189,167,116, 201,182,134, 191,175,125, 182,167,118, 180,164,124,
+193,180,145, 159,143,105, 140,123,84, 146,129,84, 203,182,129,
+214,192,137, 140,126,84, 33,32,13, 31,31,9, 68,60,26, 96,84,45,
+103,90,52, 31,30,11, 85,80,56, 110,98,60, 124,108,64, 141,125,76,
+153,135,85, 161,144,96, 172,156,107, 163,152,107, 133,126,85, 114,107,76,
+105,96,67, 135,121,88, 148,132,94, 139,121,81, 105,86,52, 102,88,68,
+147,123,91, 182,154,120, 207,181,143, 224,199,161, 223,196,158,
+207,183,148, 195,171,133, 187,165,130, 189,162,122, 167,145,112,
+145,127,104, 143,131,107, 150,143,118, 150,142,118, 144,135,113,
+148,133,109, 143,124,101, 137,115,92, 125,101,82, 111,91,79, 107,82,74,
+103,74,67, 94,67,64, 91,62,60, 96,61,58, 96,65,62, 88,51,48, 60,19,7,
+51,12,2, 50,12,3, 51,17,9, 48,11,2, 48,11,2, 123,60,17, 124,60,17,
+124,60,17, 124,60,16, 124,60,17, 124,60,17, 124,60,17, 124,61,18,
+124,61,17, 124,60,17, 124,60,17, 121,59,16, 109,53,15, 48,23,6, 45,19,4,
+27,9,1, 18,6,0, 29,13,4, 38,16,6, 38,16,6, 34,13,3, 45,17,4, 26,10,2,
+24,9,1, 12,5,0, 5,4,0, 107,37,6, 154,55,10, 124,46,7, 110,43,5, 88,44,10,
+102,87,45, 97,54,17, 71,54,21, 60,35,10, 48,34,16, 73,60,34, 85,73,40,
+109,93,54, 98,82,43, 93,78,41, 83,71,38, 79,68,35, 83,70,35, 86,74,38,
+92,80,44, 101,87,48, 117,102,59, 97,85,47, 93,82,46, 77,67,33, 66,58,26,
+108,94,54, 132,116,72, 108,94,53, 29,25,6, 19,19,5, 58,52,28, 128,113,75,
+157,139,94, 182,159,110, 185,163,113, 200,179,130, 185,166,119,
+159,143,103, 144,132,97, 172,158,125, 176,159,118, 144,128,86,
+125,110,67, 155,139,93, 194,177,125, 202,181,127, 118,102,59, 28,27,5,
+52,46,18, 86,76,40, 92,82,47, 38,35,15, 84,79,55, 101,91,54, 100,88,49,
+120,107,62, 159,141,92, 172,156,107, 187,174,124, 189,180,130,
+178,168,122, 158,148,114, 153,138,96, 169,154,110, 176,155,108,
+161,141,100, 131,112,83, 97,83,65, 138,122,96, 177,150,112, 200,174,139,
+225,193,155, 216,187,153, 207,178,145, 192,169,134, 184,161,123,
+174,154,121, 173,148,113, 164,143,111, 155,140,113, 155,144,119,
+155,144,118, 148,134,112, 139,124,104, 140,120,97, 129,107,87,
+119,96,81, 110,88,78, 111,84,73, 105,74,67, 95,65,62, 84,58,58,
+84,57,56, 93,62,59, 77,38,30, 52,14,2, 51,12,2, 51,12,3, 51,16,8,
+51,11,2, 46,10,1, 123,59,18, 124,60,16, 124,60,16, 123,60,16, 124,60,16,
+124,60,17, 123,59,17, 123,60,17, 124,60,17, 124,60,17, 122,59,17,
+115,56,15, 45,23,7, 44,20,5, 40,15,2, 23,7,0, 27,10,2, 45,19,5,
+33,16,6, 56,22,8, 42,15,3, 52,19,5, 36,14,3, 22,9,1, 10,5,0, 7,5,0,
+129,44,7, 153,54,9, 127,46,6, 108,42,5, 83,39,6, 76,53,18, 101,79,39,
+60,31,5, 56,39,15, 28,21,10, 33,27,11, 47,39,18, 69,59,34, 69,59,30,
+61,52,23, 62,54,23, 49,43,17, 47,42,15, 58,52,23, 64,57,25, 74,65,30,
+77,68,33, 67,59,27, 66,59,28, 48,43,18, 47,43,16, 92,80,42, 120,104,61,
+63,55,25, 31,27,7, 18,18,3, 18,19,5, 79,71,44, 141,127,92, 170,153,113,
+177,158,116, 192,174,131, 188,170,131, 161,144,110, 104,94,65, 108,99,69,
+166,150,105, 170,154,105, 119,108,70, 109,98,58, 136,121,75, 155,139,90,
+145,129,81, 68,60,28, 28,27,6, 53,48,20, 63,57,29, 34,32,13, 73,68,42,
+104,95,57, 114,102,60, 107,96,55, 124,111,68, 152,139,93, 172,160,110,
+190,179,125, 193,182,135, 203,191,147, 219,206,151, 216,203,154,
+203,184,135, 195,173,125, 183,156,114, 145,127,100, 146,133,110,
+169,153,123, 197,169,133, 210,177,140, 202,172,139, 199,168,135,
+190,165,134, 184,160,123, 169,150,120, 158,141,114, 164,143,112,
+163,147,117, 161,149,122, 156,141,116, 144,125,102, 133,116,96,
+127,108,93, 124,100,86, 118,93,81, 111,88,80, 115,87,74, 107,75,66,
+96,64,60, 96,62,57, 98,62,57, 83,56,54, 66,26,16, 51,11,1, 51,11,1,
+51,13,4, 51,15,7, 51,11,2, 47,10,0, 122,58,16, 124,59,15, 123,59,16,
+123,60,16, 123,60,16, 123,59,16, 123,59,17, 122,59,16, 123,59,16,
+122,59,17, 117,57,16, 59,27,8, 24,12,4, 44,19,4, 35,12,2, 20,6,0,
+39,15,3, 52,21,5, 32,16,7, 60,24,8, 72,25,6, 53,19,4, 64,23,4, 34,13,1,
+8,4,0, 10,7,0, 153,49,9, 155,54,9, 133,48,7, 110,43,5, 80,37,5, 61,43,13,
+57,49,18, 61,27,3, 22,17,5, 15,13,1, 27,17,1, 27,23,7, 41,35,18,
+45,39,23, 37,32,15, 49,43,18, 40,35,12, 29,27,7, 31,29,8, 37,34,11,
+47,43,16, 47,42,17, 38,34,11, 42,38,13, 21,21,4, 23,24,5, 68,59,27,
+105,88,48, 34,30,9, 25,23,4, 23,23,5, 21,22,6, 23,22,8, 59,54,32,
+108,99,68, 147,132,98, 178,161,126, 193,178,142, 174,160,123, 148,135,97,
+130,117,79, 133,120,79, 132,122,78, 121,113,71, 93,84,45, 80,73,39,
+82,75,44, 81,73,39, 51,46,18, 27,26,5, 28,27,6, 44,41,18, 46,44,22,
+61,57,29, 108,97,55, 141,128,78, 157,142,91, 158,144,93, 165,149,95,
+171,155,100, 185,168,111, 193,178,128, 235,219,161, 244,242,187,
+242,240,187, 241,234,180, 235,219,165, 222,198,157, 176,160,128,
+127,110,82, 166,151,122, 186,158,127, 196,159,122, 193,158,124,
+187,155,126, 188,162,131, 185,161,126, 167,148,119, 159,142,116,
+154,139,115, 161,146,119, 156,142,120, 153,135,110, 143,122,98,
+133,111,91, 124,103,89, 115,94,85, 117,91,83, 113,88,82, 116,86,75,
+110,75,66, 98,66,61, 101,63,56, 97,64,58, 89,50,45, 54,24,18, 50,18,12,
+51,12,3, 51,14,4, 51,14,5, 51,11,2, 48,10,1, 122,58,16, 122,59,16,
+122,59,15, 122,59,15, 122,58,16, 122,58,17, 122,58,16, 122,58,16,
+122,59,17, 119,58,16, 84,40,11, 26,10,2, 25,11,3, 45,18,4, 30,10,2,
+20,7,0, 45,17,3, 49,20,5, 35,16,7, 52,22,8, 83,29,8, 55,19,5, 62,23,4,
+23,10,0, 9,5,0, 14,8,0, 178,56,9, 162,56,9, 141,51,8, 124,46,7, 78,33,3,
+30,23,3, 44,23,1, 30,16,1, 22,16,0, 23,19,1, 20,19,0, 17,16,0, 13,15,1,
+10,11,0, 8,10,0, 14,15,3, 15,16,3, 10,12,0, 9,11,0, 13,15,1, 15,17,2,
+17,18,3, 14,16,1, 14,16,1, 13,15,1, 12,14,0, 31,29,8, 52,44,17, 16,16,3,
+17,18,2, 24,23,5, 40,37,13, 40,37,14, 26,25,8, 39,35,13, 84,73,39,
+115,95,58, 114,94,59, 108,94,57, 107,93,54, 121,105,63, 131,116,72,
+111,101,58, 103,96,59, 85,80,47, 53,50,23, 31,30,7, 28,28,10, 16,16,1,
+17,18,1, 32,30,9, 41,37,16, 34,31,10, 73,64,30, 131,116,67, 165,148,93,
+186,169,111, 202,184,122, 195,176,114, 186,167,106, 176,158,99,
+178,160,104, 214,192,131, 230,214,152, 235,218,158, 240,228,169,
+241,225,169, 234,211,167, 207,194,158, 167,158,136, 154,135,107,
+186,152,116, 186,151,120, 185,151,122, 175,140,112, 185,157,127,
+187,161,128, 167,149,123, 159,142,117, 154,137,115, 156,141,118,
+152,135,115, 148,127,104, 138,115,93, 131,108,90, 122,98,86, 114,91,85,
+111,88,85, 112,86,82, 117,83,75, 111,74,65, 101,67,61, 105,65,57,
+99,64,60, 81,38,30, 51,13,5, 52,13,5, 48,19,13, 48,20,14, 51,15,7,
+49,10,0, 48,10,0, 119,57,15, 121,58,15, 121,58,15, 121,58,15, 121,58,15,
+121,58,16, 121,58,16, 122,58,16, 120,58,16, 105,50,14, 41,18,4, 23,8,1,
+32,14,3, 44,16,3, 27,9,2, 24,8,0, 50,20,4, 46,20,6, 40,18,7, 47,21,8,
+68,26,8, 52,19,5, 31,14,3, 12,6,0, 8,5,0, 14,9,0, 188,59,10, 169,57,9,
+141,50,7, 141,51,7, 98,39,6, 55,25,2, 34,19,1, 31,19,0, 36,22,0, 24,19,0,
+17,18,0, 12,17,0, 12,16,0, 11,15,0, 11,13,0, 10,11,0, 7,10,0, 9,11,0,
+10,11,0, 10,12,0, 10,12,0, 10,12,0, 10,12,0, 11,12,0, 12,13,1, 14,15,1,
+13,15,1, 13,14,1, 13,13,1, 14,14,0, 17,18,3, 35,33,11, 79,67,33,
+94,74,45, 124,98,63, 131,103,67, 119,95,62, 104,83,53, 107,86,52,
+126,102,58, 143,123,76, 130,115,71, 119,109,66, 104,97,59, 64,59,28,
+40,37,11, 20,20,3, 20,23,10, 12,14,1, 10,13,0, 33,32,12, 50,44,19,
+77,66,32, 108,94,50, 131,118,67, 149,136,82, 163,148,93, 179,164,105,
+186,171,108, 190,174,110, 184,169,105, 190,174,109, 193,173,110,
+202,179,115, 210,181,119, 216,182,123, 227,192,135, 218,187,142,
+209,201,169, 178,169,147, 151,129,103, 182,145,110, 191,149,111,
+182,143,110, 162,126,97, 175,150,126, 187,161,131, 170,149,123,
+161,143,119, 163,143,118, 157,138,116, 148,129,111, 144,119,97,
+131,106,88, 126,100,87, 120,94,87, 118,94,90, 112,88,85, 108,81,77,
+117,81,73, 113,75,67, 102,66,60, 107,65,56, 95,58,55, 69,27,16,
+44,10,2, 53,10,1, 51,10,0, 51,16,9, 49,19,13, 45,18,14, 46,15,8,
+116,56,15, 120,57,15, 121,58,15, 121,58,15, 121,57,16, 121,58,16,
+121,58,16, 120,57,15, 116,56,15, 58,28,7, 32,12,2, 22,8,1, 44,18,4,
+46,17,4, 28,9,1, 37,12,2, 58,23,5, 43,19,7, 44,20,8, 44,19,8, 55,23,8,
+48,19,5, 14,7,1, 11,7,0, 7,4,0, 11,6,0, 191,59,10, 161,54,9, 123,45,6,
+119,45,7, 132,46,7, 83,29,3, 42,21,0, 38,22,1, 32,21,1, 22,20,0,
+14,17,0, 12,17,0, 12,16,0, 12,16,0, 11,15,0, 13,14,0, 15,13,0, 10,12,0,
+10,11,0, 11,13,0, 12,13,0, 11,13,1, 10,11,0, 10,11,0, 11,12,0, 13,12,0,
+14,14,1, 11,12,1, 13,13,2, 13,13,1, 27,26,7, 118,97,57, 157,125,84,
+170,141,104, 232,197,148, 242,212,171, 216,191,155, 177,152,111,
+142,115,77, 144,114,71, 139,118,70, 119,103,59, 109,98,56, 76,68,34,
+40,38,17, 21,23,6, 23,25,12, 24,25,10, 14,16,4, 18,18,5, 44,38,16,
+83,72,34, 117,102,55, 127,114,65, 138,127,75, 147,135,84, 148,136,84,
+161,149,95, 171,158,101, 172,158,100, 180,165,104, 187,170,107,
+194,175,113, 203,181,117, 208,181,118, 211,180,119, 213,176,122,
+195,165,122, 187,177,148, 146,126,103, 161,137,110, 171,136,106,
+179,139,105, 170,130,101, 159,125,100, 174,144,116, 184,159,132,
+173,153,128, 173,151,123, 172,151,124, 167,147,122, 144,123,107,
+134,111,95, 128,102,90, 126,99,88, 123,97,90, 120,93,89, 116,89,86,
+107,82,79, 120,83,74, 114,76,69, 104,66,61, 109,64,57, 89,47,41, 59,19,9,
+40,8,0, 52,11,1, 50,10,0, 50,16,8, 51,11,1, 49,10,1, 48,14,6, 103,50,14,
+117,56,15, 120,57,15, 120,57,15, 120,57,15, 121,57,16, 120,57,15,
+117,57,15, 82,39,10, 32,14,3, 29,11,2, 26,11,2, 52,21,5, 46,16,3,
+40,13,2, 53,19,3, 60,23,6, 36,17,6, 48,22,8, 39,18,7, 54,23,8, 43,17,4,
+12,6,0, 13,8,0, 9,5,0, 11,5,0, 179,55,9, 132,46,7, 106,42,6, 78,32,3,
+129,42,6, 73,28,3, 52,24,1, 42,23,0, 30,20,0, 17,17,0, 12,17,0, 12,17,0,
+12,17,0, 12,16,0, 12,16,0, 12,16,0, 15,16,0, 13,15,0, 11,15,0, 11,14,0,
+12,14,0, 12,13,0, 13,13,0, 14,12,0, 13,13,0, 15,13,0, 14,13,1, 13,13,1,
+14,13,1, 23,20,4, 80,65,32, 125,90,52, 160,118,69, 219,185,138,
+254,251,197, 254,250,191, 254,235,174, 254,234,180, 209,172,121,
+138,113,75, 103,86,50, 106,91,51, 75,67,35, 33,30,8, 21,23,10, 17,20,7,
+12,14,0, 28,27,12, 28,29,12, 60,53,27, 71,62,29, 99,85,45, 104,92,50,
+106,96,54, 98,89,48, 99,89,48, 107,97,55, 110,100,57, 110,98,56,
+93,82,43, 90,78,41, 105,92,50, 112,97,54, 119,99,56, 136,112,65,
+173,145,89, 206,177,118, 200,179,127, 161,146,116, 133,108,80,
+162,138,111, 144,109,84, 154,117,94, 153,111,84, 163,127,101,
+179,147,119, 186,158,128, 188,164,135, 177,156,131, 178,157,130,
+172,149,125, 156,133,115, 134,111,97, 131,102,91, 130,101,90, 127,98,90,
+126,95,88, 118,89,85, 119,89,82, 113,77,70, 115,74,66, 101,61,56,
+106,59,52, 76,33,24, 51,16,9, 43,8,0, 51,10,0, 49,10,0, 50,16,9, 49,10,0,
+48,10,1, 47,10,0, 58,30,10, 110,53,14, 117,56,15, 120,57,15, 120,57,16,
+119,56,15, 117,56,15, 105,50,13, 31,14,3, 34,14,3, 27,10,2, 34,15,4,
+54,21,4, 49,18,4, 54,19,4, 59,22,5, 59,23,7, 35,17,6, 50,22,9, 40,19,7,
+49,20,7, 44,18,4, 15,7,0, 14,9,0, 12,7,0, 11,5,0, 174,53,10, 174,58,10,
+158,54,9, 117,42,6, 87,31,3, 68,28,2, 55,25,1, 39,22,1, 24,19,0, 13,16,0,
+11,16,0, 12,16,0, 11,15,0, 11,15,0, 12,16,0, 12,16,0, 11,15,0, 12,15,0,
+11,15,0, 10,14,0, 13,15,0, 12,15,0, 14,14,0, 16,13,0, 15,13,0, 19,14,1,
+20,14,0, 18,15,1, 16,13,0, 28,21,6, 68,41,15, 122,60,21, 153,113,66,
+193,152,112, 252,241,180, 255,254,183, 254,237,157, 253,228,171,
+239,206,156, 197,165,116, 143,123,83, 99,84,52, 43,37,16, 26,26,11,
+16,18,6, 18,21,9, 26,27,12, 35,33,13, 49,44,21, 75,67,33, 75,66,34,
+65,58,25, 43,40,14, 39,35,11, 48,43,16, 49,44,17, 54,47,20, 52,43,19,
+40,32,12, 23,17,4, 15,12,2, 15,12,3, 16,13,4, 24,17,6, 41,28,11,
+75,56,27, 123,96,60, 162,141,103, 148,133,106, 125,97,70, 165,136,108,
+138,109,88, 116,78,56, 148,109,90, 180,147,120, 189,159,132, 186,155,128,
+189,165,136, 183,163,136, 180,159,135, 174,151,129, 161,134,115,
+150,116,97, 132,106,94, 136,105,93, 130,99,90, 127,94,87, 122,91,84,
+124,91,83, 107,74,69, 116,71,64, 101,57,50, 98,49,41, 65,22,13, 46,13,7,
+48,9,0, 48,9,0, 50,9,0, 51,18,11, 49,10,0, 49,10,0, 47,10,0, 24,16,9,
+69,35,10, 110,54,15, 117,56,15, 119,57,15, 118,56,15, 113,53,15, 53,23,6,
+25,11,2, 35,13,3, 27,11,2, 43,17,4, 52,20,4, 49,18,3, 53,19,3, 64,25,6,
+65,25,8, 38,17,6, 48,21,9, 48,21,8, 36,16,6, 35,15,4, 14,7,0, 15,9,0,
+14,9,0, 10,4,0, 181,54,9, 171,56,9, 164,55,9, 101,36,4, 90,34,3, 71,30,3,
+52,25,1, 36,21,0, 17,16,0, 14,16,0, 18,19,2, 19,20,2, 23,23,4, 29,27,6,
+33,31,8, 33,30,8, 30,27,6, 26,24,5, 19,19,3, 15,16,1, 12,14,0, 10,13,0,
+12,14,0, 15,13,0, 17,14,0, 21,15,0, 31,17,1, 23,15,0, 20,15,1, 40,25,6,
+103,39,9, 126,70,32, 147,107,62, 158,121,82, 240,217,161, 254,254,200,
+254,247,179, 251,220,161, 253,240,187, 244,219,168, 201,177,127,
+164,134,92, 114,91,57, 53,45,25, 18,18,4, 22,24,13, 20,21,7, 25,24,8,
+29,27,8, 32,30,8, 26,25,5, 19,19,1, 14,15,0, 14,15,0, 11,11,0, 11,10,0,
+10,9,0, 12,9,1, 11,9,2, 17,13,8, 59,56,42, 108,106,76, 130,122,83,
+101,94,68, 43,40,34, 29,24,15, 38,24,11, 104,79,57, 132,109,91,
+176,145,114, 179,149,123, 140,106,83, 123,88,69, 172,135,112,
+196,170,145, 197,173,150, 183,157,135, 185,158,133, 184,162,136,
+174,155,133, 171,148,128, 163,136,120, 160,126,109, 149,115,102,
+128,100,92, 134,99,89, 123,91,85, 128,91,85, 127,92,85, 116,78,71,
+112,67,60, 96,51,45, 88,38,26, 57,16,6, 47,13,7, 48,9,0, 48,10,0,
+50,10,0, 50,16,9, 49,10,0, 51,12,1, 48,11,1, 19,16,11, 25,19,12,
+67,41,20, 109,55,17, 115,56,15, 113,54,14, 81,37,9, 21,8,1, 29,12,2,
+36,14,3, 32,12,3, 51,20,4, 53,20,4, 52,19,4, 62,24,5, 70,27,7, 72,27,8,
+41,18,7, 45,20,9, 51,22,8, 33,16,6, 26,11,2, 11,6,0, 15,9,0, 14,8,0,
+9,4,0, 155,44,7, 144,47,7, 126,43,5, 120,42,5, 97,36,4, 74,30,2, 51,24,1,
+28,19,1, 21,20,3, 28,26,6, 34,31,9, 37,33,9, 43,38,12, 50,43,15,
+49,43,15, 47,40,13, 41,35,11, 32,27,8, 26,24,6, 23,22,5, 20,20,4,
+18,17,3, 14,14,1, 11,13,0, 14,13,0, 19,15,0, 32,16,1, 28,16,1, 23,16,1,
+68,28,5, 142,87,44, 157,118,70, 158,123,76, 190,162,116, 246,230,177,
+253,250,214, 254,253,222, 253,234,172, 253,231,172, 241,213,165,
+232,199,146, 219,178,128, 170,138,93, 91,76,43, 50,43,25, 36,34,16,
+27,27,13, 19,20,6, 12,14,1, 10,14,0, 12,14,0, 12,13,0, 13,12,0, 12,11,1,
+14,13,4, 30,27,10, 50,46,26, 53,48,36, 30,27,26, 32,31,32, 109,107,91,
+168,169,137, 201,201,154, 224,222,175, 146,160,161, 152,151,150,
+79,72,62, 56,36,22, 110,77,57, 186,147,117, 174,137,110, 155,121,100,
+184,153,132, 217,193,166, 222,196,169, 216,188,161, 196,168,143,
+178,151,131, 183,159,135, 177,156,134, 164,142,126, 160,134,120,
+159,126,110, 150,114,101, 144,109,99, 124,92,86, 127,95,88, 130,90,84,
+127,91,85, 117,77,71, 109,62,56, 90,41,30, 73,26,15, 54,14,4, 49,14,7,
+47,9,0, 47,9,0, 49,11,1, 49,16,10, 49,10,0, 51,11,1, 49,11,1, 28,28,23,
+36,37,34, 44,43,37, 61,47,31, 83,46,19, 96,46,15, 32,13,2, 21,8,1,
+35,15,4, 37,13,3, 40,15,3, 56,23,4, 58,23,4, 61,23,5, 73,28,6, 74,28,8,
+77,30,8, 43,19,7, 40,18,6, 51,22,8, 38,18,7, 20,9,2, 12,8,0, 15,9,0,
+11,6,0, 10,6,0, 109,32,4, 167,51,8, 151,49,8, 126,44,6, 103,37,4,
+75,30,3, 45,22,2, 26,23,4, 26,25,5, 33,30,7, 42,38,11, 43,39,12,
+45,42,14, 47,42,14, 46,42,13, 41,37,11, 36,32,8, 29,26,6, 27,25,5,
+25,23,5, 23,21,4, 22,19,4, 21,19,3, 17,16,2, 13,13,1, 14,13,0, 27,16,1,
+30,17,1, 38,20,2, 111,40,9, 132,93,54, 152,113,68, 184,149,101,
+189,151,110, 247,221,172, 252,250,212, 253,253,227, 254,254,207,
+254,250,185, 252,229,173, 248,205,157, 242,202,148, 224,184,134,
+139,117,76, 81,66,41, 42,38,22, 18,20,10, 15,17,5, 15,18,5, 14,16,1,
+16,15,0, 15,15,3, 20,19,9, 20,21,14, 50,50,29, 88,81,42, 98,91,58,
+92,83,59, 54,48,40, 40,39,38, 74,73,74, 155,145,124, 227,228,184,
+238,234,183, 179,186,174, 175,185,192, 235,231,225, 97,86,78, 82,58,44,
+161,119,93, 161,122,103, 188,157,134, 223,204,177, 235,225,196,
+224,211,186, 223,200,175, 203,175,152, 181,151,130, 178,154,133,
+175,149,130, 170,145,127, 158,134,120, 160,127,113, 154,118,105,
+147,111,100, 134,97,89, 126,91,85, 131,90,83, 127,90,84, 119,77,71,
+101,52,44, 77,31,18, 63,20,11, 53,12,3, 51,14,5, 45,8,0, 48,9,0,
+49,11,2, 49,14,8, 49,10,0, 40,9,0, 50,13,2, 44,48,45, 40,45,43,
+42,47,44, 50,52,46, 50,49,39, 37,30,20, 22,15,9, 24,13,5, 45,18,4,
+39,13,2, 50,19,3, 59,23,4, 61,24,5, 67,26,6, 80,31,8, 78,30,8, 83,32,9,
+48,20,8, 37,17,6, 49,21,8, 42,19,8, 22,10,3, 12,7,0, 15,9,0, 9,5,0,
+10,5,0, 84,25,3, 167,50,8, 187,57,9, 136,45,6, 102,35,4, 79,29,3,
+43,22,1, 22,18,1, 23,20,2, 22,22,3, 23,24,4, 22,23,4, 21,23,4,
+26,26,5, 29,28,6, 32,30,7, 32,29,8, 29,27,7, 25,25,5, 22,23,4,
+19,20,2, 19,19,2, 19,17,2, 18,18,2, 17,17,2, 13,15,1, 18,14,1, 33,19,2,
+82,31,5, 100,46,15, 105,80,46, 162,123,82, 157,116,79, 202,146,110,
+242,211,161, 248,234,174, 254,253,205, 253,253,212, 253,253,188,
+254,253,200, 253,240,189, 250,210,167, 253,222,168, 218,189,136,
+137,117,81, 65,56,34, 26,26,14, 14,16,5, 18,21,9, 25,21,5, 19,18,2,
+23,23,9, 25,26,15, 29,34,27, 83,80,45, 120,106,57, 123,114,75,
+105,90,66, 66,57,47, 48,46,41, 83,85,88, 176,169,143, 224,222,174,
+228,223,177, 183,184,171, 179,186,191, 244,242,235, 225,220,209,
+164,135,108, 168,125,100, 185,150,127, 221,202,176, 224,206,180,
+225,212,190, 226,213,193, 226,214,191, 202,178,158, 184,152,129,
+173,148,130, 172,144,126, 174,145,127, 161,135,122, 162,130,116,
+155,118,106, 148,107,97, 139,100,92, 127,91,86, 134,90,84, 123,86,82,
+118,72,66, 85,43,35, 65,24,14, 50,21,16, 53,15,7, 49,13,6, 40,8,1,
+47,9,0, 49,12,3, 48,14,7, 47,10,0, 35,8,0, 56,17,6, 53,57,53, 47,52,49,
+44,49,45, 50,54,49, 53,55,48, 46,46,38, 29,29,22, 27,24,20, 51,21,6,
+47,17,3, 57,22,4, 60,24,5, 59,23,4, 64,24,6, 82,31,8, 82,31,8, 87,33,9,
+57,23,8, 37,17,6, 45,20,7, 46,20,8, 29,14,4, 8,5,0, 15,9,0, 10,6,0,
+9,5,0, 63,18,2, 139,41,7, 176,52,9, 142,44,7, 110,37,4, 84,32,2,
+46,23,1, 27,18,0, 24,17,0, 15,15,0, 11,13,0, 10,13,0, 11,13,0,
+12,14,0, 13,14,0, 15,16,1, 14,15,1, 15,16,1, 17,19,3, 17,20,2, 18,20,2,
+16,18,1, 15,16,1, 16,17,0, 17,18,2, 17,17,2, 13,15,1, 54,30,6, 69,27,3,
+79,42,15, 105,78,48, 140,102,69, 180,141,92, 228,202,141, 250,212,157,
+251,214,155, 253,244,180, 253,253,198, 254,254,197, 254,254,200,
+253,253,210, 253,248,207, 252,218,175, 252,229,178, 226,209,158,
+165,146,106, 93,80,53, 29,28,15, 27,25,14, 33,25,3, 22,18,2, 42,38,15,
+65,60,34, 87,77,51, 152,133,86, 193,167,110, 209,188,133, 224,205,156,
+233,221,179, 230,223,189, 231,227,199, 236,233,202, 240,237,198,
+238,235,199, 239,237,205, 240,240,216, 242,240,220, 240,235,212,
+232,215,181, 230,200,169, 234,216,185, 232,218,193, 230,216,195,
+229,218,196, 222,211,193, 223,211,191, 209,193,174, 183,152,132,
+175,145,127, 168,141,125, 173,145,129, 168,141,126, 158,128,116,
+156,118,106, 152,113,102, 139,101,93, 130,91,85, 130,87,80, 116,83,79,
+109,62,57, 78,32,21, 58,13,3, 53,17,11, 49,17,11, 47,17,11, 45,19,14,
+45,19,15, 43,19,15, 44,17,12, 45,15,10, 42,12,4, 61,22,11, 54,58,52,
+50,53,49, 47,50,46, 48,51,45, 47,49,41, 43,45,37, 33,33,27, 22,22,18,
+35,17,7, 54,20,4, 60,23,5, 60,24,4, 47,19,4, 49,18,3, 79,29,7, 86,32,9,
+88,33,8, 66,26,8, 38,17,7, 40,18,7, 49,22,8, 34,17,6, 11,5,0, 10,6,0,
+12,7,0, 10,5,0, 35,12,1, 113,31,5, 115,34,5, 131,39,6, 116,38,4, 90,32,3,
+43,20,0, 21,14,0, 21,15,0, 19,14,0, 11,11,0, 15,13,0, 14,12,0, 12,11,0,
+10,10,0, 11,10,0, 11,12,0, 11,12,0, 10,14,0, 13,17,1, 16,19,3, 18,20,3,
+14,16,1, 15,16,0, 15,16,0, 19,19,2, 50,37,12, 42,22,1, 63,25,2, 95,53,23,
+129,95,57, 147,107,70, 176,140,96, 234,202,142, 244,203,141, 252,211,153,
+254,223,172, 253,238,179, 253,252,189, 253,253,193, 253,253,199,
+253,252,201, 253,244,195, 245,188,157, 246,212,169, 250,229,177,
+237,209,155, 192,171,124, 130,116,79, 89,79,44, 117,96,54, 155,129,78,
+188,161,104, 208,183,121, 230,209,142, 241,231,165, 243,232,176,
+243,230,184, 243,230,185, 242,230,187, 241,229,185, 243,230,185,
+242,229,184, 241,226,184, 239,223,184, 237,220,186, 239,224,195,
+239,225,200, 240,227,204, 239,225,194, 239,227,197, 238,233,203,
+236,234,208, 229,222,200, 233,222,200, 213,205,187, 221,209,187,
+189,161,142, 174,140,124, 169,139,125, 171,145,130, 171,143,129,
+161,131,118, 157,120,109, 152,111,101, 139,101,93, 137,93,85,
+123,85,80, 128,92,87, 97,48,39, 67,23,12, 53,13,4, 52,15,7, 51,15,8,
+45,8,0, 46,8,0, 44,8,0, 44,15,9, 43,10,3, 40,12,5, 52,18,10, 66,34,27,
+53,55,47, 44,45,39, 41,42,36, 41,42,36, 36,37,30, 30,29,23, 31,30,24,
+21,20,17, 15,13,9, 46,19,5, 60,23,5, 61,24,6, 34,13,2, 38,13,2, 75,28,7,
+85,32,8, 88,33,8, 73,29,8, 40,18,7, 37,17,6, 48,21,8, 38,18,7, 22,10,3,
+6,4,0, 10,5,0, 9,4,0, 14,8,0, 117,33,5, 110,30,5, 114,33,5, 137,43,6,
+114,36,4, 47,21,0, 17,13,0, 17,13,0, 24,15,1, 23,20,5, 15,12,4, 5,4,0,
+7,6,1, 23,21,8, 23,19,5, 13,12,2, 11,10,0, 10,12,0, 11,14,1, 12,16,2,
+13,17,2, 14,17,2, 11,13,0, 24,22,5, 78,57,24, 44,28,6, 32,20,0, 68,28,4,
+115,76,36, 138,105,60, 152,124,75, 188,157,103, 215,156,120, 240,161,123,
+254,198,152, 253,206,163, 253,214,172, 254,243,182, 254,254,187,
+253,251,182, 253,252,201, 253,253,207, 252,229,184, 238,180,144,
+242,180,142, 246,184,143, 246,178,139, 235,173,133, 235,189,143,
+243,219,166, 246,236,176, 247,242,180, 246,242,181, 246,240,182,
+246,235,177, 244,232,174, 245,233,176, 244,227,173, 244,226,176,
+241,223,176, 242,224,179, 243,228,183, 242,226,182, 243,232,191,
+244,239,214, 245,242,221, 240,231,211, 235,225,211, 243,231,203,
+241,236,211, 237,235,217, 235,234,216, 239,237,217, 222,217,197,
+226,218,196, 223,214,192, 200,178,160, 173,138,122, 173,140,124,
+166,141,128, 172,143,130, 169,137,123, 152,119,109, 156,116,106,
+141,105,97, 139,94,85, 126,89,84, 130,99,95, 85,32,19, 54,18,10,
+51,14,6, 50,11,3, 46,14,8, 42,7,0, 41,7,0, 40,8,0, 41,13,8, 40,8,0,
+37,8,0, 56,16,4, 71,29,16, 46,46,37, 40,40,33, 35,34,28, 34,34,28,
+32,32,26, 27,26,21, 20,19,14, 19,18,15, 14,14,12, 23,12,3, 62,23,5,
+48,18,4, 38,13,2, 38,13,2, 65,24,6, 85,32,8, 87,33,8, 76,30,8,
+43,18,6, 37,17,6, 45,20,8, 44,20,8, 30,14,5, 9,5,0, 9,5,0, 10,5,0,
+14,7,0, 81,25,3, 138,38,6, 135,39,6, 117,36,5, 73,24,2, 33,16,0,
+18,13,0, 17,11,2, 25,24,7, 33,33,14, 26,25,14, 9,10,6, 11,12,9,
+33,31,17, 38,36,16, 38,38,12, 32,29,7, 14,13,2, 12,10,0, 13,15,2,
+11,16,2, 17,20,4, 55,44,21, 108,79,40, 89,65,28, 37,24,3, 34,19,1,
+79,34,6, 127,85,42, 145,110,65, 152,127,73, 174,152,94, 211,150,113,
+247,164,123, 253,196,145, 254,210,156, 253,214,161, 253,231,171,
+253,253,186, 254,250,186, 253,239,178, 253,248,200, 253,252,211,
+252,245,203, 245,207,164, 246,204,158, 248,216,160, 243,195,145,
+240,190,130, 221,161,112, 234,184,139, 248,228,168, 247,234,168,
+243,227,166, 244,229,170, 243,226,169, 242,229,169, 244,230,174,
+243,217,178, 236,195,163, 228,195,166, 229,205,174, 238,219,183,
+242,235,203, 245,237,209, 242,235,209, 241,226,205, 237,225,209,
+238,224,208, 240,231,205, 237,230,210, 229,224,208, 222,218,203,
+230,227,210, 227,220,198, 223,213,192, 209,196,178, 171,139,126,
+175,140,125, 171,144,131, 170,143,131, 170,137,123, 157,123,112,
+151,110,102, 141,100,92, 134,89,81, 123,87,82, 116,95,91, 73,29,19,
+49,17,11, 51,16,9, 47,11,4, 41,10,4, 38,7,0, 35,6,0, 35,9,3, 35,10,5,
+34,6,0, 39,8,0, 56,17,5, 70,29,18, 39,37,30, 35,34,27, 32,31,24,
+28,27,21, 27,27,21, 25,25,20, 19,18,14, 16,15,14, 13,14,12, 8,7,3,
+38,15,3, 38,13,3, 36,11,2, 36,11,2, 52,19,3, 84,31,8, 86,32,8, 77,30,8,
+45,19,7, 38,16,6, 42,19,7, 47,21,8, 36,17,6, 16,8,2, 9,5,0, 13,7,0,
+13,7,0, 52,18,1, 177,49,8, 163,52,8, 116,36,6, 52,18,1, 34,17,1,
+52,23,3, 21,16,4, 38,35,11, 51,49,22, 42,38,20, 14,13,7, 4,6,5,
+23,22,16, 47,43,20, 56,53,18, 40,36,12, 17,17,7, 11,12,4, 37,31,13,
+90,72,40, 145,113,68, 137,104,61, 110,83,43, 81,58,25, 39,28,5, 39,19,1,
+100,50,15, 142,89,47, 153,118,73, 159,128,81, 174,126,93, 227,157,117,
+237,166,126, 248,193,142, 254,201,147, 253,219,155, 254,236,165,
+254,241,178, 250,238,184, 251,230,184, 253,218,176, 253,224,182,
+252,240,199, 252,247,205, 252,244,197, 252,238,181, 250,238,173,
+248,241,175, 243,229,164, 228,187,132, 235,187,136, 236,211,158,
+247,241,191, 243,234,190, 243,235,189, 244,237,189, 243,237,195,
+242,226,184, 236,199,178, 227,202,179, 230,208,180, 231,210,187,
+244,234,214, 245,241,221, 245,240,212, 241,225,203, 237,225,213,
+226,218,212, 234,221,199, 231,219,196, 233,218,198, 227,215,199,
+227,218,200, 220,215,196, 209,197,181, 194,182,167, 175,145,133,
+175,141,127, 176,146,134, 167,142,131, 170,137,126, 164,127,116,
+143,109,100, 142,99,91, 128,80,74, 121,90,86, 138,116,110, 72,38,31,
+50,16,10, 45,15,11, 43,15,10, 40,12,7, 37,12,7, 36,13,9, 33,16,13,
+34,14,10, 31,11,6, 30,10,5, 50,17,8, 50,19,11, 34,33,27, 30,29,22,
+28,26,20, 25,24,19, 23,21,16, 23,22,16, 21,20,15, 14,13,11, 11,11,10,
+5,5,2, 12,6,1, 37,13,3, 33,10,2, 34,10,2, 41,14,2, 76,28,7, 84,32,8,
+78,30,8, 48,20,7, 38,17,6, 41,18,7, 46,20,7, 42,19,7, 26,12,3, 8,5,0,
+13,7,0, 13,6,0, 37,13,1, 174,50,8, 159,49,8, 120,36,6, 64,20,2, 93,36,5,
+44,19,3, 27,19,5, 48,41,12, 56,53,23, 45,39,21, 43,33,21, 56,41,26,
+93,74,47, 127,97,62, 133,97,60, 116,85,49, 106,81,46, 123,99,59,
+167,135,85, 177,141,92, 153,122,76, 124,98,55, 92,69,34, 78,59,25,
+43,30,6, 63,28,4, 128,70,27, 151,93,51, 152,111,74, 153,109,80,
+193,138,106, 220,178,134, 231,191,141, 242,194,150, 242,193,156,
+252,218,172, 254,221,174, 253,229,183, 249,217,171, 248,212,166,
+249,218,170, 249,224,173, 251,219,175, 252,217,174, 252,235,183,
+251,245,193, 249,244,187, 249,232,169, 247,220,156, 242,214,150,
+241,203,142, 225,174,127, 223,171,135, 224,180,139, 232,204,154,
+240,215,171, 243,230,186, 231,209,166, 242,221,199, 245,235,204,
+245,240,217, 244,238,217, 241,235,215, 241,232,215, 235,217,196,
+228,204,187, 218,194,183, 208,184,174, 225,194,169, 221,197,174,
+217,189,165, 210,185,166, 204,184,166, 210,197,179, 210,191,173,
+209,187,170, 187,153,140, 170,137,127, 172,141,130, 173,145,132,
+165,136,126, 163,125,114, 142,108,100, 120,82,77, 124,77,71, 115,89,86,
+116,100,96, 73,47,43, 50,15,8, 41,16,12, 37,14,9, 36,9,4, 33,9,4,
+33,10,6, 33,12,8, 31,8,4, 29,9,4, 29,10,5, 29,12,9, 29,13,9, 33,32,25,
+29,27,21, 25,23,18, 23,21,16, 22,19,15, 20,18,13, 19,18,13, 14,13,11,
+9,9,7, 5,4,2, 4,4,0, 26,9,2, 32,10,1, 29,9,1, 40,13,2, 70,25,6, 84,32,8,
+79,31,8, 51,21,7, 39,17,7, 44,19,6, 46,19,7, 44,20,7, 36,17,6, 9,5,0,
+11,7,0, 13,6,0, 37,12,1, 131,37,6, 133,42,7, 110,33,5, 77,26,3, 101,40,5,
+48,23,5, 44,33,13, 77,62,27, 104,86,47, 114,93,53, 118,96,55, 139,114,69,
+159,131,84, 168,137,88, 161,131,83, 158,125,81, 162,128,84, 161,129,84,
+163,132,89, 173,141,96, 143,116,72, 113,90,50, 89,70,34, 73,55,22,
+49,31,7, 115,64,26, 144,84,47, 135,91,57, 133,100,63, 135,106,78,
+171,128,97, 215,180,135, 241,194,140, 253,212,152, 244,168,139,
+240,191,155, 231,188,151, 249,230,186, 253,222,167, 253,230,169,
+252,244,184, 252,245,185, 252,234,178, 250,213,170, 250,207,166,
+249,210,165, 244,205,159, 248,231,174, 249,243,178, 242,227,159,
+244,218,147, 245,209,138, 241,204,148, 227,186,140, 206,157,124,
+193,149,119, 217,188,154, 220,194,157, 229,208,184, 231,214,182,
+232,217,187, 234,218,185, 231,207,175, 227,200,165, 223,190,158,
+218,179,150, 199,158,137, 172,133,126, 195,154,135, 200,160,140,
+195,150,129, 197,149,128, 199,160,141, 208,174,155, 200,170,155,
+201,176,161, 188,151,138, 171,138,127, 169,136,126, 176,143,130,
+159,131,121, 163,127,116, 134,102,95, 121,72,66, 119,75,70, 124,92,88,
+116,95,92, 90,62,58, 43,15,10, 38,13,9, 34,6,0, 34,6,0, 33,6,1, 34,13,9,
+31,7,1, 30,7,1, 29,6,1, 27,6,1, 27,6,0, 27,7,4, 31,29,24, 27,26,22,
+24,23,18, 21,20,15, 20,17,13, 17,15,10, 17,15,10, 16,16,12, 9,10,8,
+4,4,2, 2,2,0, 7,4,1, 30,9,1, 29,8,1, 40,12,2, 67,24,6, 84,32,8,
+80,31,8, 55,23,7, 39,17,6, 47,20,7, 49,21,8, 45,20,7, 43,20,7,
+16,8,2, 8,5,0, 12,7,0, 40,14,1, 99,29,3, 116,35,5, 113,35,4, 94,32,5,
+104,55,20, 107,77,39, 112,87,48, 105,82,46, 122,96,57, 146,120,74,
+162,133,84, 163,132,83, 155,123,78, 142,109,71, 146,115,77, 154,126,86,
+142,117,79, 143,121,81, 121,97,67, 120,97,63, 130,104,67, 122,98,56,
+101,80,41, 66,49,19, 99,58,24, 135,68,33, 116,67,38, 103,68,39,
+119,87,57, 144,103,68, 182,138,101, 237,199,136, 249,206,148,
+253,186,133, 254,187,136, 254,224,161, 239,200,158, 241,202,167,
+251,214,169, 252,242,189, 252,251,208, 251,247,211, 252,252,219,
+251,248,213, 250,231,188, 246,199,162, 197,146,111, 202,151,115,
+201,159,110, 241,221,156, 241,232,167, 237,215,147, 236,204,142,
+241,212,151, 243,220,165, 236,203,154, 209,166,123, 182,141,102,
+149,112,77, 154,117,84, 152,118,80, 154,118,82, 162,124,87, 162,117,81,
+164,113,76, 185,129,92, 182,130,104, 141,89,77, 159,102,81, 161,106,87,
+168,111,92, 177,122,103, 180,136,122, 186,136,122, 186,147,134,
+194,164,149, 185,146,133, 178,141,128, 159,128,120, 173,140,128,
+165,132,122, 144,115,108, 144,104,96, 116,63,56, 104,64,61, 100,71,68,
+120,90,86, 95,64,61, 41,14,9, 38,15,12, 36,13,8, 36,15,10, 35,15,12,
+33,14,10, 33,12,8, 32,12,8, 32,13,9, 31,13,10, 31,15,12, 29,15,13,
+25,23,18, 24,23,18, 23,21,18, 21,19,15, 17,16,12, 16,14,10, 15,13,8,
+17,17,12, 12,12,10, 4,5,2, 2,2,0, 2,2,0, 19,7,1, 33,10,1, 37,13,2,
+64,23,5, 82,31,8, 81,31,8, 60,25,8, 40,18,6, 46,19,7, 57,24,8,
+44,20,7, 47,20,7, 30,14,4, 6,4,0, 8,5,0, 40,15,2, 48,31,13, 75,45,20,
+105,73,38, 139,107,61, 146,112,69, 143,111,72, 143,112,72, 159,124,82,
+159,124,79, 151,116,72, 144,109,65, 138,105,64, 144,107,68, 146,107,73,
+154,118,82, 150,107,75, 140,105,68, 148,119,78, 164,131,86, 141,108,66,
+132,107,63, 119,95,54, 99,73,38, 105,69,37, 118,52,20, 102,37,11,
+110,61,31, 106,74,44, 131,109,57, 150,102,64, 179,129,91, 214,182,125,
+248,224,152, 253,226,154, 254,211,136, 245,194,133, 239,201,150,
+243,212,165, 253,226,167, 251,240,182, 252,249,199, 250,246,198,
+249,246,227, 245,242,228, 248,246,222, 251,240,194, 237,197,155,
+174,125,86, 133,83,50, 116,80,46, 157,127,82, 180,153,104, 179,151,103,
+189,160,113, 198,165,121, 209,177,132, 222,185,141, 228,193,144,
+174,137,94, 100,63,32, 110,70,36, 92,55,24, 90,50,20, 133,71,30,
+143,74,32, 193,110,58, 151,89,63, 116,61,44, 111,53,29, 124,63,40,
+147,86,68, 160,103,90, 152,100,92, 160,112,101, 168,126,116, 168,135,125,
+163,129,120, 173,136,125, 159,126,118, 168,133,123, 168,133,122,
+148,117,109, 138,96,88, 106,55,46, 100,59,56, 110,67,63, 107,69,67,
+81,50,48, 46,18,12, 35,7,1, 33,6,0, 33,6,0, 34,13,9, 30,6,0, 30,6,0,
+29,6,0, 28,6,0, 28,5,0, 30,12,8, 26,5,1, 20,17,13, 19,17,14, 19,17,14,
+18,16,13, 16,14,11, 15,13,9, 15,14,9, 16,16,11, 16,18,14, 5,6,4, 2,2,0,
+2,1,0, 6,3,1, 33,10,2, 39,13,2, 66,24,5, 79,30,7, 80,31,8, 67,27,8,
+42,19,6, 43,18,6, 64,26,8, 49,20,7, 47,20,7, 44,19,6, 8,5,0, 21,8,0,
+96,46,18, 126,94,53, 151,124,75, 167,138,87, 151,120,75, 131,99,62,
+133,88,50, 132,90,53, 115,81,47, 126,98,59, 135,110,66, 134,108,68,
+137,101,65, 146,111,73, 148,118,75, 142,112,76, 155,131,89, 160,131,88,
+149,119,75, 155,128,80, 155,127,80, 135,107,65, 136,102,65, 124,90,59,
+95,58,31, 115,35,6, 127,35,6, 103,46,17, 119,82,41, 149,131,72,
+162,108,71, 184,126,94, 216,182,128, 227,195,131, 253,252,212,
+253,228,159, 222,170,117, 214,180,129, 237,198,143, 221,196,124,
+169,153,96, 163,145,89, 140,125,79, 114,102,62, 100,90,54, 107,95,61,
+159,148,105, 212,192,138, 213,167,119, 106,59,27, 70,40,14, 49,28,6,
+77,54,24, 110,86,50, 121,96,57, 122,95,57, 136,106,66, 173,138,96,
+221,184,140, 232,203,157, 204,161,116, 175,125,84, 149,94,55, 150,82,37,
+151,71,26, 147,66,24, 189,86,36, 69,29,16, 59,30,22, 79,33,18, 115,61,42,
+137,80,67, 141,81,69, 148,92,81, 160,97,84, 167,113,102, 169,124,113,
+176,135,124, 170,132,122, 165,129,119, 158,126,117, 163,129,119,
+151,119,111, 122,86,80, 91,46,39, 104,53,45, 119,62,54, 84,49,46,
+80,42,36, 44,14,8, 34,6,0, 33,6,0, 34,11,5, 32,9,4, 30,6,0, 29,6,0,
+25,5,0, 24,6,1, 38,13,8, 49,25,24, 54,20,15, 16,14,9, 15,13,9, 15,14,11,
+15,13,11, 13,12,9, 13,11,8, 14,12,8, 19,18,14, 23,25,19, 7,8,5, 2,2,0,
+2,1,0, 2,2,0, 18,7,1, 43,16,2, 65,24,6, 79,30,7, 80,31,8, 72,29,9,
+46,19,7, 41,17,6, 61,26,8, 57,24,7, 46,20,6, 52,21,7, 13,7,1, 103,31,6,
+134,63,22, 142,86,40, 121,87,47, 120,96,55, 118,95,55, 124,77,36,
+136,96,56, 113,88,50, 121,95,53, 123,104,61, 126,102,64, 132,104,67,
+145,117,77, 144,119,77, 146,122,81, 148,125,85, 151,132,87, 146,125,81,
+143,121,75, 144,117,73, 153,105,63, 150,105,72, 141,94,70, 135,105,67,
+103,68,37, 125,40,9, 143,41,7, 127,38,6, 91,59,27, 118,94,54,
+145,96,61, 163,109,78, 210,171,114, 201,170,113, 245,222,168,
+238,195,142, 188,143,96, 203,160,109, 182,153,93, 109,95,50, 52,47,23,
+18,17,8, 14,14,7, 21,20,11, 15,16,10, 14,15,9, 17,18,11, 43,38,20,
+160,117,72, 134,80,43, 89,37,7, 55,26,3, 35,19,1, 30,21,1, 45,33,8,
+71,51,20, 93,66,31, 119,83,45, 177,138,98, 213,175,137, 217,176,133,
+182,127,83, 170,110,71, 165,87,41, 165,71,20, 151,60,16, 143,62,28,
+69,34,24, 59,31,24, 65,24,11, 104,44,22, 132,67,49, 141,72,55, 140,81,70,
+148,81,67, 155,98,88, 161,108,99, 164,124,115, 167,126,117, 166,125,115,
+157,122,114, 154,122,114, 154,121,112, 117,80,75, 112,70,66, 109,66,62,
+84,49,46, 88,45,37, 71,32,24, 44,13,7, 35,7,1, 34,9,4, 32,14,11, 29,8,3,
+40,13,8, 60,26,21, 83,45,46, 99,63,68, 113,75,84, 110,73,81, 56,16,9,
+12,10,6, 12,10,7, 12,11,8, 11,11,8, 11,10,7, 12,10,7, 13,11,8, 16,15,10,
+21,21,15, 10,11,6, 3,3,0, 2,1,0, 2,1,0, 4,2,0, 46,17,4, 67,25,6, 82,31,8,
+80,30,8, 74,29,8, 53,23,7, 41,18,6, 57,24,7, 64,26,9, 51,21,7, 54,22,7,
+56,18,3, 149,61,21, 134,63,22, 115,52,16, 92,62,26, 96,68,30, 92,67,32,
+92,50,18, 83,67,35, 94,71,34, 102,82,43, 105,80,46, 113,92,58, 117,97,59,
+127,106,69, 118,98,62, 121,101,64, 126,106,67, 132,112,71, 126,105,65,
+134,103,62, 156,89,47, 131,83,53, 110,79,53, 101,79,52, 98,83,46,
+80,54,22, 139,39,7, 171,47,8, 129,37,6, 65,33,11, 91,65,35, 87,54,31,
+92,63,39, 131,94,62, 155,114,72, 192,148,99, 194,142,100, 102,76,44,
+95,82,43, 32,28,12, 11,9,4, 13,12,8, 26,22,15, 26,23,16, 41,37,27,
+49,42,32, 57,49,41, 54,45,37, 25,22,12, 38,30,18, 133,85,45, 92,42,10,
+80,32,3, 47,23,2, 41,24,1, 29,22,0, 42,29,4, 74,49,15, 95,57,19,
+122,74,33, 168,120,82, 208,163,123, 190,137,99, 162,96,58, 154,79,37,
+145,54,9, 146,52,10, 90,36,18, 45,14,4, 51,24,16, 45,10,0, 132,74,58,
+138,73,59, 127,56,35, 130,67,51, 142,73,60, 149,90,80, 153,98,88,
+166,121,111, 155,118,111, 166,125,115, 165,130,119, 144,115,107,
+148,116,109, 105,81,78, 125,94,90, 126,87,82, 109,64,59, 77,38,29,
+59,26,19, 40,14,8, 36,13,8, 57,26,23, 79,41,43, 109,64,71, 122,80,91,
+127,87,100, 124,85,96, 124,83,92, 122,81,90, 85,45,45, 48,9,0, 8,7,4,
+9,8,5, 10,8,5, 9,8,6, 10,9,7, 12,11,8, 12,10,7, 15,14,9, 16,16,10,
+10,11,5, 3,4,0, 2,2,0, 1,1,0, 2,1,0, 13,5,0, 70,26,6, 82,31,8, 80,31,9,
+74,29,8, 62,26,8, 46,20,6, 55,23,7, 65,26,8, 57,23,7, 52,21,6, 131,40,6,
+173,55,9, 123,46,9, 100,31,3, 88,29,2, 85,31,3, 64,27,3, 38,21,2,
+55,27,3, 86,52,18, 95,72,39, 81,56,26, 81,68,36, 93,81,46, 104,90,56,
+72,56,26, 101,86,50, 107,91,54, 95,79,45, 86,68,34, 139,66,28, 99,67,39,
+72,51,29, 60,46,21, 54,39,17, 46,35,14, 59,28,5, 137,39,6, 188,52,9,
+133,37,6, 34,17,2, 47,28,12, 43,28,12, 31,23,9, 41,30,15, 75,51,27,
+148,108,67, 156,112,72, 60,46,23, 24,21,12, 36,30,20, 40,34,22,
+45,38,26, 52,44,33, 57,49,37, 62,54,44, 71,63,56, 90,78,66, 37,33,22,
+18,17,8, 24,21,12, 117,93,60, 126,78,34, 84,34,4, 74,31,3, 40,22,1,
+35,23,0, 27,21,0, 44,27,2, 78,40,5, 100,46,7, 152,92,51, 192,129,84,
+212,154,109, 200,124,78, 173,85,37, 198,76,12, 119,50,24, 51,15,4,
+42,15,6, 53,23,14, 77,22,5, 102,48,34, 89,30,13, 109,39,18, 120,57,40,
+132,73,60, 139,85,78, 147,88,78, 168,120,109, 148,113,107, 166,125,116,
+165,129,118, 145,115,107, 121,97,92, 103,83,80, 116,102,98, 121,103,98,
+94,64,62, 85,38,28, 54,22,15, 106,64,71, 123,83,95, 133,92,108,
+132,93,107, 131,90,103, 130,87,99, 127,85,96, 126,84,93, 123,82,90,
+116,77,85, 57,17,9, 47,8,0, 6,5,3, 7,6,4, 7,6,4, 8,8,5, 9,8,7, 12,10,7,
+11,10,6, 12,11,8, 11,11,5, 8,9,3, 3,4,0, 2,2,0, 2,2,0, 2,1,0, 2,2,0,
+26,11,2, 81,30,8, 77,30,8, 73,29,8, 66,27,8, 57,24,8, 54,22,7, 63,26,8,
+59,24,7, 58,23,6, 196,57,9, 173,53,9, 159,47,8, 131,41,6, 103,35,4,
+89,31,3, 75,25,3, 62,24,1, 83,32,5, 66,33,6, 72,29,3, 51,34,10, 53,43,16,
+63,57,27, 70,37,9, 76,58,26, 68,59,29, 57,51,22, 47,42,16, 86,36,8,
+75,41,16, 35,24,7, 21,15,2, 19,15,0, 25,16,0, 41,19,1, 54,22,1, 136,41,6,
+211,56,10, 185,43,8, 30,12,0, 22,13,2, 14,10,1, 9,9,0, 10,10,0, 18,14,2,
+36,27,11, 38,29,12, 89,74,42, 97,82,53, 70,59,41, 57,49,36, 64,55,41,
+76,67,53, 81,70,61, 97,84,75, 124,107,85, 153,128,95, 107,90,63,
+92,77,53, 159,136,104, 219,200,162, 178,148,103, 95,49,13, 70,27,2,
+54,22,1, 35,20,0, 30,20,0, 28,18,0, 74,34,3, 119,50,8, 140,58,12,
+200,125,76, 212,142,95, 215,139,91, 187,99,49, 155,71,31, 59,27,18,
+57,20,7, 80,33,19, 78,28,14, 79,23,5, 50,22,16, 71,18,3, 104,38,19,
+114,57,44, 133,64,48, 127,71,62, 135,72,63, 165,116,106, 154,117,109,
+152,115,108, 161,123,113, 144,115,107, 115,93,88, 109,76,72, 104,67,63,
+102,68,64, 79,49,46, 66,34,28, 59,22,16, 134,93,110, 136,94,110,
+134,93,107, 133,91,104, 131,88,101, 129,86,98, 128,85,96, 125,84,93,
+122,82,91, 89,50,51, 47,8,0, 45,8,0, 4,3,2, 5,4,2, 7,7,5, 6,6,4, 8,7,6,
+11,9,6, 11,9,6, 10,9,6, 8,7,4, 5,6,1, 3,5,0, 1,2,0, 2,2,0, 2,2,0,
+2,2,0, 3,2,0, 39,15,3, 74,29,8, 70,28,8, 65,26,8, 63,25,8, 58,24,7,
+60,24,6, 56,23,6, 59,23,6, 196,58,9, 189,57,10, 188,51,11, 155,50,8,
+118,42,5, 103,37,3, 83,28,3, 94,33,4, 84,31,2, 68,27,1, 119,40,5,
+58,25,1, 22,21,2, 52,26,3, 74,35,6, 37,34,11, 25,25,5, 34,31,9, 46,29,7,
+130,40,5, 40,19,1, 12,11,0, 27,14,0, 25,11,0, 17,8,0, 16,7,0, 12,7,0,
+38,13,2, 155,40,7, 149,33,6, 40,14,2, 16,10,1, 17,11,1, 29,14,2, 12,11,1,
+10,12,1, 10,12,1, 10,12,1, 62,57,30, 104,91,57, 123,108,79, 135,118,91,
+146,129,99, 156,139,108, 166,149,114, 180,158,119, 199,172,128,
+208,178,135, 229,197,154, 240,224,179, 248,239,195, 248,232,185,
+241,230,181, 183,147,96, 102,47,11, 90,34,3, 50,22,1, 44,24,0, 33,19,0,
+63,30,4, 137,75,31, 140,61,16, 188,108,59, 219,140,86, 219,151,103,
+171,109,81, 107,50,28, 65,28,17, 67,22,7, 134,73,57, 129,62,45,
+61,16,3, 58,26,20, 91,37,23, 107,48,32, 118,54,36, 125,55,37, 123,61,47,
+120,70,62, 160,110,100, 156,117,109, 148,112,104, 154,116,108, 124,99,94,
+113,91,86, 114,84,80, 92,52,48, 80,40,33, 85,34,21, 54,24,19, 61,28,23,
+134,94,109, 135,93,108, 134,92,106, 132,90,103, 130,88,100, 129,86,97,
+126,84,94, 123,82,91, 117,78,85, 59,18,12, 47,8,0, 44,8,0, 6,5,3, 3,4,1,
+5,6,4, 4,5,2, 6,6,4, 9,8,5, 10,8,5, 8,7,4, 6,5,2, 5,6,1, 5,6,1, 2,4,0,
+2,2,0, 2,2,0, 2,2,0, 2,1,0, 3,2,0, 43,17,4, 63,26,7, 59,25,7, 57,23,6,
+56,23,6, 57,22,6, 53,21,6, 67,25,6, 165,47,7, 209,62,11, 175,49,11,
+174,59,9, 134,48,6, 104,39,4, 111,36,5, 118,39,5, 110,38,4, 100,35,3,
+113,38,4, 65,28,2, 22,17,0, 84,32,3, 30,18,0, 11,13,0, 11,14,0, 16,20,2,
+120,41,8, 122,36,4, 23,10,0, 15,6,0, 27,10,1, 10,5,0, 7,5,0, 4,4,0,
+5,5,0, 16,8,1, 59,18,3, 79,24,3, 26,15,1, 15,13,0, 15,14,1, 32,18,1,
+21,16,0, 10,13,0, 10,12,0, 17,18,3, 54,48,20, 129,113,75, 158,141,99,
+181,159,110, 200,173,121, 229,199,139, 231,205,140, 241,225,161,
+248,225,163, 249,224,164, 250,219,160, 237,200,146, 244,208,155,
+247,219,162, 245,228,168, 242,232,177, 163,130,90, 84,38,11, 70,28,4,
+55,23,1, 46,22,0, 53,23,0, 120,55,14, 172,93,43, 152,72,25, 192,136,97,
+173,124,101, 153,99,80, 123,65,45, 99,44,28, 105,43,23, 124,65,49,
+115,57,43, 58,25,19, 59,29,23, 76,19,5, 106,41,22, 119,53,35, 119,53,35,
+122,55,37, 125,74,66, 147,104,96, 155,117,108, 158,119,109, 139,107,100,
+121,97,91, 103,84,80, 100,80,75, 100,58,52, 81,33,21, 61,25,17, 56,20,13,
+57,26,23, 136,94,110, 134,93,107, 134,92,105, 131,90,102, 129,87,98,
+128,85,96, 126,84,94, 122,82,91, 92,52,54, 48,8,0, 45,8,0, 43,7,0, 6,6,3,
+5,6,3, 4,5,2, 6,8,5, 5,6,4, 7,7,5, 7,6,4, 6,5,2, 4,3,1, 4,5,0, 6,7,1,
+5,6,1, 2,3,0, 2,3,0, 3,2,0, 2,2,0, 2,2,0, 5,4,0, 39,17,4, 49,21,6,
+47,20,6, 48,20,5, 48,19,5, 45,19,4, 72,26,5, 155,45,6, 206,59,10,
+151,45,9, 157,55,8, 145,51,7, 138,48,7, 133,43,7, 125,40,5, 123,40,5,
+137,45,6, 102,37,4, 41,22,0, 67,29,2, 94,35,4, 29,19,0, 11,14,0, 12,15,0,
+15,20,2, 133,38,5, 115,33,5, 15,12,6, 13,11,4, 10,9,2, 8,7,0, 8,7,0,
+7,7,1, 9,8,1, 12,10,1, 56,21,3, 112,36,5, 22,14,0, 10,11,0, 12,12,0,
+12,14,1, 15,16,1, 16,17,2, 23,23,6, 50,45,20, 102,89,52, 147,129,85,
+187,169,108, 228,207,131, 237,211,134, 251,241,162, 251,247,182,
+251,252,197, 251,251,197, 249,248,180, 249,232,159, 245,212,144,
+245,210,147, 246,215,155, 243,211,157, 245,226,163, 237,220,165,
+124,99,73, 42,26,15, 50,27,15, 57,28,10, 58,28,12, 79,35,12, 132,76,45,
+122,72,44, 138,87,63, 144,95,75, 153,95,74, 123,65,47, 97,49,36,
+84,38,26, 78,36,26, 50,13,4, 44,10,2, 56,21,13, 88,24,4, 105,41,22,
+116,48,28, 116,54,37, 124,55,39, 132,78,70, 150,109,102, 154,115,107,
+157,118,109, 149,113,106, 105,83,79, 105,84,79, 100,82,78, 97,80,76,
+69,28,19, 60,22,13, 51,19,12, 56,26,23, 134,92,108, 134,93,107,
+133,90,103, 131,89,101, 128,86,97, 127,85,96, 124,83,93, 115,75,83,
+58,20,14, 46,8,0, 44,8,0, 43,7,0, 3,4,2, 6,6,3, 7,8,3, 6,8,5, 8,9,7,
+7,7,5, 6,6,3, 4,4,1, 2,2,1, 3,4,0, 6,7,1, 5,7,0, 3,4,0, 3,4,0, 4,5,0,
+2,3,0, 1,1,0, 2,2,0, 8,6,0, 36,15,4, 40,17,4, 39,17,4, 40,16,3, 37,15,3,
+66,22,4, 174,50,7, 179,51,8, 145,43,8, 165,57,9, 140,50,8, 129,46,6,
+133,44,6, 121,40,6, 141,44,8, 164,54,8, 104,39,4, 35,21,1, 100,38,4,
+103,38,4, 29,19,0, 15,16,0, 13,16,0, 19,21,3, 104,30,4, 134,36,7,
+23,17,9, 22,15,7, 14,11,4, 15,11,3, 13,11,3, 12,11,3, 12,11,2, 15,14,3,
+20,16,2, 19,15,1, 13,14,1, 14,15,1, 17,17,2, 20,19,4, 28,26,8, 39,35,13,
+58,51,24, 77,69,39, 121,101,64, 156,139,93, 201,188,114, 245,228,144,
+251,235,150, 252,249,173, 252,252,216, 252,252,221, 250,249,203,
+249,247,179, 250,237,159, 249,218,147, 246,212,145, 246,211,148,
+237,200,146, 235,201,148, 243,224,165, 216,185,141, 88,64,47, 37,21,12,
+32,16,7, 48,25,15, 33,15,3, 72,36,15, 126,76,52, 138,85,59, 161,112,93,
+153,97,78, 119,64,48, 69,32,21, 95,36,17, 51,23,16, 45,9,0, 52,16,8,
+56,18,10, 88,24,5, 101,39,21, 111,47,30, 119,51,33, 121,57,42, 137,79,71,
+150,115,107, 151,115,108, 158,122,113, 154,119,110, 127,99,93, 95,77,73,
+104,84,79, 97,81,77, 54,23,17, 47,19,14, 55,19,10, 61,28,22, 133,92,107,
+133,91,105, 131,88,102, 129,87,100, 127,85,96, 125,84,94, 122,83,93,
+82,41,39, 48,13,7, 44,8,0, 43,8,0, 43,8,0, 3,3,0, 5,5,2, 7,7,3, 6,7,3,
+8,9,7, 5,5,3, 4,4,2, 3,3,0, 1,2,0, 2,2,0, 5,6,0, 6,7,1, 4,5,0, 3,3,0,
+3,4,0, 4,4,0, 2,2,0, 1,1,0, 2,3,0, 10,6,0, 30,13,3, 29,13,2, 30,12,2,
+33,13,2, 37,14,2, 170,48,7, 152,40,6, 145,39,7, 163,55,9, 175,61,10,
+140,50,7, 109,37,5, 108,35,5, 131,42,6, 158,53,8, 110,41,5, 37,22,0,
+130,47,6, 104,39,4, 23,18,0, 13,16,0, 13,15,0, 15,15,0, 40,18,1,
+155,42,7, 43,14,1, 19,10,0, 11,9,0, 15,14,2, 16,15,2, 16,15,2, 17,17,2,
+21,20,3, 24,22,3, 22,21,3, 20,21,3, 20,20,3, 23,22,5, 32,27,9, 44,39,16,
+56,51,25, 84,71,39, 99,87,55, 145,118,77, 169,147,100, 203,189,116,
+246,232,150, 252,249,175, 251,251,189, 251,251,214, 249,248,211,
+249,249,195, 249,247,178, 249,237,162, 247,225,155, 244,220,152,
+242,207,148, 238,201,144, 226,184,139, 237,200,147, 239,211,156,
+175,139,105, 57,36,25, 44,28,22, 44,26,19, 45,25,16, 44,19,6, 119,70,47,
+123,67,41, 157,104,85, 150,96,80, 122,64,46, 64,28,19, 126,59,42,
+69,29,21, 45,9,0, 69,24,13, 62,15,4, 75,17,2, 96,38,22, 107,44,27,
+116,47,27, 120,59,47, 143,89,81, 164,124,114, 136,108,102, 159,123,113,
+154,122,113, 149,117,107, 116,91,86, 97,77,71, 103,79,76, 37,18,15,
+53,15,8, 57,18,9, 53,26,23, 132,91,106, 131,89,103, 130,88,101,
+128,86,97, 126,85,95, 123,82,91, 110,69,75, 52,10,4, 46,12,7, 44,8,0,
+43,8,0, 43,9,1, 2,2,0, 4,4,1, 6,6,3, 9,9,6, 5,6,4, 6,6,4, 3,4,1, 2,3,0,
+2,2,0, 2,2,0, 4,5,0, 6,7,0, 5,6,0, 3,3,0, 3,3,0, 5,5,0, 3,3,0, 2,2,0,
+2,2,0, 4,5,0, 11,6,0, 21,10,2, 21,10,1, 24,10,2, 25,10,1, 135,41,6,
+161,46,7, 128,37,8, 138,47,6, 166,57,8, 166,57,9, 106,36,5, 95,30,5,
+130,43,6, 160,54,9, 124,45,7, 49,25,1, 165,57,9, 105,40,4, 21,17,0,
+12,16,0, 12,14,0, 11,13,0, 18,13,0, 140,45,7, 69,22,3, 16,13,0, 17,15,1,
+18,17,1, 17,16,1, 18,18,1, 22,22,2, 26,25,4, 27,26,4, 24,26,4, 27,26,6,
+28,24,6, 34,29,9, 47,37,15, 68,56,29, 85,75,44, 103,91,57, 112,97,60,
+161,128,85, 206,173,120, 234,202,139, 250,227,153, 251,245,179,
+250,247,187, 251,250,210, 250,250,231, 250,251,220, 251,250,204,
+249,241,179, 249,234,170, 246,228,165, 245,228,166, 245,221,163,
+240,199,151, 238,192,145, 238,205,149, 219,185,133, 93,61,39, 40,24,16,
+34,14,4, 45,25,16, 49,26,17, 108,63,45, 118,61,37, 148,93,75, 144,86,68,
+121,61,42, 61,27,19, 120,58,43, 82,33,21, 58,12,0, 69,26,16, 64,13,2,
+86,23,5, 90,38,25, 102,37,17, 108,40,20, 122,60,48, 148,99,90,
+164,125,115, 152,120,112, 139,112,105, 155,125,116, 149,116,107,
+126,97,90, 95,74,69, 91,67,63, 36,18,15, 47,20,15, 53,22,15, 65,34,33,
+132,92,107, 131,88,102, 129,86,98, 127,84,96, 125,84,93, 121,81,91,
+69,27,23, 49,8,1, 45,11,6, 43,8,0, 42,8,0, 43,14,9, 1,1,0, 3,2,0, 4,4,1,
+8,8,4, 6,7,4, 3,5,1, 2,4,0, 2,2,0, 1,2,0, 1,2,0, 3,5,0, 6,7,0, 5,6,0,
+3,4,0, 2,3,0, 3,4,0, 2,3,0, 1,2,0, 2,2,0, 3,3,0, 4,6,0, 10,6,0, 17,9,1,
+18,9,1, 20,10,1, 69,23,3, 200,65,10, 153,47,8, 106,36,5, 176,60,9,
+152,53,8, 112,38,4, 101,31,4, 140,47,7, 170,57,10, 148,52,8, 85,34,3,
+164,57,9, 100,39,4, 25,19,0, 14,15,0, 14,16,0, 10,12,0, 43,19,1,
+131,42,6, 94,33,4, 52,22,1, 30,19,0, 25,17,0, 23,19,0, 21,22,2,
+23,23,3, 24,23,3, 25,25,3, 24,25,3, 25,24,4, 31,27,7, 44,36,14,
+72,58,27, 106,85,51, 107,93,59, 111,101,64, 124,111,71, 162,139,89,
+211,185,125, 239,215,150, 247,226,159, 247,234,165, 246,235,170,
+248,240,197, 246,239,209, 245,237,208, 243,235,193, 243,232,178,
+243,230,167, 243,226,164, 241,222,159, 238,218,157, 238,209,154,
+239,200,152, 241,205,152, 233,204,146, 149,111,74, 54,30,17, 36,15,7,
+52,26,16, 35,11,0, 92,49,33, 134,80,59, 137,83,65, 149,90,73, 117,57,38,
+65,30,22, 97,42,30, 82,32,21, 55,10,0, 67,25,16, 82,29,17, 92,37,23,
+87,36,23, 82,34,23, 99,42,26, 127,63,51, 149,102,93, 164,125,115,
+151,118,111, 154,122,114, 134,111,103, 149,117,107, 134,103,95,
+113,85,80, 95,66,61, 43,21,17, 58,20,10, 61,22,12, 73,41,42, 131,90,104,
+129,87,99, 127,86,97, 125,84,94, 122,82,92, 98,56,60, 49,8,0, 46,8,1,
+44,11,5, 42,7,0, 43,13,7, 41,8,1, 1,1,0, 2,2,0, 4,4,1, 5,5,2, 6,7,4,
+4,5,1, 2,3,0, 2,2,0, 2,2,0, 2,2,0, 3,5,0, 6,8,0, 6,7,0, 4,5,0, 3,3,0,
+4,4,0, 2,3,0, 2,2,0, 1,1,0, 2,2,0, 3,3,0, 3,3,0, 57,26,7, 86,38,11,
+84,36,11, 82,36,10, 212,70,13, 187,62,9, 108,38,5, 155,52,7, 184,61,10,
+121,41,5, 91,29,3, 129,44,6, 183,60,11, 164,57,9, 92,35,4, 158,54,9,
+94,36,4, 27,19,0, 15,16,0, 14,15,0, 7,11,0, 104,35,4, 128,42,6, 107,35,4,
+71,28,1, 58,25,2, 50,24,2, 28,22,1, 23,22,1, 27,25,3, 26,26,3, 26,26,3,
+26,26,4, 26,23,5, 44,35,14, 75,60,31, 90,74,43, 102,87,54, 110,98,64,
+102,92,58, 126,112,72, 136,118,68, 155,136,80, 163,145,89, 162,145,91,
+163,145,92, 157,140,87, 154,135,83, 152,132,81, 154,130,84, 164,141,92,
+155,134,83, 142,123,75, 144,125,76, 155,132,82, 167,139,87, 176,145,96,
+197,163,113, 221,183,134, 237,208,152, 199,162,116, 70,40,20, 49,24,13,
+69,33,20, 52,16,1, 80,40,25, 127,66,41, 135,81,63, 149,94,80, 112,52,33,
+66,28,20, 77,34,26, 102,49,37, 61,25,18, 82,34,23, 102,35,16, 104,40,21,
+84,26,11, 82,21,5, 99,50,38, 126,70,62, 138,97,89, 162,123,114,
+149,117,110, 153,119,110, 148,120,110, 129,103,96, 139,107,98, 111,83,77,
+73,44,39, 50,22,16, 50,22,16, 48,23,16, 85,52,56, 129,88,101, 128,86,98,
+127,85,95, 124,83,92, 116,76,85, 60,17,11, 47,8,0, 45,8,2, 44,11,5,
+42,11,5, 42,11,4, 40,7,0, 1,2,0, 1,2,0, 2,2,0, 3,4,0, 3,3,0, 3,5,1,
+2,3,0, 1,2,0, 2,2,0, 2,2,0, 3,4,0, 5,7,0, 6,8,1, 6,7,0, 3,4,0, 5,6,0,
+3,4,0, 2,3,0, 1,1,0, 2,2,0, 1,2,0, 3,3,0, 8,5,0, 87,38,10, 103,45,13,
+101,44,13, 185,64,13, 206,70,12, 159,53,8, 84,31,2, 191,62,9, 124,42,5,
+100,34,5, 92,34,3, 193,64,12, 188,64,12, 80,32,2, 170,57,9, 102,38,4,
+31,20,0, 16,16,0, 12,13,0, 22,13,0, 158,50,7, 152,48,7, 123,40,4,
+90,32,2, 79,29,2, 57,27,2, 45,27,2, 28,24,2, 28,27,4, 30,29,5, 40,36,9,
+56,49,18, 66,53,26, 66,56,30, 70,59,33, 90,78,48, 103,90,57, 101,88,52,
+120,102,63, 160,140,87, 121,105,57, 80,67,37, 64,53,27, 54,47,23,
+59,53,27, 64,56,34, 77,67,42, 87,77,48, 89,73,46, 94,77,49, 105,89,56,
+106,88,53, 100,86,44, 102,84,44, 139,117,70, 155,128,83, 159,125,85,
+171,132,88, 212,178,129, 225,192,142, 104,67,37, 44,25,12, 78,36,21,
+90,36,14, 75,36,23, 125,62,38, 121,62,43, 144,87,74, 110,55,39, 74,32,24,
+69,36,30, 112,49,34, 74,22,9, 97,35,17, 110,40,19, 107,47,31, 103,35,14,
+99,37,20, 124,60,47, 118,70,64, 149,103,94, 146,114,106, 149,119,112,
+151,118,110, 148,117,107, 140,113,103, 125,97,89, 106,78,72, 63,31,25,
+49,23,17, 60,24,14, 56,21,11, 102,64,72, 127,86,99, 127,85,96, 125,83,93,
+121,82,92, 82,40,40, 48,8,0, 45,8,0, 44,9,3, 43,12,7, 42,13,7, 39,7,0,
+37,6,0, 1,2,0, 1,1,0, 1,1,0, 1,2,0, 2,2,0, 2,2,0, 2,3,0, 2,2,0, 1,2,0,
+2,3,0, 2,3,0, 5,7,0, 6,7,0, 6,7,0, 5,6,0, 5,6,0, 4,5,0, 3,3,0, 2,2,0,
+2,2,0, 2,2,0, 2,2,0, 2,2,0, 15,7,1, 89,39,11, 103,44,13, 133,52,13,
+227,74,13, 195,65,10, 75,28,2, 172,54,8, 130,43,6, 114,40,5, 107,39,5,
+155,52,8, 201,66,12, 77,31,2, 179,58,10, 105,39,5, 50,24,1, 17,15,0,
+11,13,0, 65,24,2, 190,58,9, 174,53,8, 132,43,5, 102,35,3, 93,34,3,
+72,31,2, 50,28,3, 41,27,3, 33,29,5, 39,35,8, 47,43,15, 72,63,28,
+97,84,43, 106,93,52, 120,106,65, 117,104,65, 122,109,67, 119,104,61,
+136,118,69, 105,89,48, 59,50,25, 37,33,16, 34,29,12, 42,39,19, 46,43,22,
+44,41,23, 56,46,24, 49,40,20, 31,25,10, 37,33,16, 46,39,21, 58,48,27,
+78,67,41, 78,62,38, 105,84,55, 115,91,59, 142,114,77, 154,118,78,
+168,128,86, 210,176,130, 163,120,84, 45,25,4, 79,41,27, 106,49,26,
+94,43,26, 118,55,30, 125,64,44, 139,82,68, 106,49,32, 74,26,14,
+55,24,19, 119,54,39, 89,33,18, 106,39,20, 112,44,24, 113,52,35,
+111,43,24, 110,51,35, 128,62,50, 125,73,67, 149,106,96, 159,121,110,
+136,110,103, 153,123,113, 144,112,102, 139,108,100, 128,102,93, 91,68,64,
+57,28,22, 57,25,17, 52,25,18, 47,20,15, 113,75,84, 126,85,97, 125,84,95,
+122,82,91, 108,68,75, 50,10,3, 46,8,0, 43,7,0, 42,10,4, 42,15,11, 40,7,0,
+36,6,0, 36,6,0, 2,2,0, 1,2,0, 1,1,0, 1,1,0, 1,1,0, 2,2,0, 1,2,0, 2,3,0,
+2,3,0, 2,3,0, 2,4,0, 4,6,0, 6,6,0, 6,8,0, 6,8,1, 6,7,1, 5,6,0, 2,4,0,
+3,2,0, 2,2,0, 2,2,0, 1,1,0, 2,1,0, 3,2,0, 15,7,1, 91,39,11, 101,44,13,
+207,69,14, 212,71,12, 129,44,6, 91,30,4, 133,42,7, 127,45,6, 132,47,6,
+132,46,6, 195,65,11, 107,40,5, 191,61,10, 124,44,6, 58,26,1, 11,14,0,
+9,12,0, 126,40,5, 209,63,10, 183,57,8, 145,46,6, 119,40,4, 98,37,3,
+81,36,4, 49,28,3, 32,28,4, 29,26,5, 16,17,3, 9,11,1, 12,14,4, 51,45,22,
+109,99,54, 127,116,65, 126,114,63, 123,110,62, 93,80,43, 63,49,26,
+50,39,22, 51,43,25, 42,36,18, 42,35,16, 37,30,12, 32,25,10, 20,17,4,
+29,24,9, 30,25,10, 24,22,8, 30,28,10, 25,26,8, 35,37,14, 44,44,24,
+55,51,33, 62,56,37, 62,49,28, 90,70,44, 124,92,62, 153,116,79,
+164,124,89, 198,159,120, 63,34,11, 67,35,14, 117,64,45, 124,70,52,
+116,59,39, 121,61,41, 136,79,65, 107,50,35, 87,31,15, 51,22,17,
+109,51,39, 101,44,31, 101,33,13, 103,47,32, 118,52,34, 115,52,36,
+118,54,37, 120,60,49, 135,81,71, 146,106,95, 159,120,109, 140,110,102,
+133,108,100, 146,113,103, 136,104,95, 120,96,88, 93,70,65, 83,54,49,
+83,52,46, 59,26,15, 60,28,23, 123,84,95, 125,83,95, 123,83,92, 119,80,90,
+67,26,22, 46,8,0, 44,7,0, 42,6,0, 41,13,8, 41,9,3, 36,6,0, 35,7,0,
+34,6,0, 3,3,0, 3,3,0, 1,2,0, 1,1,0, 1,1,0, 1,2,0, 2,2,0, 1,2,0, 3,4,0,
+2,3,0, 2,4,0, 3,5,0, 4,6,0, 5,7,0, 6,8,0, 6,7,0, 5,7,0, 3,4,0, 2,1,0,
+2,2,0, 2,2,0, 2,2,0, 1,1,0, 2,1,0, 2,2,0, 15,7,1, 93,40,12, 142,53,13,
+235,75,13, 168,57,9, 97,32,5, 120,39,5, 152,51,7, 116,43,5, 124,44,5,
+189,62,11, 135,47,6, 197,62,10, 152,52,8, 64,28,2, 11,13,0, 8,11,0,
+161,49,7, 218,67,11, 180,57,8, 149,47,6, 122,42,5, 86,36,4, 54,28,2,
+35,20,1, 11,12,0, 12,9,0, 6,8,0, 6,8,0, 6,7,0, 4,5,0, 5,5,0, 14,14,3,
+16,15,4, 7,8,1, 6,6,0, 8,8,1, 11,11,3, 13,13,3, 18,15,4, 19,16,4,
+17,16,4, 20,19,6, 21,19,8, 24,24,12, 20,21,10, 27,27,15, 27,29,13,
+23,23,5, 28,28,6, 29,26,5, 38,36,11, 43,38,24, 45,39,24, 48,39,23,
+81,61,39, 118,87,58, 148,109,75, 175,133,101, 102,63,35, 65,36,9,
+122,66,44, 142,82,64, 117,54,31, 116,61,45, 131,76,61, 103,47,33,
+91,32,15, 60,24,17, 74,26,15, 108,52,39, 93,28,9, 107,50,36, 105,41,22,
+112,56,45, 112,49,33, 118,63,52, 137,86,78, 140,102,94, 158,118,106,
+148,115,106, 142,111,102, 123,97,89, 134,103,94, 112,89,82, 88,73,68,
+110,96,90, 97,71,65, 59,30,21, 88,53,56, 124,85,95, 123,82,92,
+120,81,90, 95,55,57, 46,8,0, 43,8,0, 43,7,0, 41,8,2, 41,15,10, 38,7,0,
+32,6,0, 28,5,0, 31,6,0, 2,3,0, 3,3,0, 2,2,0, 2,2,0, 1,1,0, 1,1,0,
+1,1,0, 1,2,0, 2,3,0, 2,4,0, 3,4,0, 3,5,1, 3,5,1, 4,6,0, 5,6,0, 5,7,0,
+5,6,0, 4,6,0, 2,2,0, 1,1,0, 1,2,0, 2,2,0, 2,2,0, 2,2,0, 1,1,0, 2,2,0,
+17,9,1, 92,39,11, 211,67,12, 206,69,11, 122,42,6, 97,32,3, 206,67,10,
+102,40,4, 88,35,3, 141,48,7, 181,60,10, 209,64,11, 177,58,9, 92,35,3,
+13,14,0, 11,11,0, 191,58,9, 215,66,10, 174,55,7, 143,47,6, 97,37,4,
+61,26,2, 27,13,0, 10,8,0, 5,7,0, 16,10,0, 16,10,0, 7,8,0, 6,7,0, 8,7,0,
+8,7,0, 6,6,0, 5,6,0, 6,8,1, 8,8,1, 11,10,2, 15,13,4, 17,16,5, 20,18,8,
+21,19,9, 21,20,9, 23,22,11, 21,22,12, 23,23,13, 21,20,11, 28,29,17,
+30,31,20, 39,41,23, 38,36,13, 52,46,19, 90,82,50, 90,78,54, 58,55,36,
+51,42,26, 57,47,30, 66,51,33, 116,82,49, 144,101,73, 133,87,61, 56,29,6,
+125,67,36, 159,102,86, 120,57,35, 118,57,36, 128,73,59, 100,44,29,
+93,33,18, 82,34,24, 54,23,17, 108,57,47, 85,36,25, 101,49,35, 102,48,34,
+118,53,36, 105,46,30, 118,63,53, 123,85,78, 143,107,97, 158,121,109,
+151,118,107, 146,113,103, 144,110,99, 109,84,78, 121,96,87, 102,87,81,
+108,102,96, 102,85,78, 71,36,27, 118,81,92, 122,82,92, 120,81,91,
+103,63,67, 51,12,5, 44,8,0, 42,7,0, 41,7,0, 41,13,8, 40,12,6, 34,6,0,
+29,5,0, 23,6,0, 23,8,4, 2,4,0, 2,3,0, 3,3,0, 2,3,0, 1,2,0, 1,1,0, 1,1,0,
+1,2,0, 3,3,0, 2,4,0, 2,4,0, 2,4,0, 2,4,0, 3,4,0, 3,5,0, 4,5,0, 5,6,1,
+4,5,1, 2,2,0, 2,2,0, 2,2,0, 3,3,0, 2,2,0, 2,2,0, 1,1,0, 2,2,0, 2,2,0,
+19,9,2, 133,47,11, 229,71,13, 158,54,8, 72,26,2, 214,68,11, 146,51,7,
+83,34,3, 87,34,3, 179,59,10, 202,63,10, 206,66,11, 121,42,5, 19,15,0,
+17,12,0, 213,64,10, 209,63,10, 157,52,7, 113,41,4, 61,24,2, 19,11,0,
+12,9,0, 14,9,0, 9,9,0, 13,10,0, 32,13,1, 27,13,0, 12,9,0, 8,7,0, 8,6,0,
+6,6,1, 5,7,0, 7,8,0, 8,9,1, 10,11,3, 12,13,4, 12,13,4, 14,15,5, 14,15,5,
+22,22,11, 24,23,12, 22,23,12, 24,24,13, 35,33,18, 68,65,40, 86,77,49,
+98,88,60, 112,97,68, 132,117,87, 163,150,119, 169,155,123, 99,80,56,
+54,44,27, 70,63,41, 61,47,28, 83,66,41, 114,71,44, 142,95,70, 61,27,5,
+122,66,34, 166,110,88, 133,70,50, 113,52,32, 130,70,55, 104,49,35,
+99,41,26, 101,41,25, 89,37,25, 114,47,30, 102,47,34, 101,37,18, 95,48,36,
+97,47,34, 103,48,34, 133,76,67, 130,93,84, 144,110,99, 141,112,102,
+157,123,110, 145,114,103, 146,112,100, 133,101,92, 135,103,93, 111,92,84,
+102,96,91, 96,77,71, 88,55,56, 123,83,94, 120,80,90, 109,69,76, 55,16,9,
+45,8,0, 43,8,0, 42,7,0, 40,11,6, 39,10,4, 37,10,4, 31,6,0, 26,5,0,
+18,5,0, 22,13,11, 3,2,0, 3,3,0, 2,4,0, 2,4,0, 2,3,0, 2,2,0, 1,2,0,
+1,2,0, 2,3,0, 2,4,0, 2,4,0, 2,3,0, 2,4,0, 2,3,0, 3,3,0, 3,4,0, 3,3,0,
+2,3,0, 2,2,0, 2,2,0, 1,1,0, 1,2,0, 3,4,0, 2,2,0, 2,2,0, 1,2,0, 2,2,0,
+2,2,0, 21,10,2, 200,60,10, 195,64,10, 95,33,4, 149,49,7, 202,67,11,
+113,42,5, 89,35,3, 150,51,7, 191,61,10, 225,69,12, 140,47,6, 26,16,0,
+26,14,0, 225,67,11, 188,59,9, 126,45,6, 62,25,3, 37,16,2, 29,14,1,
+18,9,0, 12,7,0, 9,7,0, 12,9,0, 32,12,0, 40,15,0, 28,12,0, 10,8,0,
+10,7,0, 16,9,0, 20,10,0, 17,9,0, 11,9,1, 10,10,1, 10,11,2, 10,10,0,
+10,10,0, 11,11,1, 18,16,4, 37,32,14, 52,45,24, 64,54,28, 85,73,42,
+122,112,74, 138,126,85, 136,123,84, 114,99,68, 120,103,72, 136,120,90,
+174,162,129, 155,138,109, 133,110,82, 84,63,40, 92,79,47, 78,63,39,
+83,52,22, 134,89,66, 79,35,12, 119,64,35, 172,117,94, 143,84,68,
+113,53,34, 122,63,47, 109,52,37, 107,45,28, 112,46,29, 112,53,40,
+116,52,36, 116,59,47, 102,47,32, 120,58,44, 102,47,34, 95,53,45,
+131,84,76, 141,101,89, 152,116,104, 136,110,99, 143,115,104, 147,118,107,
+146,115,102, 133,102,90, 133,101,90, 114,90,82, 91,81,77, 86,62,57,
+111,73,80, 120,80,90, 114,75,83, 59,20,14, 45,13,8, 43,7,0, 42,7,0,
+41,9,2, 39,11,6, 37,10,5, 33,7,1, 27,5,0, 21,5,0, 17,6,0, 21,13,11,
+3,2,0, 2,3,0, 2,4,0, 2,4,0, 2,4,0, 2,3,0, 2,2,0, 1,2,0, 2,3,0, 2,4,0,
+2,4,0, 2,3,0, 2,3,0, 2,2,0, 1,3,0, 1,2,0, 2,2,0, 2,2,0, 2,2,0, 1,2,0,
+1,1,0, 1,1,0, 3,4,0, 3,5,0, 2,3,0, 2,2,0, 2,2,0, 2,2,0, 2,2,0, 84,24,3,
+223,66,11, 151,50,7, 77,28,2, 213,68,11, 146,51,7, 90,36,3, 120,43,5,
+194,63,11, 217,65,11, 170,56,8, 35,19,0, 32,15,1, 221,66,11, 150,50,7,
+79,30,6, 55,22,4, 44,17,2, 36,15,2, 33,14,1, 29,10,0, 25,10,0, 13,8,0,
+17,9,0, 33,13,0, 44,15,1, 32,13,0, 19,10,0, 13,8,0, 18,10,0, 26,13,0,
+18,13,0, 15,14,1, 15,14,1, 30,27,8, 48,41,13, 47,38,11, 25,21,6,
+60,50,22, 70,58,28, 74,60,29, 81,65,34, 115,98,59, 136,117,74,
+133,113,72, 102,80,47, 82,60,32, 96,71,43, 146,123,93, 161,138,108,
+164,144,113, 186,168,133, 148,122,86, 94,79,47, 73,57,32, 103,65,39,
+126,77,54, 117,61,37, 167,115,96, 152,94,81, 123,65,50, 120,63,48,
+114,56,41, 117,54,39, 123,56,40, 123,65,55, 121,62,51, 124,63,52,
+113,61,51, 125,64,52, 111,56,44, 121,71,61, 104,75,69, 150,106,94,
+150,115,102, 137,110,98, 153,122,107, 131,110,99, 150,123,109,
+136,105,93, 128,99,88, 105,82,74, 83,67,63, 93,59,57, 119,81,92,
+115,76,85, 66,26,22, 44,9,2, 44,11,6, 41,7,0, 41,7,0, 40,13,7, 37,7,0,
+35,12,7, 28,5,0, 23,6,1, 21,10,6, 20,13,11, 19,11,8, 4,3,0, 2,3,0, 3,4,0,
+2,4,0, 2,4,0, 2,4,0, 1,3,0, 2,3,0, 1,4,0, 2,4,0, 2,4,0, 2,4,0, 2,3,0,
+1,2,0, 2,2,0, 1,2,0, 2,2,0, 1,1,0, 2,2,0, 2,2,0, 1,2,0, 2,1,0, 2,3,0,
+4,5,0, 3,4,0, 3,3,0, 2,2,0, 2,2,0, 2,2,0, 11,4,0, 181,51,8, 187,58,9,
+102,34,3, 156,50,7, 190,63,10, 93,36,4, 89,34,3, 172,57,9, 205,64,10,
+198,62,10, 59,25,1, 34,16,1, 198,62,10, 109,37,8, 56,22,4, 43,17,3,
+38,16,2, 33,15,2, 31,13,0, 22,9,0, 23,9,0, 17,9,0, 15,9,0, 18,9,0,
+36,14,0, 40,17,2, 29,15,0, 38,18,0, 23,20,3, 38,31,8, 19,17,2, 22,18,2,
+31,28,7, 69,56,17, 113,94,35, 137,118,55, 25,20,5, 49,38,14, 96,76,38,
+179,147,90, 61,45,17, 86,67,33, 105,82,42, 144,117,75, 135,109,71,
+39,26,10, 39,22,5, 101,69,40, 138,104,70, 153,125,87, 183,163,121,
+193,171,130, 184,154,112, 113,94,65, 75,49,26, 113,68,46, 115,65,40,
+175,122,101, 162,104,91, 143,80,64, 120,64,51, 118,58,45, 118,58,45,
+127,66,55, 134,76,68, 126,71,63, 123,65,53, 124,71,62, 112,64,57,
+112,62,55, 129,84,75, 103,75,70, 132,97,87, 153,118,104, 138,109,98,
+157,124,108, 139,116,102, 129,108,97, 139,110,98, 122,94,84, 113,84,74,
+94,68,61, 88,57,62, 94,55,58, 67,29,25, 44,10,3, 42,7,0, 42,11,6,
+40,7,0, 41,11,5, 38,9,2, 34,7,1, 32,15,12, 29,14,12, 22,11,7, 19,9,5,
+21,14,11, 18,11,7, 9,4,0, 4,3,0, 3,4,0, 2,4,0, 2,5,0, 2,3,0, 2,3,0,
+1,3,0, 2,3,0, 2,4,0, 2,4,0, 2,3,0, 2,3,0, 2,2,0, 1,2,0, 1,1,0, 1,2,0,
+2,2,0, 1,1,0, 2,2,0, 2,2,0, 1,1,0, 2,2,0, 2,4,0, 5,6,0, 4,5,0, 3,4,0,
+2,3,0, 2,3,0, 2,3,0, 101,29,4, 193,56,9, 150,47,6, 82,28,2, 214,67,11,
+131,47,6, 59,27,1, 123,43,5, 208,65,11, 210,64,10, 80,30,2, 40,19,1,
+144,49,10, 70,25,5, 51,19,4, 42,16,2, 33,15,2, 25,12,1, 25,12,0, 23,9,0,
+27,10,0, 18,10,0, 15,11,0, 72,27,3, 29,16,0, 14,16,2, 39,20,2, 57,23,1,
+31,26,5, 55,45,15, 32,25,6, 27,20,3, 56,47,12, 105,89,31, 156,136,69,
+211,191,116, 59,49,22, 59,43,16, 150,120,69, 239,215,130, 150,127,69,
+31,20,4, 100,71,36, 199,168,118, 241,213,159, 140,108,73, 32,15,0,
+52,25,5, 141,102,65, 115,79,43, 145,107,66, 165,129,86, 180,146,102,
+169,140,102, 66,54,33, 100,54,32, 129,78,55, 176,125,106, 168,115,101,
+156,97,83, 129,70,58, 126,72,64, 124,73,67, 126,78,72, 127,81,76,
+117,69,63, 123,68,59, 133,76,65, 110,64,58, 124,71,62, 145,98,88,
+115,85,78, 136,100,90, 124,100,90, 137,110,97, 155,123,107, 134,110,98,
+147,118,103, 117,94,85, 111,87,77, 104,75,66, 78,46,39, 49,13,4, 46,13,5,
+45,14,7, 40,7,0, 40,6,0, 41,11,6, 40,9,1, 40,12,6, 35,7,0, 33,12,9,
+27,8,3, 21,5,0, 16,5,0, 19,11,8, 16,7,4, 13,5,0, 14,6,0, 9,5,0, 5,4,0,
+3,4,0, 2,5,0, 2,4,0, 1,3,0, 2,3,0, 1,2,0, 2,3,0, 2,4,0, 2,4,0, 1,3,0,
+1,2,0, 1,2,0, 1,1,0, 1,1,0, 1,1,0, 1,1,0, 1,2,0, 2,2,0, 2,2,0, 1,1,0,
+2,3,0, 5,6,0, 6,7,0, 4,6,0, 3,4,0, 1,2,1, 3,3,1, 33,11,1, 184,52,8,
+167,50,7, 114,36,4, 134,42,6, 186,61,10, 76,32,2, 60,27,1, 192,61,10,
+223,68,11, 118,40,4, 54,24,1, 96,34,7, 61,22,4, 44,18,3, 36,15,2,
+32,14,2, 34,15,1, 37,18,2, 74,28,3, 43,19,0, 8,11,0, 45,19,1,
+33,21,2, 45,21,1, 8,12,0, 56,23,1, 58,27,2, 43,34,7, 73,58,22,
+85,62,24, 39,28,4, 78,63,18, 127,109,48, 179,162,91, 242,234,158,
+123,107,58, 66,47,19, 171,139,77, 242,224,131, 243,235,157, 99,69,36,
+118,87,49, 221,194,132, 245,221,160, 207,168,121, 67,33,11, 142,101,65,
+235,208,164, 176,143,108, 75,47,23, 110,68,32, 146,102,60, 152,113,76,
+136,105,76, 106,70,52, 161,122,104, 179,143,124, 176,134,120, 160,107,96,
+137,80,71, 151,100,91, 147,96,89, 146,97,90, 151,100,92, 136,83,74,
+114,72,67, 125,75,67, 129,78,71, 133,83,75, 144,100,90, 121,92,85,
+152,111,99, 135,105,93, 102,82,73, 156,122,106, 130,105,94, 150,119,103,
+136,105,91, 102,79,70, 95,65,57, 61,26,16, 57,19,7, 45,15,9, 39,8,0,
+38,7,0, 39,6,0, 40,11,6, 40,14,8, 37,8,0, 33,9,3, 29,11,7, 23,5,0,
+17,5,0, 16,6,2, 20,13,10, 13,5,0, 13,5,0, 24,10,1, 15,7,0, 10,6,0,
+4,5,0, 2,4,0, 2,4,0, 2,3,0, 2,3,0, 2,3,0, 2,3,0, 2,4,0, 2,3,0, 2,3,0,
+2,2,0, 1,2,0, 1,1,0, 1,1,0, 1,1,0, 1,1,0, 1,2,0, 2,3,0, 2,2,0, 2,2,0,
+2,2,0, 3,4,0, 5,6,0, 5,7,0, 4,5,0, 2,3,1, 2,3,0, 8,5,0, 195,58,10,
+172,52,8, 128,40,6, 84,28,2, 219,68,11, 112,41,5, 36,22,0, 128,44,5,
+228,71,12, 175,55,9, 74,28,3, 83,28,6, 59,22,4, 39,17,2, 39,17,2,
+49,19,1, 49,21,2, 35,21,2, 24,21,3, 47,22,1, 16,12,0, 94,32,2, 27,23,2,
+33,25,4, 29,24,3, 75,31,1, 53,30,3, 59,48,12, 99,78,28, 131,101,48,
+47,34,6, 91,75,26, 144,126,65, 202,187,112, 249,246,176, 150,140,81,
+71,47,18, 189,151,79, 240,214,133, 243,234,169, 203,182,123, 125,98,57,
+235,217,152, 244,229,154, 239,205,148, 155,108,68, 206,174,130,
+238,221,173, 223,199,156, 210,181,145, 156,121,89, 98,52,19, 99,56,23,
+160,121,85, 155,126,108, 180,162,148, 193,165,143, 199,160,143,
+165,119,108, 141,91,82, 167,126,116, 162,121,112, 158,118,109,
+154,112,104, 149,101,91, 147,92,82, 113,75,69, 119,80,72, 134,91,82,
+138,101,92, 134,101,91, 148,111,99, 149,115,102, 127,101,90, 127,102,91,
+134,109,97, 146,116,101, 135,103,89, 97,74,66, 80,50,41, 62,24,13,
+45,16,11, 40,7,2, 38,5,0, 37,7,0, 36,8,0, 40,15,10, 38,10,3, 31,6,0,
+30,14,10, 24,6,0, 19,5,0, 14,4,0, 19,12,10, 14,6,2, 13,5,0, 11,4,0,
+41,17,4, 19,9,1, 18,8,0, 10,6,0, 4,4,0, 2,4,0, 2,3,0, 2,3,0, 1,2,0,
+2,2,0, 2,3,0, 2,3,0, 2,3,0, 1,2,0, 1,2,0, 1,2,0, 1,2,0, 1,1,0, 1,1,0,
+1,1,0, 2,2,0, 2,3,0, 2,3,0, 2,2,0, 3,4,0, 5,6,0, 5,7,0, 4,6,0, 2,3,1,
+2,3,1, 8,4,0, 188,56,9, 215,67,12, 152,48,7, 106,33,5, 172,52,8,
+176,59,9, 55,26,1, 92,35,3, 210,66,12, 192,60,10, 106,36,3, 78,25,4,
+62,24,4, 47,20,2, 61,24,2, 89,31,3, 69,27,3, 26,21,1, 27,27,4, 39,31,6,
+52,22,1, 130,42,3, 35,24,2, 32,27,5, 38,33,7, 84,35,3, 52,34,5, 79,65,18,
+122,100,39, 146,114,56, 59,41,11, 112,95,38, 169,149,68, 218,195,91,
+248,237,127, 155,146,73, 89,60,28, 216,170,106, 245,213,148, 244,223,159,
+216,195,132, 129,102,58, 232,211,152, 239,229,163, 238,222,148,
+184,153,105, 206,183,143, 234,232,200, 228,216,170, 215,185,143,
+210,189,155, 163,128,101, 155,119,93, 123,81,51, 174,154,141,
+173,159,148, 182,159,141, 201,171,153, 183,138,124, 147,104,97,
+162,134,124, 164,142,129, 154,125,116, 157,118,111, 154,110,100,
+156,102,90, 134,91,82, 148,98,85, 116,84,77, 112,85,78, 147,111,100,
+141,109,98, 149,116,103, 135,109,97, 153,122,107, 108,89,80, 132,106,93,
+132,104,90, 94,70,62, 67,35,27, 50,16,7, 43,12,7, 38,6,1, 36,5,0, 35,5,0,
+36,8,3, 38,13,9, 34,6,0, 29,11,7, 26,7,3, 21,5,0, 16,4,0, 15,6,3,
+17,10,8, 12,4,0, 11,4,0, 10,4,0, 53,21,4, 35,14,3, 23,10,2, 15,8,1,
+9,5,0, 5,4,0, 2,3,0, 2,3,0, 2,3,0, 1,3,0, 2,3,0, 2,3,0, 2,2,0, 1,2,0,
+2,2,0, 1,1,0, 1,1,0, 1,1,0, 2,2,0, 1,1,0, 1,1,0, 1,2,0, 2,3,0, 2,3,0,
+2,4,0, 4,5,0, 4,6,0, 3,5,0, 2,3,0, 2,4,0, 8,4,0, 174,52,9, 215,66,11,
+207,66,11, 142,43,6, 113,35,5, 227,70,12, 92,35,3, 33,20,0, 215,67,12,
+141,48,6, 146,47,6, 84,26,4, 56,21,2, 54,22,2, 48,21,1, 66,26,2, 86,33,3,
+23,24,2, 32,30,4, 39,32,7, 25,14,0, 55,20,1, 42,18,1, 53,26,3, 44,28,4,
+87,35,2, 57,38,6, 90,75,22, 130,104,40, 175,124,61, 72,55,14, 124,109,37,
+164,139,42, 195,165,51, 213,192,84, 140,127,65, 115,91,46, 217,191,122,
+233,215,144, 238,221,152, 201,177,117, 116,90,50, 230,213,152,
+240,228,169, 239,221,152, 190,163,103, 181,158,120, 238,235,219,
+224,216,187, 206,181,138, 217,210,180, 209,186,154, 189,169,144,
+159,141,131, 172,157,147, 173,146,131, 190,166,147, 185,162,147,
+185,146,132, 161,123,113, 187,168,154, 194,186,167, 169,143,132,
+140,110,103, 151,111,102, 160,111,99, 137,98,88, 154,106,92, 137,99,90,
+133,101,92, 124,98,89, 122,95,86, 152,117,105, 137,111,99, 155,125,107,
+138,113,96, 109,89,78, 133,104,90, 82,60,53, 58,20,8, 43,8,0, 41,11,6,
+37,6,1, 35,5,0, 34,6,1, 38,14,9, 37,11,7, 30,7,2, 26,11,8, 21,5,0,
+17,4,0, 13,4,0, 19,12,11, 12,4,0, 11,4,0, 11,4,0, 10,4,0, 87,32,4,
+49,20,4, 30,13,2, 19,9,1, 13,7,0, 9,5,0, 4,4,0, 2,3,0, 2,3,0, 1,3,0,
+2,2,0, 1,2,0, 1,2,0, 1,2,0, 1,2,0, 1,1,0, 2,1,0, 2,1,0, 2,1,0, 2,1,0,
+1,1,0, 1,1,0, 2,3,0, 2,4,0, 3,4,0, 3,5,0, 3,5,0, 3,5,0, 3,4,0, 2,3,0,
+7,4,0, 173,52,8, 198,59,10, 212,67,12, 175,54,8, 124,37,6, 189,58,11,
+165,54,8, 27,19,0, 165,55,9, 111,42,5, 169,54,7, 92,30,5, 86,30,4,
+62,24,2, 102,35,3, 61,27,2, 91,36,3, 23,24,2, 31,30,4, 37,29,6,
+12,9,0, 11,9,0, 11,8,0, 10,8,0, 28,13,1, 97,37,1, 62,43,8, 80,70,23,
+92,83,29, 105,91,34, 62,55,13, 69,64,21, 80,73,35, 71,61,34, 49,39,19,
+27,20,8, 129,111,57, 189,173,102, 209,195,121, 175,159,101, 168,149,89,
+62,44,15, 167,148,97, 235,219,159, 237,216,154, 177,143,82, 102,65,28,
+181,158,123, 220,209,179, 185,158,116, 200,189,166, 183,173,159,
+179,169,158, 166,149,136, 148,110,97, 166,132,113, 185,160,141,
+180,156,142, 181,148,134, 161,128,119, 189,176,160, 194,188,169,
+176,151,139, 165,130,120, 138,105,98, 140,103,94, 148,107,97,
+158,114,100, 138,103,93, 140,108,98, 162,125,112, 122,99,90, 118,96,86,
+134,108,95, 153,123,104, 134,109,93, 131,103,87, 118,92,80, 79,54,47,
+46,11,1, 39,6,0, 41,11,6, 36,6,1, 35,5,0, 36,13,9, 36,8,1, 33,11,7,
+28,12,10, 19,5,0, 14,3,0, 13,3,0, 15,7,5, 15,8,5, 10,3,0, 10,4,0, 10,4,0,
+9,3,0, 133,49,4, 87,34,4, 39,16,3, 21,10,2, 16,7,0, 12,7,1, 7,4,0, 3,3,0,
+1,3,0, 1,3,0, 1,3,0, 2,3,0, 2,3,0, 2,2,0, 1,2,0, 1,2,0, 1,1,0, 1,1,0,
+1,1,0, 1,1,0, 1,1,0, 1,1,0, 2,2,0, 2,3,0, 3,4,0, 3,4,1, 3,5,1, 2,4,1,
+3,5,1, 2,4,0, 6,4,0, 177,55,10, 179,52,9, 177,56,9, 160,49,8, 157,46,6,
+141,42,9, 213,67,12, 56,26,1, 105,39,5, 161,54,8, 140,46,6, 97,32,4,
+118,39,4, 76,27,2, 119,40,4, 80,33,3, 117,44,4, 24,24,2, 31,30,5,
+33,28,4, 12,8,0, 16,11,0, 43,37,12, 37,31,12, 47,23,5, 79,38,2, 62,54,15,
+86,80,34, 124,117,61, 131,110,72, 129,114,48, 180,171,94, 217,209,129,
+246,243,174, 242,238,163, 171,159,88, 120,105,54, 222,213,142,
+238,235,193, 207,196,131, 111,87,45, 86,47,13, 134,105,49, 207,190,131,
+166,137,86, 94,53,20, 136,91,49, 132,93,63, 184,166,138, 174,161,147,
+167,159,149, 169,156,143, 164,146,130, 157,130,107, 151,111,95,
+177,140,120, 203,173,150, 173,147,135, 182,150,136, 160,135,127,
+167,152,141, 169,158,145, 164,143,132, 162,129,119, 161,120,110,
+140,106,97, 125,96,89, 145,109,98, 136,104,94, 145,113,102, 160,127,112,
+138,112,101, 144,118,104, 119,96,85, 133,105,92, 130,105,92, 125,98,83,
+131,100,83, 68,45,37, 41,8,0, 39,6,0, 40,11,6, 38,8,4, 37,12,8, 34,7,1,
+34,6,0, 32,14,11, 24,8,4, 19,4,0, 13,3,0, 13,3,0, 18,12,11, 11,3,0,
+10,3,0, 10,3,0, 9,3,0, 8,4,0, 138,51,4, 97,37,3, 47,19,2, 31,12,2,
+17,7,1, 9,5,0, 9,4,0, 3,3,0, 3,3,0, 2,3,0, 1,3,0, 1,2,0, 1,2,0, 1,2,0,
+1,2,0, 1,1,0, 1,1,0, 1,1,0, 2,2,0, 1,1,0, 1,2,0, 2,1,0, 2,2,0, 2,3,0,
+2,4,0, 3,4,0, 3,4,1, 2,4,1, 2,4,1, 2,3,0, 6,5,0, 161,50,9, 140,43,7,
+134,41,7, 150,43,7, 149,44,7, 152,45,9, 224,68,13, 101,36,4, 66,28,2,
+176,57,8, 63,28,3, 29,16,3, 96,34,3, 128,42,5, 133,41,4, 84,36,3,
+124,47,4, 21,25,1, 29,29,4, 32,26,5, 16,9,0, 65,30,3, 89,82,33,
+142,130,66, 160,117,49, 89,42,4, 83,73,27, 128,120,59, 170,160,90,
+187,174,113, 97,77,33, 163,151,85, 198,185,115, 235,222,147, 246,228,137,
+205,181,91, 86,73,36, 219,206,136, 245,240,183, 245,239,172, 169,154,98,
+145,115,53, 236,224,128, 215,199,134, 165,123,92, 169,120,94,
+190,160,134, 187,176,157, 177,172,158, 168,156,145, 151,131,122,
+144,119,106, 160,134,116, 165,145,119, 181,157,135, 188,158,136,
+194,162,140, 182,153,140, 159,134,123, 167,144,134, 179,161,149,
+183,165,150, 166,141,131, 148,120,110, 159,119,108, 148,113,103,
+155,119,109, 143,112,102, 110,88,81, 130,102,93, 161,126,112,
+144,116,103, 143,117,104, 141,111,95, 131,103,89, 106,86,77, 121,96,82,
+121,90,74, 61,37,30, 39,8,3, 38,6,0, 38,10,4, 38,14,10, 33,6,2, 34,7,0,
+33,9,3, 29,14,13, 19,4,1, 14,3,0, 13,3,0, 16,9,8, 14,6,3, 12,3,0, 11,3,0,
+9,4,0, 8,4,0, 8,4,0, 97,38,4, 77,31,2, 60,24,2, 38,14,2, 27,9,1, 14,6,0,
+7,4,0, 6,4,0, 3,3,0, 6,4,0, 2,2,0, 1,2,0, 1,2,0, 1,2,0, 1,2,0, 1,2,0,
+1,2,0, 1,1,0, 1,2,0, 1,2,0, 1,2,0, 1,2,0, 2,3,0, 2,3,0, 2,3,0, 2,3,0,
+2,3,0, 2,3,0, 2,3,0, 2,3,0, 6,2,0, 160,48,8, 185,53,10, 183,55,9,
+195,57,8, 189,57,9, 181,55,9, 205,62,12, 138,45,6, 67,27,2, 186,59,9,
+30,16,3, 11,12,3, 22,13,3, 144,46,5, 151,48,5, 72,35,2, 68,38,4,
+62,33,3, 46,25,1, 27,16,1, 81,30,3, 76,34,3, 90,83,34, 149,138,72,
+173,137,68, 70,28,0, 61,51,16, 112,103,50, 159,146,83, 185,161,96,
+66,49,19, 143,125,69, 178,156,93, 211,190,114, 231,205,106, 206,180,87,
+68,48,21, 178,154,101, 203,174,121, 204,168,114, 192,148,99, 188,136,93,
+211,171,123, 204,170,130, 205,185,153, 188,183,164, 184,184,165,
+180,173,156, 183,172,155, 164,140,128, 153,127,117, 140,105,88,
+155,116,98, 165,143,123, 184,169,148, 195,178,155, 174,147,131,
+187,155,140, 167,138,128, 161,138,129, 163,145,134, 169,147,136,
+173,144,132, 159,126,114, 140,108,99, 147,113,104, 154,121,111,
+155,121,110, 131,104,95, 132,105,95, 129,104,94, 128,106,94, 134,111,98,
+137,108,93, 138,106,89, 118,94,81, 105,82,71, 111,81,68, 50,22,14,
+38,9,4, 37,6,0, 37,10,5, 33,10,6, 29,5,0, 31,7,2, 30,12,10, 27,7,2,
+24,12,11, 15,5,2, 13,4,2, 17,10,9, 9,2,0, 9,3,0, 9,3,0, 9,3,0, 8,3,0,
+8,4,0, 81,33,4, 76,30,3, 72,29,3, 68,27,7, 34,12,2, 20,7,0, 13,4,0,
+4,2,0, 3,2,0, 3,3,0, 4,3,0, 1,2,0, 1,1,0, 1,1,0, 1,1,0, 1,2,0, 1,2,0,
+2,2,0, 2,2,0, 1,2,0, 3,3,0, 2,3,0, 2,3,0, 1,2,0, 2,2,0, 2,2,0, 1,2,0,
+1,2,0, 1,1,0, 2,2,0, 6,2,0, 159,48,8, 204,58,10, 209,62,10, 208,61,10,
+210,65,11, 158,49,7, 211,63,12, 163,52,8, 84,31,3, 171,55,9, 34,16,3,
+11,12,2, 16,12,2, 176,55,7, 159,56,6, 34,28,2, 32,32,5, 23,18,2,
+21,10,0, 83,33,3, 96,39,4, 74,34,2, 87,80,34, 140,127,67, 158,134,68,
+53,26,1, 39,32,5, 89,79,33, 138,125,65, 167,133,73, 52,37,13, 126,101,51,
+159,125,69, 176,134,75, 177,128,71, 176,122,73, 180,123,82, 184,133,94,
+197,148,108, 213,164,123, 198,157,121, 189,157,128, 202,180,148,
+207,191,157, 206,201,171, 197,197,171, 176,169,151, 178,163,143,
+167,153,139, 176,159,145, 166,139,114, 160,135,110, 158,126,105,
+161,133,114, 170,153,131, 175,158,136, 179,150,135, 172,138,124,
+168,131,121, 170,142,132, 169,149,138, 152,132,122, 161,132,121,
+163,128,115, 156,119,108, 115,92,85, 128,103,95, 137,109,101, 125,102,93,
+146,117,105, 159,126,111, 146,117,102, 94,79,70, 124,100,86, 133,102,86,
+121,96,83, 106,82,69, 80,56,46, 39,12,6, 38,11,6, 36,6,0, 38,11,6,
+34,12,8, 28,6,2, 30,13,11, 27,5,0, 23,5,0, 19,4,1, 20,11,10, 17,11,11,
+11,3,1, 9,2,0, 8,3,0, 8,3,0, 7,2,0, 7,2,0, 7,3,0, 81,33,4, 80,32,4,
+83,33,7, 85,34,12, 59,23,7, 25,8,0, 18,6,0, 10,3,0, 4,1,0, 2,2,0,
+3,2,0, 2,2,0, 2,2,0, 1,1,0, 2,1,0, 1,2,0, 1,2,0, 2,3,0, 1,2,0, 2,3,0,
+2,3,0, 2,4,0, 2,3,0, 2,3,0, 1,2,0, 1,1,0, 1,1,0, 1,1,0, 1,1,0, 1,1,0,
+6,2,0, 145,43,7, 210,63,10, 213,64,11, 201,63,10, 217,66,12, 124,41,5,
+209,62,12, 174,54,8, 94,34,4, 154,51,7, 70,26,4, 21,14,2, 11,12,3,
+121,42,6, 122,47,5, 27,27,3, 40,38,7, 18,12,0, 54,21,1, 63,29,2,
+89,39,5, 68,30,1, 79,68,27, 125,107,54, 153,123,60, 104,63,24, 116,76,36,
+137,96,49, 156,110,61, 180,129,80, 169,117,72, 157,108,66, 160,112,75,
+174,126,86, 193,144,100, 186,143,102, 188,149,114, 171,147,118,
+167,144,116, 188,165,138, 176,157,135, 170,161,139, 190,190,168,
+195,196,169, 190,188,162, 176,171,153, 162,152,142, 172,155,138,
+175,160,142, 169,151,130, 156,125,100, 167,145,119, 180,163,139,
+159,140,120, 152,127,108, 175,157,134, 185,160,141, 149,116,106,
+157,118,109, 153,128,119, 162,139,128, 173,145,133, 138,113,104,
+144,115,105, 144,111,101, 132,105,96, 143,115,104, 119,98,90, 113,95,88,
+144,117,106, 159,127,111, 152,122,105, 118,96,85, 112,90,78, 113,90,77,
+119,93,78, 103,75,63, 65,39,30, 39,9,3, 39,13,8, 37,9,4, 35,7,1, 32,11,8,
+29,13,10, 25,5,1, 24,5,0, 19,4,0, 17,3,0, 18,8,6, 17,11,12, 10,4,2,
+9,2,0, 8,2,0, 7,1,0, 6,2,0, 6,2,0, 6,1,0, 89,35,9, 89,36,11, 89,35,12,
+89,35,12, 84,33,11, 45,16,5, 20,6,0, 13,4,0, 8,2,0, 3,2,0, 3,2,0, 4,3,0,
+1,1,0, 1,1,0, 1,1,0, 1,1,0, 2,2,0, 1,2,0, 1,2,0, 2,3,0, 2,3,0, 2,4,0,
+4,4,0, 3,3,0, 1,1,0, 1,1,0, 0,1,0, 0,1,0, 1,1,0, 1,1,0, 5,2,0, 144,42,7,
+208,64,10, 213,64,11, 196,62,10, 204,61,10, 101,37,4, 198,59,10,
+194,59,9, 122,42,5, 165,55,8, 111,37,6, 61,24,4, 30,16,2, 20,16,3,
+37,23,5, 30,25,4, 45,37,9, 29,21,6, 88,35,6, 64,38,12, 102,58,23,
+107,64,33, 130,77,40, 160,95,50, 162,102,57, 179,122,74, 190,134,85,
+154,108,67, 144,105,68, 179,137,97, 128,96,64, 152,121,87, 108,89,64,
+150,129,102, 180,150,116, 192,162,128, 166,144,115, 175,156,128,
+165,161,140, 179,173,151, 173,174,157, 171,176,156, 171,175,153,
+176,175,153, 178,172,153, 172,165,153, 166,153,140, 171,150,131,
+169,147,126, 160,125,98, 164,133,106, 174,152,129, 172,152,130,
+166,153,130, 157,142,123, 152,131,112, 169,146,126, 159,122,110,
+167,123,112, 161,133,124, 147,124,115, 159,131,120, 153,123,112,
+133,106,97, 156,115,102, 146,113,104, 160,127,113, 154,124,111,
+117,98,89, 113,94,86, 149,119,104, 129,102,89, 102,83,73, 111,89,78,
+99,79,70, 95,71,59, 82,56,44, 52,24,16, 39,7,1, 36,13,9, 36,11,5,
+32,5,0, 29,12,9, 27,9,5, 22,5,0, 22,5,0, 18,4,0, 17,6,4, 18,9,8, 12,3,1,
+16,11,11, 8,2,0, 8,2,0, 7,1,0, 6,1,0, 6,1,0, 5,1,0, 90,36,12, 89,35,12,
+88,35,12, 89,35,12, 87,34,12, 77,30,10, 32,11,2, 15,5,0, 10,3,0, 6,2,0,
+3,2,0, 6,2,0, 4,3,0, 2,1,0, 2,2,0, 1,1,0, 1,1,0, 2,2,0, 1,2,0, 1,2,0,
+1,3,0, 2,3,0, 3,4,0, 4,3,0, 1,1,0, 0,1,0, 1,1,0, 0,0,0, 0,0,0, 1,1,0,
+5,2,0, 139,41,7, 202,61,10, 215,65,11, 199,63,10, 184,56,9, 85,32,2,
+183,55,10, 209,64,11, 148,49,7, 158,53,8, 144,46,7, 80,29,5, 66,26,4,
+59,28,7, 71,44,19, 89,62,35, 99,66,36, 95,58,31, 108,59,28, 102,56,27,
+92,57,29, 79,49,27, 90,65,38, 101,71,40, 117,89,55, 166,125,81,
+133,86,50, 112,89,60, 114,92,64, 162,135,99, 94,82,58, 120,121,103,
+108,114,98, 96,97,79, 153,156,138, 173,169,145, 178,175,150, 165,164,143,
+166,164,144, 166,172,153, 168,174,159, 173,174,160, 167,162,146,
+167,164,150, 168,157,144, 158,140,129, 159,135,119, 168,136,108,
+155,119,91, 154,116,90, 177,152,130, 183,164,140, 176,161,140,
+165,149,131, 156,141,121, 164,153,137, 145,122,104, 164,122,110,
+153,118,108, 148,122,114, 170,143,131, 144,119,110, 168,132,119,
+138,106,95, 127,96,87, 146,113,103, 158,125,112, 132,107,97, 147,119,108,
+122,101,92, 116,95,85, 103,85,74, 116,92,80, 121,91,77, 95,70,59,
+74,48,37, 51,34,30, 51,30,27, 38,10,6, 35,14,11, 34,7,2, 30,5,0,
+29,12,9, 27,13,11, 21,5,0, 19,4,0, 20,6,3, 19,10,10, 13,3,0, 11,2,0,
+10,3,2, 14,10,10, 8,2,0, 8,2,0, 6,1,0, 5,0,0, 6,0,0, 90,35,12, 90,34,12,
+88,34,12, 88,34,12, 88,35,12, 86,33,12, 67,26,9, 22,7,1, 12,3,0, 7,2,0,
+4,2,0, 2,1,0, 8,3,0, 4,2,0, 2,2,0, 1,1,0, 1,1,0, 1,1,0, 2,2,0, 1,2,0,
+2,3,0, 1,3,0, 3,3,0, 3,2,0, 1,1,0, 0,1,0, 0,0,0, 0,0,0, 1,0,0, 1,1,0,
+5,3,0, 147,43,7, 215,62,11, 223,68,12, 190,60,10, 170,53,8, 68,29,2,
+161,50,8, 225,69,12, 171,56,8, 169,56,8, 174,56,8, 108,36,6, 83,31,6,
+84,32,6, 74,33,8, 72,33,10, 60,34,14, 70,35,13, 68,33,12, 63,37,16,
+61,36,15, 57,45,25, 71,52,26, 86,66,35, 101,83,51, 141,115,79, 71,53,28,
+78,74,53, 103,92,66, 134,128,100, 87,86,63, 142,152,129, 145,157,134,
+119,122,99, 146,154,135, 158,174,157, 166,178,156, 158,171,154,
+142,144,128, 143,144,130, 141,138,125, 147,143,132, 142,135,125,
+147,136,125, 154,136,121, 149,123,104, 152,118,95, 145,105,79,
+153,113,88, 177,146,123, 198,181,154, 191,169,146, 183,164,144,
+159,138,120, 151,132,113, 150,131,114, 150,135,114, 142,108,99,
+141,112,104, 161,135,125, 161,134,123, 153,124,114, 155,121,110,
+146,101,89, 129,93,84, 126,100,91, 125,101,93, 130,105,95, 150,121,107,
+107,88,80, 118,95,84, 103,80,70, 83,63,54, 83,59,50, 74,44,31, 61,30,16,
+61,47,44, 55,33,28, 36,9,5, 32,15,13, 32,7,1, 29,6,1, 28,13,10, 24,7,4,
+21,9,6, 18,5,1, 22,12,11, 15,4,1, 12,3,0, 12,3,0, 9,2,0, 9,5,3, 13,9,8,
+7,2,0, 6,1,0, 5,0,0, 5,0,0, 88,34,12, 87,34,12, 88,34,12, 88,34,12,
+89,35,13, 89,34,12, 83,32,11, 54,20,6, 16,5,0, 9,3,0, 6,2,0, 3,1,0,
+6,3,0, 8,3,0, 3,1,0, 1,1,0, 1,1,0, 2,1,0, 1,2,0, 1,2,0, 1,2,0, 1,2,0,
+3,3,0, 3,2,0, 1,1,0, 0,1,0, 0,0,0, 0,1,0, 1,1,0, 1,1,0, 5,2,0, 141,40,7,
+209,60,10, 211,64,11, 180,56,9, 160,51,7, 68,30,2, 126,41,7, 231,71,13,
+182,58,9, 180,58,8, 159,51,7, 176,57,10, 77,28,5, 89,34,6, 88,34,6,
+71,32,7, 84,33,5, 69,30,6, 58,33,10, 74,35,9, 65,47,20, 58,47,23,
+64,42,16, 79,60,32, 76,66,41, 90,91,67, 57,54,33, 77,80,56, 103,104,77,
+132,139,110, 84,85,58, 126,134,107, 139,152,128, 133,144,123,
+129,137,121, 122,135,124, 132,141,128, 132,142,130, 127,129,118,
+117,111,99, 121,109,98, 132,123,113, 144,131,118, 148,126,108,
+153,126,104, 138,103,82, 138,100,80, 159,124,102, 174,142,117,
+194,172,145, 210,192,167, 189,163,140, 174,145,125, 181,154,131,
+164,139,119, 162,139,119, 145,119,102, 158,118,109, 180,142,131,
+151,124,115, 156,125,115, 169,130,117, 134,105,96, 147,99,87, 133,97,88,
+157,117,105, 154,121,107, 122,99,90, 135,109,98, 95,76,69, 131,98,83,
+115,82,69, 89,57,45, 67,37,25, 47,22,12, 47,26,18, 66,54,53, 57,38,34,
+34,5,0, 32,15,13, 33,12,8, 28,8,4, 25,9,6, 20,4,0, 21,11,9, 20,11,10,
+13,4,2, 13,3,0, 14,4,0, 13,3,0, 9,3,0, 8,2,0, 13,8,7, 11,6,5, 7,1,0,
+5,0,0, 10,6,7, 89,34,12, 89,34,12, 89,34,12, 88,34,11, 87,33,12,
+87,33,13, 86,33,12, 80,31,11, 39,14,3, 13,4,0, 7,2,0, 5,2,0, 4,2,0,
+11,5,0, 7,3,0, 3,1,0, 1,1,0, 1,1,0, 1,1,0, 1,2,0, 2,3,0, 3,3,0, 2,2,0,
+2,2,0, 2,2,0, 0,0,0, 0,0,0, 0,0,0, 0,0,0, 1,1,0, 5,2,0, 135,38,6,
+204,57,10, 212,64,10, 172,52,7, 151,47,6, 67,29,2, 101,34,5, 231,72,14,
+198,63,10, 168,55,8, 173,56,8, 176,56,9, 122,41,7, 67,24,4, 94,36,7,
+96,37,6, 103,39,7, 97,37,7, 68,30,5, 75,29,5, 60,36,13, 47,34,14,
+50,41,19, 57,54,31, 49,49,30, 68,74,52, 42,42,22, 58,60,37, 66,67,45,
+84,87,64, 81,84,61, 74,75,54, 98,103,86, 93,97,81, 96,99,86, 102,106,92,
+99,94,78, 108,103,87, 124,115,96, 131,121,101, 122,105,86, 128,106,85,
+122,94,73, 131,99,78, 129,95,73, 139,104,84, 156,124,104, 186,159,135,
+205,186,157, 199,180,156, 203,186,163, 181,155,136, 190,159,137,
+189,161,137, 160,131,112, 188,160,139, 169,135,117, 173,129,119,
+156,126,117, 152,123,114, 162,127,116, 154,116,105, 131,98,90,
+143,99,88, 125,93,85, 142,112,101, 146,116,103, 124,101,90, 113,90,80,
+115,87,76, 123,84,70, 93,58,46, 63,34,23, 38,19,13, 37,21,16, 62,39,36,
+66,55,53, 73,55,49, 31,5,0, 32,12,9, 31,11,8, 28,12,10, 24,7,4, 18,4,0,
+19,9,6, 17,10,8, 11,3,0, 12,3,0, 14,3,0, 12,3,0, 8,2,0, 9,2,0, 10,2,0,
+14,9,9, 9,3,3, 6,1,1, 12,9,10, 88,33,11, 88,34,11, 87,33,11, 88,34,12,
+87,33,12, 89,34,13, 88,33,12, 86,33,11, 75,29,10, 30,11,2, 12,4,0,
+5,3,0, 10,5,0, 10,5,0, 15,7,1, 8,3,0, 6,3,0, 3,1,0, 1,1,0, 1,2,0, 2,3,0,
+4,3,0, 1,2,0, 3,3,0, 2,1,0, 1,0,0, 0,0,0, 1,1,0, 0,0,0, 1,1,0, 4,1,0,
+128,37,6, 183,52,9, 203,61,10, 164,49,7, 146,45,6, 85,31,3, 81,29,4,
+225,71,13, 213,67,11, 168,55,8, 187,60,9, 169,53,8, 185,59,10, 80,29,4,
+75,26,5, 101,35,7, 114,38,8, 117,41,9, 112,41,8, 111,40,8, 82,32,6,
+64,28,5, 35,20,3, 21,18,5, 15,16,4, 32,33,18, 23,22,10, 35,34,18,
+46,44,29, 27,25,11, 53,53,36, 53,50,32, 58,53,36, 70,64,48, 78,71,52,
+86,78,60, 90,78,58, 95,78,56, 97,77,54, 104,80,53, 113,83,58, 106,76,51,
+112,81,58, 117,82,59, 136,101,78, 170,139,115, 198,176,150, 215,194,167,
+206,183,158, 196,178,155, 188,163,142, 178,156,137, 182,160,141,
+175,149,129, 167,145,127, 182,152,131, 155,118,104, 158,124,115,
+169,136,124, 174,137,124, 146,112,102, 138,103,93, 148,104,93,
+116,84,78, 123,94,86, 132,104,94, 123,99,89, 128,101,89, 130,96,82,
+107,75,64, 96,60,48, 52,29,21, 30,17,15, 29,16,11, 55,32,27, 69,53,53,
+72,61,58, 81,68,63, 32,12,6, 29,11,9, 31,13,9, 26,7,4, 24,12,10,
+17,4,0, 20,12,10, 17,10,8, 12,5,2, 12,4,0, 14,3,0, 10,3,0, 7,3,0,
+10,3,0, 10,3,0, 8,1,0, 14,9,10, 11,8,9, 5,2,2, 86,32,11, 88,33,11,
+88,33,12, 88,33,12, 86,32,11, 88,33,12, 87,33,11, 87,33,11, 85,33,11,
+66,26,9, 26,10,2, 13,6,0, 6,4,0, 11,6,0, 14,7,0, 14,7,0, 7,4,0, 7,4,0,
+5,3,0, 2,2,0, 2,3,0, 5,5,0, 2,3,0, 2,3,0, 2,2,0, 0,0,0, 0,0,0, 0,0,0,
+0,0,0, 0,0,0, 3,1,0, 114,35,5, 165,49,8, 191,57,9, 173,53,7, 141,44,5,
+110,34,4, 64,24,3, 217,68,13, 223,70,12, 176,57,9, 169,54,8, 180,57,9,
+177,55,8, 172,58,9, 84,32,4, 58,22,4, 92,32,6, 101,34,7, 105,37,8,
+104,39,8, 100,36,8, 94,35,7, 70,27,5, 47,18,2, 34,14,1, 7,8,1, 5,5,0,
+7,7,1, 14,13,3, 12,11,1, 16,14,3, 34,30,14, 52,46,27, 61,51,31,
+76,65,44, 93,80,54, 110,93,62, 115,95,64, 120,96,67, 131,105,77,
+142,114,85, 153,123,92, 169,140,106, 184,157,126, 196,167,137,
+196,166,138, 197,167,144, 206,177,154, 203,176,152, 190,160,138,
+190,163,142, 186,162,143, 194,175,156, 159,138,121, 156,134,116,
+143,115,98, 142,110,98, 182,141,128, 176,141,127, 165,128,115,
+121,92,85, 141,105,95, 138,96,86, 131,93,84, 115,92,85, 148,116,102,
+151,115,99, 128,95,82, 120,82,69, 76,49,41, 48,22,14, 28,10,3, 30,17,13,
+50,26,20, 66,51,49, 69,60,59, 72,63,61, 80,68,65, 46,28,23, 23,12,10,
+25,10,7, 26,7,3, 26,14,12, 21,11,10, 18,9,7, 13,5,1, 16,11,9, 11,3,0,
+14,3,0, 11,3,0, 8,4,0, 10,3,0, 8,2,0, 9,2,0, 10,6,6, 12,11,12, 3,0,0,
+86,32,11, 88,34,11, 88,33,12, 87,33,12, 88,33,13, 87,32,12, 87,33,12,
+87,32,12, 87,33,11, 83,32,11, 54,21,7, 24,10,2, 13,6,0, 9,5,0, 8,5,0,
+10,5,0, 9,5,0, 5,4,0, 4,3,0, 2,3,0, 1,3,0, 3,4,0, 3,2,0, 1,2,0, 2,2,0,
+0,0,0, 0,0,0, 0,0,0, 1,1,0, 1,1,0, 1,1,0, 81,25,4, 135,43,7, 160,47,8,
+160,48,8, 136,41,5, 127,38,4, 44,19,1, 208,65,12, 235,74,13, 185,59,10,
+161,51,8, 163,51,7, 182,56,9, 187,59,10, 147,51,7, 54,25,2, 49,21,2,
+89,32,5, 96,33,6, 83,31,6, 70,27,4, 60,24,3, 43,20,3, 27,15,2, 34,21,5,
+35,33,17, 32,28,13, 43,40,23, 44,41,22, 45,39,20, 59,52,29, 75,65,42,
+87,76,49, 103,88,59, 119,101,69, 137,120,82, 158,141,101, 161,138,102,
+145,121,88, 157,131,96, 180,154,113, 182,155,116, 187,158,123,
+184,154,123, 195,161,132, 190,154,130, 193,160,138, 206,175,153,
+200,169,147, 201,173,151, 195,171,152, 195,173,155, 188,164,146,
+177,155,137, 180,157,137, 161,135,116, 165,134,114, 183,148,133,
+155,124,113, 137,107,97, 141,106,96, 146,103,91, 130,87,78, 129,98,89,
+150,115,103, 149,112,97, 139,98,83, 109,76,66, 83,48,37, 46,21,12,
+31,15,10, 37,18,13, 49,29,25, 66,49,47, 70,61,60, 90,79,77, 79,71,69,
+75,66,65, 64,47,43, 25,11,9, 20,6,2, 26,10,7, 24,10,8, 20,10,9, 16,6,2,
+13,4,0, 16,10,7, 13,5,3, 12,3,0, 10,3,0, 9,3,0, 10,3,0, 9,2,0, 10,4,4,
+12,8,8, 8,4,4, 9,6,7, 86,31,11, 87,32,11, 86,32,12, 85,32,12, 86,32,13,
+86,31,12, 85,31,11, 86,32,11, 86,32,12, 85,32,11, 81,32,11, 46,18,5,
+19,9,0, 11,6,0, 7,5,0, 4,4,0, 4,4,0, 3,3,0, 2,3,0, 1,3,0, 2,3,0, 2,3,0,
+5,3,0, 1,1,0, 1,1,0, 0,0,0, 0,0,0, 0,0,0, 0,0,0, 0,0,0, 1,0,0, 50,15,2,
+173,52,9, 185,54,8, 171,50,7, 143,43,6, 127,39,5, 51,22,1, 193,60,10,
+245,77,14, 199,61,10, 169,52,8, 159,49,7, 174,54,8, 192,61,10,
+158,52,8, 79,31,3, 57,25,1, 28,20,2, 23,17,2, 25,17,3, 21,19,5,
+24,25,7, 45,44,20, 48,46,21, 59,56,28, 80,75,42, 89,82,48, 80,72,40,
+85,76,43, 72,62,33, 80,69,38, 71,58,30, 82,67,35, 89,71,38, 92,72,40,
+101,80,49, 110,87,58, 120,94,63, 140,111,77, 158,128,93, 170,139,107,
+175,142,113, 186,151,121, 205,171,139, 207,171,143, 195,157,135,
+205,170,148, 199,164,143, 205,175,153, 202,173,152, 195,168,148,
+185,157,140, 178,155,139, 165,141,126, 172,146,128, 179,148,128,
+165,135,116, 153,123,111, 165,129,116, 162,119,106, 143,103,93,
+123,85,77, 130,89,80, 151,113,101, 142,108,95, 141,101,86, 107,73,64,
+85,49,38, 50,15,4, 30,15,11, 48,24,18, 57,34,29, 64,47,45, 88,73,69,
+104,94,89, 96,88,84, 90,83,79, 69,64,62, 74,63,60, 27,12,9, 25,6,0,
+28,13,10, 24,10,7, 18,7,4, 18,10,7, 13,4,0, 12,5,0, 18,11,10, 9,3,0,
+10,3,0, 12,4,0, 9,2,0, 10,4,3, 12,8,9, 5,1,0, 4,0,0, 10,8,9, 85,31,11,
+86,32,12, 86,31,12, 86,32,12, 87,32,12, 86,32,12, 84,32,12, 84,31,11,
+87,33,11, 86,32,11, 83,32,11, 76,28,10, 36,15,3, 17,8,0, 9,5,0, 5,4,0,
+5,4,0, 4,4,0, 1,3,0, 2,3,0, 2,3,0, 3,4,0, 4,3,0, 2,1,0, 1,1,0, 1,1,0,
+0,0,0, 0,0,0, 0,0,0, 0,0,0, 1,1,0, 7,2,0, 166,48,9, 192,57,9, 185,55,8,
+164,49,7, 146,44,7, 97,34,4, 179,55,9, 251,78,15, 208,63,11, 176,55,8,
+169,53,8, 158,50,7, 175,55,9, 176,57,9, 105,37,5, 96,34,4, 60,27,2,
+22,19,1, 25,19,1, 20,20,2, 29,27,6, 42,39,14, 36,34,11, 43,40,13,
+65,58,26, 77,67,34, 58,50,21, 54,46,18, 53,44,17, 64,52,22, 72,58,27,
+97,81,46, 124,105,67, 134,113,77, 140,116,83, 145,119,90, 159,131,100,
+191,160,127, 209,177,146, 198,163,137, 198,164,135, 215,180,145,
+223,192,158, 214,177,146, 202,161,134, 197,157,133, 200,162,140,
+210,171,148, 201,164,142, 191,153,133, 197,164,146, 185,158,140,
+177,150,133, 181,149,129, 153,118,99, 137,105,92, 177,144,130,
+175,131,115, 155,110,98, 127,89,81, 123,82,73, 147,101,89, 148,112,99,
+132,97,85, 106,73,65, 103,57,41, 54,22,11, 37,18,14, 50,26,21, 66,40,33,
+85,60,53, 92,74,67, 111,97,88, 120,109,97, 98,92,84, 78,73,68, 98,90,82,
+80,73,68, 32,19,15, 24,5,0, 25,11,8, 24,9,6, 20,9,6, 19,11,9, 13,5,0,
+13,4,0, 14,8,6, 13,7,4, 13,3,0, 12,3,0, 10,3,2, 13,9,9, 6,1,0, 5,1,0,
+4,0,0, 3,0,0, 85,31,12, 85,31,11, 84,30,11, 86,31,11, 86,31,11,
+85,31,11, 86,31,11, 86,32,11, 85,31,11, 85,32,11, 83,31,10, 83,32,11,
+69,27,9, 29,12,2, 13,7,0, 6,5,0, 5,4,0, 5,4,0, 5,4,0, 3,3,0, 4,4,0,
+2,2,0, 3,3,0, 2,1,0, 1,0,0, 1,1,0, 0,0,0, 1,1,0, 0,0,0, 0,0,0, 1,0,0,
+1,0,0, 64,19,3, 204,58,10, 199,59,10, 185,56,8, 173,53,8, 155,48,7,
+171,52,8, 252,78,15, 214,63,11, 183,57,9, 173,53,8, 153,48,7, 149,47,7,
+155,51,7, 134,46,6, 153,49,7, 81,32,4, 74,29,3, 68,29,3, 60,27,2,
+54,28,3, 24,21,2, 41,22,0, 33,26,5, 49,42,15, 62,52,22, 65,54,24,
+78,63,31, 83,67,35, 110,92,56, 132,112,77, 176,155,117, 182,161,121,
+183,159,120, 172,144,111, 153,122,94, 151,117,89, 175,139,107,
+211,178,139, 213,178,146, 202,165,137, 204,166,137, 201,164,133,
+192,151,121, 185,139,113, 189,144,119, 192,148,124, 193,148,124,
+198,156,130, 213,179,150, 215,185,160, 213,187,167, 203,174,154,
+149,115,98, 129,91,72, 148,113,97, 180,149,134, 172,128,112, 133,96,87,
+134,90,79, 123,81,71, 150,107,94, 132,97,86, 110,74,65, 110,60,43,
+62,25,12, 42,21,16, 53,28,21, 66,39,32, 100,67,57, 119,90,77, 96,82,73,
+105,96,85, 105,96,84, 86,80,73, 95,90,82, 100,92,83, 86,81,72, 54,41,36,
+22,5,0, 22,7,2, 24,10,7, 22,11,8, 20,12,9, 14,6,1, 13,5,0, 13,3,0,
+17,11,10, 11,3,0, 11,4,2, 14,9,10, 6,1,0, 5,1,0, 4,0,0, 4,1,0, 3,1,0,
+85,31,11, 86,31,11, 85,31,12, 87,31,12, 86,31,12, 85,31,12, 86,32,12,
+86,31,11, 84,31,10, 83,31,10, 83,31,10, 84,31,11, 81,31,11, 57,22,7,
+25,11,2, 10,6,0, 4,4,0, 3,4,0, 4,4,0, 5,4,0, 13,6,1, 7,3,0, 2,2,0, 2,2,0,
+1,1,0, 1,0,0, 1,0,0, 0,0,0, 0,0,0, 1,1,0, 1,0,0, 1,0,0, 3,1,0, 112,32,5,
+196,55,9, 192,59,9, 179,55,8, 190,58,9, 168,47,7, 252,77,15, 222,65,12,
+192,57,9, 178,54,8, 167,52,8, 152,48,7, 117,41,5, 149,48,7, 176,57,9,
+123,42,5, 130,43,5, 96,33,4, 95,33,4, 51,22,1, 46,22,1, 65,26,1, 25,20,2,
+49,39,15, 83,66,35, 99,78,45, 107,84,50, 102,79,47, 101,78,49, 108,85,52,
+131,105,70, 130,104,70, 123,94,63, 119,88,61, 116,87,62, 141,111,84,
+173,137,107, 197,157,122, 198,154,126, 175,131,110, 166,126,103,
+170,132,105, 181,138,110, 189,142,116, 198,156,133, 211,169,148,
+220,179,155, 227,191,162, 219,188,161, 213,185,157, 204,175,150,
+179,144,124, 162,117,94, 152,106,79, 159,122,103, 170,139,123,
+147,111,100, 143,96,84, 140,87,76, 123,80,70, 133,96,86, 115,78,69,
+115,62,48, 70,30,17, 46,21,15, 59,28,18, 78,39,26, 81,55,48, 120,92,80,
+114,95,84, 104,92,81, 70,63,55, 129,117,98, 114,105,90, 97,91,82,
+104,97,85, 86,79,72, 73,65,59, 26,10,5, 21,5,0, 22,11,9, 22,12,8, 19,9,5,
+17,10,5, 13,5,0, 12,4,0, 16,7,4, 14,8,8, 14,9,9, 7,2,0, 6,1,0, 5,1,0,
+4,0,0, 4,0,0, 3,1,0, 86,30,10, 85,31,12, 85,31,12, 85,31,12, 85,31,12,
+83,30,12, 84,31,12, 84,31,11, 84,31,10, 85,31,10, 84,31,10, 83,31,10,
+82,31,10, 79,30,10, 48,19,5, 20,9,1, 8,5,0, 4,4,0, 3,3,0, 7,5,0, 7,4,0,
+11,5,0, 1,1,0, 0,0,0, 1,1,0, 1,1,0, 0,0,0, 0,0,0, 0,0,0, 1,0,0, 0,0,0,
+0,1,0, 1,1,0, 6,2,0, 99,28,4, 195,57,9, 182,57,8, 192,58,9, 188,52,8,
+248,73,13, 229,68,12, 200,60,10, 205,61,10, 193,57,9, 176,54,9, 98,35,5,
+109,38,5, 149,48,7, 151,47,7, 143,44,6, 115,37,4, 69,25,2, 55,23,2,
+55,26,3, 71,28,3, 74,33,7, 77,46,19, 78,59,31, 110,85,53, 143,112,77,
+156,125,87, 133,107,69, 115,89,56, 125,93,58, 144,108,73, 166,128,88,
+192,150,108, 204,162,122, 202,160,124, 197,154,121, 215,166,133,
+196,142,114, 183,134,110, 179,143,117, 190,159,129, 208,172,141,
+221,177,148, 220,174,150, 223,177,155, 231,192,163, 226,193,163,
+219,184,157, 217,180,152, 190,149,124, 162,118,90, 141,92,65, 162,117,92,
+176,143,123, 155,124,109, 157,112,99, 141,90,78, 135,81,70, 110,77,70,
+127,84,73, 111,64,52, 75,35,22, 47,22,17, 66,31,20, 84,38,22, 100,59,48,
+94,69,61, 98,82,73, 97,86,76, 137,122,103, 103,92,78, 116,105,89,
+114,106,90, 110,101,88, 103,95,83, 93,85,75, 78,72,66, 43,29,24,
+20,4,0, 21,11,8, 22,12,7, 18,8,3, 19,12,8, 12,4,0, 13,5,1, 18,9,7,
+15,12,12, 9,3,1, 7,1,0, 5,1,0, 4,1,0, 5,1,0, 4,0,0, 3,0,0, 85,30,11,
+84,30,11, 83,30,11, 84,31,12, 84,31,12, 82,30,11, 84,30,11, 84,31,11,
+84,31,10, 84,31,10, 83,30,10, 83,31,10, 83,31,11, 81,30,10, 76,29,10,
+40,16,4, 18,8,1, 9,5,0, 7,4,0, 6,4,0, 9,5,0, 7,3,0, 3,2,0, 1,0,0,
+0,0,0, 1,1,0, 1,0,0, 0,0,0, 0,0,0, 0,0,0, 1,0,0, 0,0,0, 0,1,0, 2,1,0,
+3,3,0, 96,30,4, 195,57,9, 186,55,8, 204,62,10, 229,65,11, 238,69,13,
+215,63,11, 215,65,11, 190,54,9, 198,60,10, 137,41,6, 88,33,4, 58,26,4,
+76,30,5, 70,38,12, 61,37,11, 57,42,15, 68,51,22, 85,52,22, 100,53,23,
+103,55,29, 97,66,40, 104,76,45, 101,74,41, 104,78,41, 123,94,54,
+135,110,62, 152,127,75, 157,126,75, 166,128,76, 183,133,77,
+194,140,88, 183,134,97, 177,129,100, 200,148,117, 207,158,129,
+208,159,131, 210,166,139, 217,179,147, 218,184,149, 224,189,154,
+231,193,159, 227,189,158, 227,189,160, 230,194,163, 221,185,154,
+204,164,137, 188,141,117, 176,124,99, 150,98,71, 140,89,66, 160,121,102,
+153,123,107, 175,135,114, 147,99,87, 133,79,68, 116,72,64, 122,86,77,
+121,68,54, 75,38,27, 44,20,15, 67,29,18, 89,40,24, 102,58,46, 120,84,74,
+89,73,67, 86,75,70, 137,119,104, 140,123,103, 114,102,89, 115,104,90,
+100,94,82, 111,101,88, 108,99,86, 100,91,79, 81,74,67, 63,51,45,
+17,4,0, 20,8,4, 22,12,8, 20,11,7, 19,12,9, 17,11,8, 17,10,7, 15,5,3,
+11,5,2, 12,8,7, 6,1,0, 5,1,0, 5,2,0, 4,2,0, 4,2,0, 4,2,0, 82,30,12,
+83,30,11, 83,30,11, 83,30,12, 84,30,12, 83,30,11, 83,30,11, 83,30,11,
+83,31,11, 82,30,11, 83,31,10, 84,31,11, 84,31,11, 83,30,11, 81,31,11,
+68,26,9, 33,14,3, 19,9,1, 13,7,0, 6,4,0, 8,4,0, 6,3,0, 6,2,0, 1,1,0,
+0,0,0, 1,1,0, 1,0,0, 0,0,0, 0,0,0, 0,0,0, 0,0,0, 0,0,0, 0,0,0, 1,2,0,
+3,3,0, 32,12,1, 114,37,5, 179,53,8, 201,61,10, 210,61,10, 243,70,13,
+214,63,11, 196,59,10, 176,49,8, 173,52,8, 138,41,6, 66,30,6, 104,38,7,
+90,44,13, 71,58,28, 66,48,21, 81,56,27, 110,63,30, 118,72,36, 106,69,36,
+110,82,52, 121,88,57, 131,94,59, 130,92,56, 114,83,49, 118,88,55,
+108,84,51, 128,103,61, 129,103,59, 140,113,64, 162,126,77, 181,142,99,
+172,137,107, 179,145,116, 197,159,129, 207,161,127, 213,166,133,
+212,168,136, 200,156,125, 219,178,141, 234,196,159, 234,196,160,
+223,185,154, 221,183,152, 210,169,138, 186,141,116, 174,125,100,
+172,121,97, 172,120,97, 166,119,97, 166,121,103, 173,137,119,
+173,138,117, 147,107,85, 135,84,73, 120,73,66, 126,80,72, 119,78,68,
+93,47,34, 46,19,12, 74,33,19, 84,43,30, 108,62,50, 124,86,74, 104,82,74,
+101,87,79, 123,107,98, 123,108,96, 140,123,105, 117,106,91, 131,119,102,
+103,95,84, 111,101,90, 107,97,85, 88,80,70, 87,80,70, 67,58,54, 27,14,9,
+18,6,1, 21,14,12, 21,13,10, 17,10,7, 15,8,5, 12,3,0, 11,3,0, 9,3,0,
+13,9,7, 8,3,1, 6,1,0, 5,1,0, 4,1,0, 4,1,0, 5,2,0, 83,30,12, 83,30,12,
+83,30,12, 83,30,12, 83,30,12, 83,30,11, 83,30,12, 83,30,12, 82,30,11,
+83,31,11, 83,31,11, 84,31,11, 83,30,11, 83,30,11, 83,31,11, 80,29,11,
+58,23,8, 32,14,3, 21,9,2, 11,5,0, 6,3,0, 4,2,0, 6,3,0, 4,2,0, 1,1,0,
+1,1,0, 0,0,0, 1,0,0, 0,0,0, 0,0,0, 0,0,0, 0,0,0, 1,1,0, 1,1,0, 12,5,0,
+39,15,2, 57,22,3, 121,40,6, 184,55,8, 203,60,10, 238,67,11, 211,59,10,
+175,51,8, 134,41,6, 127,42,6, 130,42,5, 43,28,7, 154,50,8, 89,57,22,
+82,64,31, 92,68,34, 103,70,35, 101,66,34, 93,67,36, 76,57,34, 72,53,32,
+92,68,45, 122,85,59, 115,83,56, 108,82,54, 124,98,66, 137,103,71,
+166,117,83, 169,127,90, 149,119,74, 150,122,81, 155,124,95, 168,136,109,
+208,173,140, 220,177,144, 233,187,147, 244,206,160, 218,173,135,
+205,163,126, 224,187,146, 225,188,149, 225,182,148, 220,177,144,
+199,154,124, 183,135,110, 179,133,108, 188,142,117, 188,144,122,
+193,153,132, 177,140,122, 182,146,126, 190,154,132, 161,121,101,
+143,96,74, 111,69,59, 126,74,64, 135,89,78, 100,57,46, 54,24,16,
+74,35,23, 94,42,23, 101,60,50, 113,79,71, 103,82,75, 130,107,95,
+137,118,104, 130,114,100, 126,111,98, 133,117,102, 122,110,94,
+138,123,104, 118,106,90, 111,102,91, 110,101,89, 93,84,73, 85,78,68,
+68,60,56, 48,35,28, 19,10,8, 22,13,10, 20,11,9, 15,7,2, 17,11,9,
+9,3,0, 9,3,0, 8,3,0, 10,3,1, 14,9,9, 8,2,0, 6,1,0, 5,2,0, 5,1,0, 5,1,0,
+82,30,11, 83,29,11, 82,29,11, 82,29,11, 82,29,11, 82,29,11, 83,30,12,
+83,30,11, 82,30,11, 82,30,11, 83,30,11, 82,30,12, 82,30,11, 82,30,11,
+82,30,12, 82,30,11, 79,29,12, 48,19,6, 31,13,2, 19,8,1, 10,4,0, 7,3,0,
+3,2,0, 4,2,0, 2,1,0, 1,0,0, 1,0,0, 1,0,0, 0,1,0, 1,0,0, 0,0,0, 0,0,0,
+1,1,0, 1,2,0, 28,11,1, 48,20,2, 53,22,2, 69,27,3, 115,39,5, 185,56,9,
+229,65,11, 212,54,9, 173,49,7, 145,46,7, 178,55,9, 172,51,8, 118,39,5,
+160,50,8, 86,41,11, 84,47,18, 87,52,21, 83,60,31, 88,61,36, 92,69,44,
+84,68,44, 100,76,51, 112,81,56, 111,74,55, 108,69,51, 110,78,55,
+116,89,65, 139,104,77, 167,123,92, 159,122,88, 152,123,81, 144,114,77,
+170,137,104, 186,151,116, 206,165,130, 230,179,144, 228,182,149,
+237,191,152, 229,186,146, 235,198,157, 232,198,152, 217,176,138,
+217,171,139, 208,161,131, 202,157,128, 212,172,141, 207,170,143,
+211,178,152, 206,175,151, 195,163,141, 178,146,126, 184,148,125,
+176,137,114, 143,98,79, 118,69,48, 124,75,63, 138,86,75, 121,75,64,
+66,33,25, 62,33,24, 101,56,43, 106,63,53, 125,84,73, 109,84,75,
+133,109,97, 149,123,109, 148,124,109, 126,110,97, 144,126,108,
+118,105,92, 133,119,101, 143,126,105, 127,113,97, 112,103,91, 110,102,90,
+90,83,75, 86,77,67, 74,67,58, 62,52,45, 40,19,11, 43,14,3, 32,14,8,
+21,10,6, 17,10,7, 12,5,1, 9,3,0, 8,3,0, 7,3,0, 12,8,5, 11,5,4, 5,2,0,
+6,2,0, 8,2,0, 9,5,4, 82,29,11, 82,30,11, 82,30,12, 83,30,12, 83,30,12,
+82,30,12, 82,30,12, 81,30,11, 81,30,11, 82,30,12, 82,30,11, 82,30,12,
+81,29,11, 81,29,12, 81,29,11, 81,30,12, 81,30,12, 75,27,11, 41,16,4,
+27,11,2, 17,7,1, 8,3,0, 4,2,0, 3,2,0, 3,2,0, 3,2,0, 1,1,0, 1,0,0, 1,0,0,
+1,1,0, 1,0,0, 0,0,0, 1,0,0, 11,5,0, 45,18,2, 57,22,2, 59,24,3, 66,27,3,
+57,25,2, 136,44,6, 212,61,10, 229,59,11, 209,57,10, 203,60,10, 204,59,10,
+207,59,9, 181,51,7, 157,46,7, 117,36,3, 72,27,3, 51,26,7, 42,28,11,
+53,41,20, 65,51,30, 86,67,41, 111,79,54, 102,71,51, 95,58,42, 96,58,43,
+85,58,36, 108,79,50, 137,102,70, 180,132,94, 189,141,100, 188,147,101,
+182,149,104, 185,152,109, 202,162,119, 212,170,129, 217,176,138,
+231,187,150, 240,196,159, 241,200,163, 224,186,146, 202,160,123,
+191,146,113, 195,146,116, 213,166,135, 214,173,145, 220,185,154,
+212,182,155, 206,175,148, 186,154,131, 191,158,133, 166,129,108,
+165,122,101, 148,102,80, 115,68,51, 128,79,58, 130,86,75, 124,79,69,
+82,43,31, 60,31,24, 101,56,44, 126,76,63, 136,92,79, 123,96,85,
+105,85,77, 130,109,98, 150,125,110, 148,124,109, 125,109,97, 144,127,109,
+129,115,99, 129,116,102, 145,127,107, 115,104,89, 106,98,87, 95,88,79,
+90,85,78, 90,82,73, 82,74,63, 53,49,45, 77,37,17, 93,32,2, 69,29,10,
+54,22,9, 43,14,2, 28,13,8, 20,6,0, 15,4,0, 11,4,0, 8,3,0, 14,10,9, 6,3,0,
+9,3,0, 12,7,5, 12,6,6, 82,28,11, 82,28,11, 83,29,12, 82,29,12, 82,29,12,
+82,29,12, 82,29,12, 82,29,12, 81,29,11, 81,29,11, 81,29,12, 81,29,12,
+81,29,11, 81,29,11, 80,29,12, 81,29,12, 81,29,12, 80,29,12, 76,28,11,
+42,16,4, 24,9,2, 17,6,0, 7,3,0, 2,1,0, 3,2,0, 2,1,0, 1,0,0, 1,1,0,
+0,1,0, 1,1,0, 0,0,0, 0,0,0, 1,0,0, 26,10,0, 51,20,3, 60,24,3, 54,23,2,
+55,23,2, 50,23,2, 78,30,3, 175,53,9, 242,67,12, 245,67,12, 214,59,10,
+157,44,6, 146,44,6, 110,48,13, 108,55,21, 94,66,30, 84,56,23, 65,45,20,
+58,42,21, 63,46,25, 77,60,36, 106,72,41, 130,86,55, 113,73,50, 106,65,47,
+105,69,51, 98,75,49, 112,83,53, 115,81,53, 148,105,70, 174,129,85,
+200,159,107, 211,175,119, 218,181,126, 227,188,131, 231,190,134,
+224,182,133, 229,184,141, 232,186,147, 227,184,148, 216,176,140,
+208,168,131, 209,170,132, 226,199,157, 226,193,154, 216,182,150,
+219,187,156, 200,168,141, 189,156,132, 181,145,121, 171,130,105,
+145,102,81, 131,82,61, 109,60,36, 128,78,57, 148,104,85, 136,92,79,
+101,55,42, 70,27,14, 98,60,51, 123,82,73, 142,101,89, 123,99,90,
+150,122,108, 137,113,101, 136,113,103, 133,112,100, 148,124,110,
+128,111,100, 145,126,111, 129,115,102, 123,110,97, 129,114,96,
+133,117,99, 134,120,102, 118,108,94, 106,97,87, 103,94,84, 86,76,68,
+74,64,55, 74,49,32, 115,46,3, 96,43,11, 83,36,10, 73,28,4, 60,27,11,
+58,21,1, 51,18,1, 41,14,0, 28,9,0, 19,8,4, 14,8,6, 17,9,6, 23,9,4,
+27,8,0, 82,29,12, 82,29,12, 82,29,12, 82,29,12, 82,30,12, 82,29,13,
+81,29,12, 81,30,12, 81,30,12, 81,29,12, 81,29,12, 81,29,12, 81,29,11,
+80,29,12, 81,30,13, 81,29,12, 81,29,13, 81,29,12, 79,29,11, 76,28,12,
+46,18,6, 24,9,2, 16,6,0, 8,3,0, 3,1,0, 4,1,0, 1,1,0, 0,0,0, 0,0,0,
+0,0,0, 1,1,0, 0,1,0, 7,3,0, 36,14,2, 56,22,3, 52,22,2, 48,21,2, 54,24,2,
+52,23,2, 64,27,2, 95,34,4, 226,64,11, 231,62,11, 173,49,7, 152,45,5,
+144,52,11, 134,65,22, 120,78,34, 109,90,44, 110,84,43, 93,76,45,
+93,63,34, 117,67,33, 154,73,31, 164,92,45, 151,106,62, 129,96,63,
+129,93,67, 124,94,74, 90,67,45, 83,57,34, 80,51,27, 130,91,58,
+164,131,87, 200,168,117, 212,183,129, 233,204,149, 231,200,152,
+232,200,152, 231,199,148, 240,204,150, 239,201,148, 238,203,150,
+235,205,154, 231,195,151, 235,198,156, 230,203,161, 229,201,159,
+206,175,140, 200,164,134, 194,160,131, 183,145,120, 166,126,103,
+151,101,79, 127,80,62, 127,77,53, 132,83,60, 144,101,84, 140,97,79,
+107,62,47, 86,38,23, 104,58,45, 129,82,71, 117,90,81, 126,101,92,
+158,128,114, 160,130,115, 141,116,104, 144,118,105, 143,119,106,
+136,114,102, 136,117,104, 141,124,109, 130,115,102, 129,117,100,
+137,124,105, 144,126,105, 139,124,103, 132,118,101, 107,98,87, 107,98,87,
+96,87,77, 75,65,57, 60,50,46, 100,45,9, 104,45,6, 89,39,10, 81,36,10,
+84,37,7, 82,36,8, 82,34,3, 76,30,2, 63,24,1, 51,20,4, 40,20,11, 48,20,6,
+55,19,0, 58,21,1, 81,29,12, 81,29,12, 81,29,12, 81,29,12, 81,30,12,
+82,29,13, 80,29,12, 80,30,11, 81,30,12, 81,30,12, 81,30,12, 81,30,12,
+80,29,12, 80,29,12, 80,29,12, 81,29,13, 80,29,12, 81,29,12, 80,29,12,
+80,29,12, 77,28,12, 51,19,7, 21,9,1, 15,6,0, 10,4,0, 6,1,0, 1,0,0,
+0,0,0, 0,1,0, 1,0,0, 0,1,0, 0,0,0, 15,6,1, 46,18,2, 48,20,2, 49,21,2,
+53,23,3, 46,22,2, 56,25,2, 52,24,2, 47,24,2, 173,53,8, 231,64,11,
+174,51,8, 159,49,6, 159,51,8, 123,59,18, 91,56,23, 100,80,36, 104,78,41,
+138,70,30, 174,84,34, 184,89,35, 163,111,58, 157,119,68, 177,136,81,
+168,127,76, 186,138,95, 136,101,76, 85,62,39, 68,48,22, 66,43,19,
+121,95,57, 169,144,95, 196,169,117, 207,181,130, 221,192,144,
+223,190,148, 239,212,164, 239,210,166, 239,208,165, 239,210,165,
+236,208,161, 234,211,159, 230,197,150, 224,188,150, 201,167,135,
+181,143,116, 164,123,96, 158,114,88, 157,113,87, 153,108,87, 145,100,81,
+139,94,79, 140,97,83, 147,104,92, 142,97,87, 132,80,70, 111,65,54,
+90,39,21, 98,51,39, 132,80,67, 144,105,92, 111,90,81, 166,132,116,
+164,134,117, 160,131,116, 145,119,107, 155,126,111, 153,124,109,
+145,120,106, 132,114,102, 136,120,106, 128,111,99, 144,127,110,
+145,131,112, 146,129,111, 151,131,107, 136,121,101, 116,104,91,
+111,101,87, 107,97,85, 77,69,62, 58,51,48, 82,47,24, 107,45,3, 87,40,12,
+80,37,12, 93,38,4, 80,38,12, 89,37,4, 85,38,8, 81,38,10, 82,37,7,
+81,35,4, 72,34,10, 87,36,6, 78,46,36, 81,29,12, 81,29,13, 81,30,13,
+81,30,13, 81,30,13, 81,29,12, 80,29,12, 80,30,12, 80,30,13, 80,30,12,
+80,29,12, 80,29,12, 80,29,12, 80,29,12, 80,30,13, 80,28,12, 80,29,12,
+80,29,12, 80,29,12, 80,29,12, 79,29,12, 78,28,12, 51,19,7, 18,7,0,
+16,6,0, 12,4,0, 6,2,0, 1,1,0, 1,1,0, 0,1,0, 1,0,0, 3,1,0, 42,16,2,
+43,18,2, 45,20,2, 52,23,2, 44,21,2, 45,22,2, 54,24,2, 46,24,3, 36,22,2,
+72,30,3, 231,66,11, 198,58,9, 182,56,9, 141,45,6, 100,44,8, 69,34,9,
+100,51,18, 155,72,24, 178,80,26, 178,87,34, 164,106,53, 172,134,79,
+201,156,96, 211,160,96, 202,142,88, 156,110,68, 102,68,40, 79,63,31,
+69,57,23, 48,34,13, 111,89,54, 154,129,86, 172,145,103, 188,159,120,
+199,165,128, 225,189,152, 245,224,177, 241,218,174, 240,212,170,
+241,228,181, 237,220,176, 234,216,175, 232,216,170, 231,212,164,
+226,202,157, 205,175,143, 173,139,118, 156,112,92, 144,95,78, 146,103,91,
+161,120,106, 162,117,102, 152,104,92, 141,92,81, 132,85,77, 111,58,45,
+99,46,29, 94,46,32, 130,74,61, 138,96,84, 144,114,100, 137,113,98,
+170,137,117, 167,137,118, 165,135,116, 148,123,108, 158,130,115,
+144,120,106, 160,129,111, 149,124,108, 124,107,95, 128,109,95,
+156,132,113, 152,133,116, 152,136,116, 161,138,113, 143,126,104,
+120,109,95, 108,100,87, 111,101,87, 86,79,71, 62,55,52, 66,50,41,
+113,47,4, 92,41,10, 86,39,10, 84,38,10, 79,38,13, 85,40,10, 91,41,6,
+90,39,3, 87,37,2, 88,39,8, 89,46,29, 77,52,51, 82,54,54, 80,29,12,
+80,29,12, 80,29,13, 81,29,14, 81,29,13, 80,29,12, 80,29,12, 80,29,12,
+80,29,12, 80,29,12, 80,29,12, 80,30,13, 79,30,13, 80,29,13, 80,29,13,
+80,29,12, 80,29,12, 79,28,12, 80,29,13, 80,29,12, 79,29,12, 79,30,13,
+78,29,13, 51,19,7, 15,6,0, 15,6,0, 13,5,1, 7,2,0, 2,1,0, 2,1,0,
+1,0,0, 21,7,0, 52,20,2, 36,17,2, 40,20,2, 48,22,2, 35,18,1, 40,20,2,
+49,23,2, 53,26,2, 28,21,1, 21,18,1, 190,57,9, 216,62,11, 206,64,10,
+166,54,7, 105,35,4, 101,33,5, 137,46,9, 172,66,18, 168,77,27, 139,85,39,
+138,106,60, 158,123,73, 210,166,104, 210,159,100, 154,110,67, 112,79,45,
+95,66,34, 54,47,16, 36,31,7, 27,20,3, 63,48,24, 103,76,49, 131,99,68,
+148,116,82, 165,131,98, 191,156,121, 208,177,139, 204,171,136,
+206,170,134, 219,187,143, 221,194,150, 224,196,154, 229,208,161,
+228,205,159, 228,205,161, 218,194,153, 192,164,136, 165,129,111,
+141,94,79, 139,93,80, 155,107,88, 149,101,86, 138,87,75, 123,79,69,
+119,63,49, 105,49,31, 89,44,30, 126,70,55, 136,92,80, 146,110,97,
+169,134,114, 151,124,107, 162,132,113, 170,139,118, 168,136,116,
+152,125,108, 160,131,114, 148,124,109, 154,126,110, 160,130,111,
+124,105,93, 136,115,99, 157,133,113, 151,130,113, 150,133,116,
+155,137,114, 155,133,109, 129,118,98, 112,103,91, 110,100,87, 98,89,78,
+64,58,56, 63,54,49, 94,47,19, 91,43,11, 84,42,13, 82,41,12, 97,43,4,
+82,40,11, 91,39,3, 90,42,15, 86,50,39, 83,55,54, 83,54,55, 83,54,54,
+82,54,55, 80,29,13, 81,29,13, 81,29,14, 80,29,14, 80,29,13, 79,29,12,
+79,29,12, 79,30,13, 79,29,12, 79,30,13, 79,30,13, 79,30,12, 79,30,13,
+79,29,12, 79,29,12, 79,29,13, 79,30,13, 79,30,12, 79,30,13, 79,30,12,
+79,30,13, 79,30,13, 79,30,13, 78,29,12, 56,20,8, 17,7,1, 13,6,0,
+15,6,1, 11,4,0, 4,2,0, 6,2,0, 44,15,2, 43,17,2, 26,15,1, 35,18,2,
+41,19,2, 29,17,1, 40,20,2, 52,24,2, 51,26,2, 21,19,1, 15,16,1, 114,39,5,
+221,68,11, 217,70,11, 211,68,11, 154,48,7, 136,40,5, 157,49,7, 137,47,7,
+109,47,11, 85,64,27, 106,83,41, 137,104,57, 144,101,61, 120,83,50,
+114,82,50, 118,85,50, 94,71,39, 42,38,11, 28,20,2, 25,19,2, 24,18,3,
+57,36,19, 76,48,30, 104,71,48, 117,82,57, 136,103,70, 153,118,85,
+161,124,95, 173,136,102, 185,144,108, 192,151,115, 191,153,115,
+188,153,115, 192,158,121, 196,163,128, 190,158,127, 180,145,118,
+170,133,112, 151,104,86, 118,66,50, 125,70,53, 126,79,67, 114,60,45,
+113,60,45, 109,52,35, 89,43,30, 114,65,49, 134,89,77, 146,106,95,
+168,128,109, 172,139,118, 160,131,113, 148,119,103, 173,137,116,
+173,138,117, 156,126,108, 164,134,115, 162,134,115, 156,128,111,
+159,129,110, 138,116,102, 127,111,98, 148,128,110, 149,131,113,
+141,127,113, 150,134,114, 152,131,109, 136,119,99, 122,111,92, 107,97,84,
+101,93,82, 67,60,58, 62,54,50, 74,51,35, 104,46,2, 89,44,10, 91,44,9,
+92,44,10, 85,47,29, 81,51,47, 83,56,58, 84,55,57, 83,55,57, 84,55,57,
+84,55,56, 84,56,57, 79,29,14, 79,29,14, 80,29,14, 80,29,14, 80,29,13,
+79,30,13, 79,30,13, 79,30,13, 79,30,13, 79,30,13, 79,29,13, 78,29,13,
+79,30,13, 79,30,13, 79,30,13, 79,29,13, 79,29,13, 79,30,13, 78,29,13,
+79,29,13, 79,30,13, 79,30,13, 79,29,13, 78,29,13, 78,29,13, 60,22,9,
+22,9,1, 14,6,0, 10,5,0, 8,3,0, 28,11,1, 44,17,2, 34,15,2, 24,15,0,
+37,18,1, 30,16,1, 32,17,1, 44,21,2, 57,25,2, 45,24,1, 18,18,1, 17,16,1,
+43,22,2, 203,66,10, 198,66,10, 196,63,9, 182,60,8, 162,54,8, 141,49,6,
+126,45,5, 51,26,1, 38,27,4, 57,46,17, 91,68,32, 99,66,35, 97,65,40,
+100,73,45, 120,95,59, 101,84,50, 41,37,12, 27,20,2, 27,20,1, 24,21,2,
+56,41,17, 75,51,28, 92,62,39, 118,82,57, 134,97,68, 153,114,82,
+173,136,100, 187,147,107, 188,147,109, 186,144,109, 178,138,104,
+164,128,95, 153,115,84, 145,102,73, 141,98,73, 143,94,69, 156,115,95,
+145,104,89, 116,68,55, 98,45,28, 93,38,18, 90,34,15, 85,42,29, 67,29,18,
+109,55,38, 134,87,74, 147,106,91, 166,124,106, 171,133,113, 174,140,119,
+169,133,113, 137,112,99, 175,140,120, 171,138,118, 162,131,113,
+161,131,113, 162,134,114, 152,127,108, 160,131,112, 156,129,110,
+139,118,103, 146,124,106, 156,135,113, 146,133,114, 158,141,117,
+149,129,108, 149,129,105, 132,118,97, 128,115,93, 107,98,85, 79,72,69,
+62,54,51, 66,56,47, 94,53,29, 91,56,45, 84,57,54, 82,56,58, 86,58,61,
+85,56,59, 85,57,59, 84,56,58, 84,56,58, 84,57,58, 84,56,58, 84,56,58,
+79,29,14, 79,29,14, 79,29,14, 79,30,13, 80,29,14, 78,29,13, 79,30,13,
+78,29,13, 78,29,13, 78,29,13, 78,29,13, 79,30,12, 78,29,13, 79,30,13,
+79,30,13, 79,30,13, 79,30,13, 79,29,13, 79,30,13, 79,29,13, 79,30,13,
+78,29,13, 78,29,12, 79,30,13, 79,30,13, 78,29,13, 69,26,11, 40,15,6,
+14,7,1, 9,5,0, 48,18,2, 39,16,2, 29,15,1, 18,11,0, 33,16,1, 24,15,0,
+39,20,1, 47,22,2, 65,28,3, 42,23,1, 16,16,1, 16,15,1, 20,14,0, 146,53,7,
+177,61,9, 192,65,9, 198,68,10, 188,67,10, 131,49,6, 93,37,3, 54,27,1,
+19,18,0, 21,22,2, 50,42,13, 83,62,30, 82,60,32, 89,67,38, 109,86,53,
+94,78,45, 37,34,11, 27,20,2, 37,23,2, 25,19,2, 33,30,8, 68,57,24,
+88,68,34, 110,84,49, 120,89,56, 144,111,74, 160,123,87, 165,125,88,
+167,126,90, 170,131,95, 168,135,100, 160,125,87, 150,110,75, 132,86,56,
+110,65,41, 85,41,23, 92,51,36, 121,76,58, 122,73,57, 81,37,24,
+55,25,17, 63,28,19, 56,23,14, 96,50,35, 132,79,65, 154,104,87,
+159,123,106, 181,141,118, 179,149,126, 167,134,115, 151,120,106,
+126,108,97, 160,132,116, 156,127,110, 154,127,111, 161,132,113,
+173,139,118, 169,138,117, 167,136,115, 159,132,112, 143,120,105,
+164,133,109, 153,129,109, 157,137,115, 156,139,116, 161,141,114,
+145,126,105, 122,110,93, 114,103,87, 100,92,78, 75,72,69, 56,51,51,
+64,54,49, 77,58,57, 92,63,67, 90,61,64, 88,60,63, 87,59,62, 86,58,61,
+85,58,60, 85,58,60, 85,58,60, 85,57,60, 86,58,60, 86,58,60, 78,29,14,
+79,29,13, 79,29,13, 79,29,13, 79,29,14, 78,29,13, 78,29,13, 79,29,14,
+78,29,13, 78,29,13, 78,29,13, 77,29,13, 78,29,13, 79,30,13, 79,30,13,
+78,29,13, 79,29,13, 78,29,14, 78,30,14, 78,29,13, 78,29,13, 78,29,13,
+79,30,13, 78,30,13, 78,29,13, 79,30,13, 78,29,13, 78,29,13, 72,27,12,
+57,21,5, 55,21,3, 42,18,1, 24,13,0, 15,10,0, 23,13,0, 31,16,1, 42,20,1,
+57,25,2, 67,28,2, 31,21,1, 16,16,0, 16,15,1, 24,16,0, 62,30,3, 179,64,9,
+199,70,10, 201,72,11, 161,59,8, 125,48,6, 99,41,4, 63,32,2, 20,20,0,
+15,19,0, 28,28,6, 49,44,14, 75,63,28, 85,68,34, 89,74,41, 84,72,39,
+35,32,10, 29,21,2, 58,28,3, 45,23,1, 18,17,1, 23,21,3, 30,25,5,
+51,37,12, 68,47,18, 97,66,32, 115,81,45, 119,83,47, 120,89,51,
+130,102,62, 135,105,69, 122,87,56, 105,64,40, 95,54,31, 84,43,24,
+52,21,9, 41,19,12, 56,28,19, 61,32,22, 50,27,20, 48,21,13, 70,31,19,
+102,48,28, 128,73,56, 152,97,80, 168,126,106, 161,133,115, 175,147,125,
+159,137,118, 153,128,113, 159,135,119, 137,120,107, 142,117,105,
+151,121,106, 149,125,109, 160,131,113, 172,139,118, 174,141,119,
+166,137,116, 163,134,113, 147,123,106, 163,131,108, 163,134,108,
+160,135,112, 149,131,110, 142,132,110, 140,124,104, 140,125,105,
+137,123,101, 129,114,92, 100,91,78, 75,68,64, 60,54,52, 65,51,47,
+92,64,68, 91,63,67, 90,61,65, 89,60,64, 88,60,64, 87,60,63, 86,59,62,
+86,59,62, 85,59,62, 86,60,62, 87,59,62, 78,29,13, 78,29,13, 79,29,14,
+79,29,14, 79,29,14, 79,29,14, 78,29,14, 78,29,14, 78,29,13, 77,29,13,
+78,29,13, 78,29,13, 78,30,13, 78,30,13, 78,29,13, 78,29,13, 78,29,13,
+78,30,13, 78,30,14, 78,29,13, 78,30,13, 78,29,13, 78,29,13, 78,29,13,
+78,29,14, 78,29,14, 78,29,13, 78,29,13, 77,30,13, 65,25,5, 56,22,3,
+30,14,0, 19,9,0, 12,8,0, 17,11,0, 38,18,1, 48,22,2, 70,28,2, 66,27,2,
+28,19,1, 17,16,0, 17,16,0, 26,18,1, 18,18,0, 134,51,6, 169,59,8,
+171,60,8, 162,58,8, 138,50,6, 110,42,4, 83,37,4, 39,25,1, 16,19,0,
+13,19,0, 18,22,1, 20,23,2, 46,46,15, 42,42,14, 43,39,14, 16,16,3,
+26,18,2, 67,30,5, 57,27,3, 37,22,3, 27,21,3, 22,21,5, 24,22,4, 27,22,5,
+33,25,8, 49,35,14, 51,35,13, 53,36,14, 54,35,15, 50,30,15, 38,18,6,
+37,17,6, 42,22,12, 43,22,13, 47,25,18, 52,24,15, 47,23,16, 48,25,16,
+60,30,21, 80,34,17, 100,44,21, 124,64,42, 139,90,76, 154,115,99,
+170,137,117, 174,147,125, 184,154,132, 172,143,123, 172,145,125,
+177,151,129, 144,118,105, 158,124,109, 155,124,109, 170,138,117,
+152,127,111, 169,138,118, 173,141,118, 169,141,119, 164,136,114,
+148,124,108, 152,124,106, 161,130,108, 160,133,109, 150,130,110,
+156,140,116, 152,138,115, 138,125,104, 141,127,104, 130,117,94,
+113,102,83, 84,75,68, 69,63,61, 60,51,46, 84,61,63, 92,64,69, 90,62,67,
+89,62,66, 89,61,65, 88,61,65, 88,61,65, 88,61,65, 87,60,64, 87,60,64,
+87,60,64, 78,29,14, 77,29,14, 76,29,14, 74,29,14, 74,29,14, 73,29,14,
+73,29,14, 74,29,14, 74,29,13, 73,28,13, 74,29,13, 75,29,14, 76,29,14,
+76,29,13, 76,29,13, 77,29,13, 77,29,13, 77,29,13, 77,29,13, 76,29,13,
+77,29,13, 77,29,13, 77,29,13, 78,29,13, 77,29,13, 77,29,13, 78,30,13,
+77,29,13, 77,29,9, 63,24,3, 33,16,1, 14,9,0, 13,6,0, 11,7,0, 16,10,0,
+42,19,2, 66,28,3, 72,28,3, 56,26,1, 33,20,0, 20,17,0, 27,17,1, 20,17,0,
+18,19,1, 44,25,2, 150,55,7, 138,50,6, 129,47,5, 126,46,5, 109,41,4,
+80,33,3, 65,29,2, 40,23,1, 16,18,0, 12,16,0, 13,17,0, 12,15,0, 13,15,1,
+16,16,2, 11,12,2, 14,14,2, 48,23,4, 48,23,4, 41,21,3, 42,21,2, 29,21,4,
+19,17,1, 20,17,1, 22,17,2, 25,19,4, 24,15,1, 26,15,3, 30,17,7, 35,20,9,
+47,24,13, 45,23,14, 48,24,13, 49,24,14, 58,28,18, 50,24,13, 52,25,14,
+63,25,10, 81,33,14, 98,45,24, 117,65,46, 135,86,70, 151,105,90,
+171,129,109, 188,154,130, 180,152,130, 186,150,130, 178,149,128,
+180,154,131, 170,139,118, 143,112,100, 164,127,109, 164,130,111,
+160,132,113, 154,128,112, 162,134,116, 170,140,119, 167,140,119,
+160,134,114, 157,130,111, 143,119,103, 157,125,106, 169,137,112,
+151,134,113, 155,138,115, 152,136,114, 129,118,101, 142,127,104,
+132,117,95, 122,109,88, 96,86,72, 74,69,65, 66,59,56, 71,54,55,
+94,67,72, 92,64,70, 91,63,69, 90,63,68, 90,63,68, 90,63,68, 89,62,67,
+88,62,66, 88,63,67, 88,62,67, 73,29,14, 67,28,13, 56,23,10, 42,17,6,
+38,16,6, 37,14,5, 35,14,6, 34,13,5, 32,13,5, 33,13,5, 38,15,6, 45,18,8,
+51,20,8, 56,23,11, 63,25,12, 66,27,13, 68,27,13, 67,27,13, 66,27,13,
+66,26,13, 71,27,13, 75,29,13, 76,29,13, 76,30,14, 77,30,13, 77,29,13,
+77,29,13, 78,30,13, 68,26,5, 53,21,2, 19,11,0, 10,6,0, 9,5,0, 9,7,0,
+26,14,0, 49,22,2, 84,32,3, 66,27,3, 36,20,1, 22,17,0, 29,18,0, 32,18,1,
+18,18,0, 18,19,0, 17,17,0, 56,27,2, 167,60,8, 147,53,6, 94,36,3, 87,34,3,
+79,30,4, 69,27,2, 60,25,2, 56,23,2, 42,20,0, 25,15,0, 13,12,0, 10,12,0,
+15,14,2, 11,11,1, 12,12,2, 14,14,3, 16,14,2, 18,14,1, 38,19,3, 22,17,4,
+27,18,4, 26,18,5, 24,19,7, 26,18,6, 28,19,7, 34,21,9, 57,34,17, 89,57,34,
+94,60,40, 78,41,24, 82,41,23, 67,33,19, 44,20,11, 60,25,10, 70,28,12,
+83,38,21, 98,51,33, 113,65,48, 135,79,58, 155,100,79, 168,119,97,
+187,145,120, 199,166,137, 183,155,133, 186,153,132, 183,154,132,
+173,142,121, 161,123,107, 146,113,101, 164,126,109, 168,133,113,
+169,138,117, 144,122,107, 161,133,116, 157,131,113, 149,127,110,
+141,120,103, 155,129,110, 152,127,108, 164,131,108, 167,136,112,
+152,133,112, 157,138,117, 148,132,112, 142,126,107, 129,116,98,
+130,115,96, 129,112,91, 101,90,75, 90,81,68, 75,68,65, 64,52,49,
+94,68,74, 94,66,72, 92,65,71, 91,64,70, 91,64,70, 91,64,69, 90,64,69,
+90,64,69, 90,64,69, 89,64,69, 42,17,6, 27,11,2, 18,7,0, 11,5,0, 7,4,0,
+6,3,0, 5,2,0, 5,2,0, 4,2,0, 5,3,0, 5,3,0, 5,4,0, 6,5,0, 7,5,0, 9,6,0,
+11,7,0, 11,6,1, 10,6,0, 9,5,0, 9,6,0, 13,8,1, 24,12,3, 45,19,8, 74,29,14,
+76,29,13, 76,29,13, 77,29,13, 83,32,11, 75,28,4, 41,17,2, 9,7,0, 11,5,0,
+6,5,0, 9,8,0, 44,20,1, 58,27,2, 93,33,4, 69,28,3, 30,19,1, 16,14,0,
+37,18,0, 33,20,0, 19,19,1, 20,20,2, 18,17,0, 16,15,0, 46,23,1, 156,56,7,
+99,39,3, 33,18,0, 21,14,0, 36,17,0, 56,22,2, 55,22,2, 43,20,1, 20,14,0,
+16,13,0, 18,14,1, 11,13,0, 12,12,0, 13,13,2, 12,12,0, 15,14,2, 15,14,2,
+17,15,4, 18,14,2, 17,13,2, 19,13,2, 23,16,5, 24,16,4, 29,19,6, 36,22,11,
+68,40,21, 87,56,33, 82,47,26, 77,39,22, 72,36,21, 48,24,15, 68,32,17,
+73,31,15, 82,36,19, 99,50,30, 119,63,38, 138,85,67, 149,101,84,
+158,108,88, 178,130,106, 198,159,131, 203,171,141, 190,160,136,
+191,159,135, 182,146,127, 163,126,108, 164,122,107, 150,116,104,
+166,128,110, 173,139,117, 175,141,118, 159,131,112, 168,137,118,
+169,139,119, 162,136,115, 164,137,115, 165,135,113, 153,128,109,
+155,130,109, 163,136,112, 157,135,114, 151,131,110, 147,132,112,
+147,129,111, 116,104,91, 128,115,97, 126,111,94, 108,97,82, 92,81,70,
+89,79,67, 70,58,54, 86,64,68, 96,68,76, 94,67,74, 93,66,72, 92,66,72,
+92,66,72, 92,66,72, 91,66,72, 91,66,71, 91,66,72, 14,6,0, 10,5,0, 7,3,0,
+4,2,0, 2,1,0, 1,1,0, 2,2,0, 2,2,0, 2,4,0, 3,5,0, 3,5,0, 3,5,0, 4,4,0,
+3,3,0, 3,3,0, 3,2,0, 3,2,0, 3,3,0, 3,4,0, 3,4,0, 3,4,0, 3,4,0, 4,5,0,
+35,15,5, 73,29,14, 76,30,14, 76,29,14, 88,33,8, 75,29,4, 26,14,0, 11,8,0,
+15,9,0, 8,7,0, 17,12,0, 58,25,2, 71,30,2, 101,35,4, 73,29,2, 32,19,1,
+18,14,0, 45,19,1, 31,20,0, 17,18,0, 20,19,1, 17,17,1, 16,14,0, 14,14,0,
+41,22,1, 126,47,5, 62,27,2, 31,17,0, 41,20,1, 50,21,2, 31,15,0, 21,14,0,
+22,13,0, 37,18,1, 31,18,1, 21,16,1, 18,14,0, 16,15,1, 15,14,0, 14,13,0,
+16,15,3, 17,15,3, 18,15,2, 18,14,3, 21,15,5, 22,15,3, 24,16,3, 29,20,9,
+31,19,7, 38,21,9, 68,40,20, 66,36,20, 72,38,22, 51,25,13, 67,29,13,
+74,32,17, 79,38,23, 93,47,28, 115,61,37, 140,87,67, 155,108,90,
+178,129,104, 167,127,107, 178,141,119, 184,151,128, 186,155,131,
+178,150,128, 169,138,120, 163,127,113, 160,119,104, 164,121,105,
+154,120,105, 167,130,110, 176,141,118, 177,143,119, 165,135,113,
+164,133,116, 174,141,119, 162,135,116, 169,139,116, 166,137,115,
+164,136,113, 143,122,105, 159,133,111, 162,136,114, 138,121,104,
+139,124,105, 132,117,104, 112,99,87, 119,108,93, 120,108,92, 113,102,87,
+83,76,68, 95,82,69, 84,71,64, 75,58,57, 98,71,79, 96,69,77, 95,68,75,
+94,68,75, 93,68,74, 93,68,74, 93,67,74, 93,68,75, 93,68,75, 4,3,0,
+3,2,0, 2,1,0, 2,1,0, 1,2,0, 1,1,0, 1,2,0, 2,4,0, 3,4,0, 4,5,0, 5,4,0,
+2,3,0, 1,2,0, 1,1,0, 1,2,0, 1,2,0, 2,2,0, 2,4,0, 2,5,0, 2,4,0, 2,3,0,
+2,4,0, 3,4,0, 3,4,0, 28,13,4, 72,29,14, 79,31,14, 94,35,6, 68,27,3,
+25,14,0, 19,14,0, 18,12,0, 12,11,0, 30,17,1, 65,28,2, 83,32,3, 104,37,4,
+72,30,2, 20,14,0, 26,15,0, 37,20,1, 18,18,0, 17,18,0, 17,18,1, 18,17,1,
+15,14,0, 17,16,0, 16,16,0, 47,23,2, 116,46,5, 72,32,2, 45,23,0, 62,26,3,
+21,15,0, 11,12,0, 15,13,0, 16,14,0, 20,16,1, 20,17,1, 45,22,2, 54,24,2,
+27,17,2, 21,16,1, 19,16,3, 20,15,4, 17,14,3, 19,15,2, 22,18,5, 23,16,4,
+24,16,3, 26,17,5, 30,19,7, 31,19,9, 41,23,11, 39,22,13, 46,24,14,
+65,30,13, 69,29,11, 71,27,7, 85,41,22, 104,49,23, 131,82,62, 156,105,85,
+167,124,104, 185,146,122, 187,153,128, 195,156,127, 205,167,136,
+205,171,139, 184,148,125, 179,140,119, 166,124,107, 156,117,102,
+152,115,102, 148,116,102, 167,132,111, 181,146,120, 180,146,120,
+172,138,114, 159,129,112, 173,137,117, 164,133,114, 173,139,116,
+164,135,115, 169,139,115, 156,129,110, 150,126,108, 157,132,113,
+137,119,104, 132,116,101, 121,109,100, 112,99,89, 104,92,84, 111,99,87,
+103,92,80, 87,79,69, 80,71,63, 89,78,66, 74,60,53, 97,71,80, 98,70,79,
+96,69,78, 96,70,78, 95,69,77, 95,69,77, 95,70,77, 94,69,77, 94,70,77,
+3,2,0, 2,1,0, 2,2,0, 2,2,0, 2,3,0, 3,4,0, 3,5,0, 3,5,0, 5,5,0, 5,4,0,
+3,3,0, 2,2,0, 1,1,0, 1,1,0, 1,2,0, 2,3,0, 3,4,0, 3,5,0, 3,5,0, 3,5,0,
+2,5,0, 2,4,0, 2,3,0, 2,3,0, 3,3,0, 29,13,5, 82,32,13, 89,33,4, 51,23,2,
+28,16,0, 22,14,0, 18,13,0, 19,14,0, 44,21,2, 71,30,3, 83,31,3, 111,38,4,
+56,24,1, 15,14,0, 44,20,2, 29,20,1, 20,20,2, 20,19,1, 17,16,1, 17,15,1,
+15,14,0, 18,17,0, 18,17,1, 15,14,0, 79,34,3, 98,39,4, 65,29,2, 58,26,2,
+20,15,0, 15,14,0, 12,14,0, 11,14,1, 13,16,1, 21,17,1, 31,20,3, 22,17,2,
+32,19,2, 28,19,3, 25,18,2, 23,17,3, 18,15,2, 20,15,1, 23,17,4, 23,18,4,
+25,17,5, 28,18,8, 30,20,9, 30,18,7, 33,19,8, 47,26,14, 63,29,12,
+64,25,5, 71,29,8, 81,38,19, 97,50,27, 121,67,43, 148,100,80, 167,118,94,
+176,132,110, 187,149,125, 207,173,142, 201,166,135, 205,170,138,
+197,159,130, 173,136,115, 176,134,113, 169,126,107, 167,123,104,
+167,124,104, 161,123,105, 160,127,109, 169,138,117, 179,143,118,
+176,137,112, 160,129,112, 174,138,117, 167,133,115, 169,133,113,
+162,133,114, 167,137,114, 165,133,112, 158,129,109, 156,131,112,
+131,117,104, 130,115,103, 122,110,103, 119,109,101, 99,88,81, 98,86,77,
+92,83,74, 80,71,63, 65,58,55, 82,73,62, 77,66,57, 89,68,71, 99,73,83,
+98,72,81, 97,72,80, 97,72,80, 97,72,79, 96,71,80, 97,71,79, 96,71,80,
+2,1,0, 2,2,0, 2,3,0, 3,4,0, 4,5,0, 4,5,0, 5,5,0, 6,5,0, 5,3,0, 4,3,0,
+2,1,0, 2,2,0, 1,2,0, 1,2,0, 1,2,0, 2,3,0, 3,5,0, 3,5,0, 3,5,0, 2,4,0,
+2,4,0, 2,3,0, 2,3,0, 1,3,0, 2,3,0, 3,3,0, 63,23,4, 74,28,3, 37,19,1,
+33,17,1, 20,14,0, 15,14,1, 33,19,1, 57,26,2, 80,31,3, 85,32,3, 116,37,4,
+40,19,1, 25,18,0, 55,25,2, 20,17,0, 18,19,1, 19,17,1, 14,13,0, 14,13,0,
+16,14,1, 18,17,1, 18,17,0, 17,16,0, 14,14,1, 50,24,2, 80,33,3, 68,31,3,
+42,22,1, 39,20,1, 24,16,0, 16,15,0, 15,14,0, 11,14,0, 22,16,2, 17,15,1,
+27,17,2, 22,15,3, 28,18,3, 40,22,4, 33,21,4, 32,18,3, 28,17,4, 30,18,7,
+32,19,7, 34,20,9, 35,22,9, 43,24,9, 54,26,7, 63,32,14, 67,33,15,
+71,34,17, 84,41,19, 104,59,37, 120,70,45, 143,93,72, 160,116,97,
+176,129,106, 182,138,115, 188,148,124, 206,170,139, 203,170,138,
+203,166,135, 187,146,120, 170,132,113, 173,132,111, 171,127,106,
+169,126,105, 174,132,109, 171,136,112, 178,140,116, 183,143,120,
+171,136,116, 162,127,111, 159,127,109, 174,137,116, 173,138,117,
+167,134,114, 166,135,114, 164,136,115, 168,136,114, 148,126,110,
+153,131,113, 155,136,119, 121,111,101, 115,105,100, 110,101,96,
+103,95,89, 79,72,67, 86,76,70, 79,70,65, 77,69,62, 68,61,57, 74,65,57,
+80,62,58, 102,75,86, 100,74,83, 99,74,83, 99,74,83, 99,74,83, 98,73,82,
+98,73,82, 97,74,82, 3,3,0, 3,3,0, 4,5,0, 4,5,0, 5,5,0, 7,5,0, 9,5,0,
+8,4,0, 5,3,0, 2,2,0, 1,1,0, 1,2,0, 2,3,0, 2,2,0, 3,4,0, 3,4,0, 3,5,0,
+3,6,0, 3,5,0, 2,4,0, 2,4,0, 2,3,0, 2,3,0, 1,2,0, 1,2,0, 6,4,0, 62,22,3,
+55,22,2, 31,16,0, 28,15,0, 22,15,0, 17,15,0, 43,21,1, 65,29,2, 93,35,4,
+88,34,4, 95,31,4, 28,15,0, 41,21,1, 54,25,1, 20,16,0, 17,17,1, 14,13,0,
+13,11,0, 16,14,0, 18,16,0, 15,13,0, 19,17,1, 16,15,0, 16,15,0, 14,16,0,
+18,17,0, 34,22,1, 51,25,2, 54,24,2, 51,22,1, 38,19,2, 34,19,1, 34,20,1,
+33,20,2, 43,22,2, 43,23,2, 41,24,3, 44,26,5, 40,25,5, 42,26,7, 43,27,8,
+44,28,10, 44,27,8, 47,28,8, 50,28,7, 54,31,11, 58,32,13, 59,31,12,
+63,33,16, 62,26,6, 71,30,8, 91,44,18, 121,74,51, 143,92,67, 163,114,91,
+174,129,106, 181,138,115, 183,141,117, 187,147,123, 202,164,134,
+202,168,137, 194,155,127, 184,143,116, 171,135,114, 172,128,107,
+171,125,104, 172,128,105, 178,138,111, 176,139,111, 185,148,120,
+191,154,124, 183,148,120, 174,134,114, 152,120,105, 166,133,115,
+173,138,116, 166,135,115, 171,139,116, 164,137,117, 169,138,115,
+145,124,109, 138,121,110, 150,131,116, 142,129,113, 130,117,109,
+123,111,103, 115,103,96, 100,92,86, 101,92,84, 93,84,75, 91,83,70,
+83,77,69, 80,73,62, 72,59,51, 100,75,84, 101,76,86, 100,75,86, 100,75,85,
+100,75,85, 100,75,85, 99,75,85, 98,75,85, 4,4,0, 7,7,0, 7,7,0, 8,6,0,
+7,5,0, 7,5,0, 8,4,0, 5,3,0, 2,1,0, 1,1,0, 1,1,0, 2,4,0, 2,3,0, 2,4,0,
+2,4,0, 3,4,0, 3,5,0, 3,5,0, 2,4,0, 2,4,0, 2,4,0, 2,4,0, 1,2,0, 1,2,0,
+1,2,0, 18,7,0, 48,18,2, 33,17,1, 17,10,0, 20,11,0, 21,14,0, 19,14,0,
+46,21,2, 73,30,3, 106,39,5, 90,34,4, 67,25,2, 27,18,0, 48,24,1, 26,16,0,
+15,12,0, 13,11,0, 15,11,0, 14,12,0, 16,15,0, 19,17,1, 16,15,0, 19,18,2,
+14,14,0, 17,16,1, 16,17,0, 15,16,0, 17,15,0, 21,15,0, 45,22,1, 61,26,3,
+27,21,2, 67,32,4, 64,30,3, 39,25,3, 37,25,5, 35,25,5, 32,24,5, 34,26,8,
+35,25,4, 36,25,4, 38,25,5, 42,27,9, 43,26,7, 46,28,7, 51,31,11, 52,28,8,
+54,26,6, 57,27,7, 66,34,16, 75,36,14, 89,48,22, 114,69,44, 138,93,72,
+163,119,96, 177,136,112, 184,139,113, 183,142,117, 182,142,119,
+187,148,123, 198,158,130, 198,162,133, 190,149,124, 185,143,117,
+164,125,105, 169,124,103, 169,124,102, 172,130,106, 183,142,114,
+175,136,109, 182,141,116, 186,146,120, 182,141,115, 177,131,109,
+165,123,107, 159,125,108, 165,134,115, 166,135,115, 176,142,117,
+169,139,117, 173,142,118, 149,125,111, 128,112,106, 135,119,111,
+154,137,117, 129,117,106, 128,113,104, 110,97,91, 108,96,90, 90,82,78,
+107,99,92, 96,89,82, 92,87,80, 84,79,70, 73,63,53, 91,69,74, 103,78,89,
+103,78,89, 102,77,88, 102,77,87, 101,77,87, 101,77,88, 95,72,82, 7,6,0,
+9,7,0, 10,6,0, 8,5,0, 7,4,0, 6,4,0, 5,3,0, 3,2,0, 2,1,0, 1,1,0, 2,3,0,
+3,4,0, 2,4,0, 3,5,0, 2,6,0, 3,5,0, 3,5,0, 2,4,0, 2,4,0, 2,4,0, 2,4,0,
+2,3,0, 1,2,0, 1,2,0, 2,1,0, 30,10,1, 46,17,2, 29,14,0, 14,9,0, 7,6,0,
+14,12,0, 23,14,0, 36,18,1, 82,31,3, 122,43,6, 90,33,4, 53,25,2, 38,21,1,
+40,20,1, 15,12,0, 14,13,0, 14,14,0, 16,14,1, 17,16,0, 17,16,0, 21,18,1,
+18,17,1, 18,16,1, 15,15,0, 18,17,1, 16,17,0, 16,16,1, 17,14,0, 20,14,0,
+45,21,1, 64,28,3, 45,26,3, 94,37,5, 62,29,4, 47,26,3, 59,30,7, 47,26,3,
+32,23,3, 35,26,6, 35,26,4, 37,25,4, 38,26,5, 42,27,8, 42,25,5, 45,25,4,
+50,30,10, 53,29,9, 57,29,11, 67,35,16, 79,43,22, 96,55,29, 114,69,41,
+137,92,65, 158,113,89, 176,131,103, 187,144,116, 186,147,120,
+182,142,119, 182,140,115, 181,144,122, 195,158,131, 192,156,129,
+185,142,117, 171,125,102, 158,117,98, 168,123,99, 168,124,101,
+174,132,108, 185,146,117, 174,134,110, 184,142,117, 186,143,117,
+179,132,109, 175,128,107, 172,125,109, 161,127,110, 166,132,112,
+161,129,112, 174,139,116, 175,142,119, 172,140,118, 157,131,112,
+129,112,104, 131,115,107, 139,122,111, 137,126,108, 136,121,109,
+120,107,99, 107,94,87, 97,88,82, 102,95,86, 107,100,91, 93,87,79,
+85,80,72, 84,75,64, 77,60,59, 105,80,92, 104,79,91, 104,79,91, 103,79,90,
+103,79,90, 98,75,86, 47,24,21, 11,7,0, 13,7,0, 12,6,0, 10,5,0, 7,3,0,
+5,3,0, 3,2,0, 3,2,0, 2,2,0, 2,3,0, 3,4,0, 3,5,0, 3,6,0, 3,5,0, 3,5,0,
+3,5,0, 3,5,0, 2,5,0, 2,4,0, 2,4,0, 2,4,0, 2,3,0, 2,2,0, 1,2,0, 4,2,0,
+32,11,3, 42,16,1, 34,15,0, 24,12,0, 9,6,0, 7,8,0, 29,15,0, 39,19,1,
+101,36,4, 119,41,5, 98,35,4, 38,21,1, 55,25,1, 30,19,0, 17,15,0, 18,18,1,
+17,16,0, 17,16,1, 17,16,0, 18,17,0, 20,18,0, 17,15,0, 15,13,0, 18,17,0,
+18,18,0, 18,19,0, 17,17,0, 18,15,0, 20,12,0, 42,20,1, 87,36,5, 62,31,5,
+107,40,7, 67,32,5, 67,31,6, 71,32,6, 55,29,5, 36,26,4, 35,28,6, 36,28,5,
+38,27,6, 42,29,8, 44,29,9, 46,28,7, 48,29,8, 53,30,12, 56,29,10,
+63,33,12, 81,46,24, 102,61,35, 120,78,51, 143,99,73, 159,116,90,
+173,131,105, 180,141,115, 187,148,122, 183,144,119, 182,139,113,
+182,139,113, 186,145,120, 201,164,133, 184,149,126, 167,125,107,
+161,118,97, 159,118,99, 171,125,102, 169,125,102, 173,131,106,
+181,139,112, 172,128,106, 181,137,114, 188,144,117, 176,131,108,
+174,133,109, 174,132,109, 162,131,111, 168,133,113, 168,130,112,
+161,130,111, 170,139,117, 168,137,117, 168,138,116, 141,121,107,
+130,112,104, 137,119,108, 148,130,113, 131,118,105, 134,118,107,
+118,106,98, 109,97,91, 93,86,79, 118,112,97, 100,93,85, 93,87,77,
+87,81,68, 72,59,53, 102,78,89, 105,81,93, 105,81,93, 105,81,93,
+103,79,92, 50,26,24, 34,10,3, 13,7,0, 14,7,0, 10,5,0, 8,4,0, 6,2,0,
+3,2,0, 2,2,0, 2,3,0, 2,4,0, 3,5,0, 3,6,0, 3,6,0, 3,6,0, 4,6,0, 3,6,0,
+3,5,0, 2,5,0, 3,5,0, 2,4,0, 2,4,0, 2,3,0, 2,3,0, 1,2,0, 2,2,0, 10,5,0,
+39,15,3, 36,15,1, 39,17,1, 26,12,0, 18,8,0, 10,7,0, 29,14,0, 55,25,2,
+106,38,5, 103,36,4, 99,36,4, 46,23,2, 64,27,2, 22,19,1, 20,19,1, 19,19,1,
+18,17,0, 17,16,0, 17,17,0, 18,17,0, 20,19,1, 18,16,1, 14,11,0, 19,17,1,
+19,19,1, 20,19,1, 17,17,1, 18,15,0, 20,13,0, 52,23,2, 117,43,6, 60,30,3,
+110,41,6, 82,34,5, 89,36,5, 92,37,6, 69,32,5, 42,27,5, 34,26,6, 36,28,7,
+38,28,6, 42,29,9, 44,29,8, 48,30,9, 51,31,12, 58,33,13, 68,39,16,
+85,50,25, 106,70,45, 125,85,57, 142,100,73, 162,120,90, 174,135,107,
+185,143,113, 188,145,114, 188,147,116, 184,143,117, 179,136,111,
+178,135,110, 184,142,115, 202,165,135, 180,139,113, 163,116,96,
+163,117,97, 155,118,100, 164,124,105, 164,123,103, 169,126,103,
+174,130,105, 174,132,107, 179,140,114, 182,141,113, 175,132,107,
+175,134,109, 176,140,112, 164,133,113, 170,133,113, 171,133,113,
+166,132,113, 174,141,117, 162,134,114, 164,135,116, 160,133,113,
+135,114,102, 143,119,105, 151,130,113, 134,120,105, 141,123,109,
+127,113,102, 118,107,98, 106,97,89, 109,102,90, 107,101,90, 99,92,82,
+89,83,71, 83,73,62, 91,69,75, 108,83,96, 107,83,96, 103,79,91, 54,29,29,
+33,11,6, 36,13,7, 16,7,0, 14,5,0, 9,5,0, 6,3,0, 4,2,0, 4,3,0, 3,3,0,
+3,4,0, 3,5,0, 3,6,0, 4,6,0, 3,7,0, 3,7,0, 4,6,0, 3,5,0, 3,5,0, 2,5,0,
+2,4,0, 2,3,0, 2,3,0, 2,2,0, 1,2,0, 1,1,0, 2,2,0, 28,11,2, 47,18,3,
+27,13,0, 32,15,1, 36,15,1, 26,11,0, 21,9,0, 28,13,0, 61,26,3, 102,37,4,
+82,31,4, 80,31,3, 70,29,2, 49,24,2, 19,18,0, 20,20,1, 20,19,1, 19,18,0,
+16,16,0, 17,16,0, 17,17,1, 20,19,1, 19,18,1, 15,12,0, 18,16,1, 20,20,1,
+20,19,2, 18,17,1, 17,14,0, 20,13,0, 50,21,2, 145,51,8, 56,29,4,
+114,41,7, 101,37,5, 101,38,5, 109,40,6, 80,34,4, 35,23,3, 32,25,6,
+34,25,5, 38,27,5, 42,28,9, 44,27,9, 48,29,10, 56,34,14, 76,46,22,
+94,60,33, 115,78,50, 130,95,68, 142,105,76, 156,119,90, 170,135,105,
+177,142,114, 185,147,118, 186,146,116, 187,145,116, 182,139,113,
+174,131,105, 172,129,105, 181,137,110, 195,158,129, 170,125,102,
+162,116,94, 167,120,96, 163,121,102, 171,125,101, 167,124,102,
+165,124,101, 170,130,107, 171,134,111, 168,133,109, 178,141,113,
+178,139,111, 176,138,111, 179,144,115, 170,140,116, 177,138,116,
+175,137,116, 168,134,115, 172,139,116, 173,141,118, 168,138,117,
+162,135,114, 140,118,102, 150,126,110, 154,130,114, 150,131,114,
+140,123,106, 135,117,105, 119,106,98, 120,108,97, 95,88,79, 110,103,92,
+101,94,83, 98,91,78, 89,81,68, 80,63,61, 110,87,100, 100,74,85, 46,19,18,
+31,6,1, 32,13,9, 36,12,6, 17,7,0, 12,5,0, 6,3,0, 6,4,0, 4,4,0, 4,5,0,
+3,5,0, 3,5,0, 3,5,0, 3,6,0, 4,6,0, 4,7,0, 3,7,0, 3,6,0, 3,5,0, 4,6,0,
+3,5,0, 2,4,0, 2,4,0, 2,2,0, 1,2,0, 1,2,0, 1,1,0, 3,1,0, 52,19,3, 48,19,2,
+27,14,1, 21,12,0, 30,14,0, 44,17,2, 30,13,1, 33,16,1, 67,28,3, 101,36,5,
+74,29,3, 59,26,2, 92,34,3, 38,22,1, 17,18,0, 19,20,1, 20,20,1, 18,18,1,
+16,15,0, 16,15,0, 17,16,0, 18,17,0, 20,19,1, 16,15,1, 18,16,1, 18,17,1,
+18,18,1, 18,18,1, 17,14,0, 21,14,0, 46,20,1, 169,56,9, 52,27,3, 106,40,6,
+108,39,6, 112,39,5, 109,37,5, 85,33,5, 41,26,4, 31,24,5, 33,25,4,
+35,24,3, 39,26,7, 41,24,4, 50,29,7, 69,42,19, 98,65,33, 126,88,56,
+146,106,73, 153,115,84, 151,115,88, 155,120,96, 164,128,102, 170,134,109,
+173,133,106, 179,137,110, 180,140,112, 174,134,110, 164,123,100,
+165,123,100, 182,138,112, 185,145,119, 169,122,97, 164,119,96,
+168,124,100, 164,122,100, 170,125,101, 168,123,98, 171,123,98,
+184,140,110, 182,140,112, 167,130,109, 175,140,114, 169,135,112,
+171,135,112, 176,143,115, 172,141,117, 174,139,116, 175,137,116,
+173,138,117, 171,138,116, 171,138,115, 163,135,114, 177,144,119,
+167,138,116, 135,114,101, 139,119,105, 149,128,111, 135,118,102,
+148,128,110, 126,110,100, 113,100,94, 95,85,79, 88,81,74, 83,77,68,
+74,67,60, 73,67,59, 75,65,58, 92,67,75, 47,20,14, 41,15,7, 34,10,4,
+34,8,1, 33,13,9, 16,6,0, 11,4,0, 4,3,0, 5,4,0, 4,5,0, 3,5,0, 3,5,0,
+3,5,0, 3,6,0, 4,6,0, 4,6,0, 3,6,0, 3,6,0, 3,5,0, 3,5,0, 3,5,0, 3,5,0,
+2,4,0, 2,3,0, 2,2,0, 1,1,0, 1,1,0, 2,1,0, 10,4,0, 57,21,3, 39,16,2,
+27,13,0, 20,12,0, 15,10,0, 71,26,4, 50,19,2, 59,23,3, 85,32,3, 105,37,5,
+70,28,3, 54,23,2, 78,29,3, 41,21,1, 18,18,0, 19,19,1, 20,19,2, 15,14,0,
+17,16,1, 16,16,1, 17,16,0, 18,17,0, 18,18,1, 17,15,1, 17,15,1, 17,15,1,
+16,15,0, 18,18,2, 17,15,0, 22,14,0, 36,17,1, 178,57,11, 74,33,5, 55,28,4,
+105,38,5, 116,40,6, 106,35,5, 76,28,3, 47,23,2, 31,23,3, 31,23,3,
+34,23,3, 38,25,7, 44,27,7, 62,38,14, 87,57,30, 123,88,55, 150,117,78,
+158,124,89, 160,123,92, 160,121,91, 164,126,97, 164,126,100, 166,128,106,
+161,123,102, 164,123,101, 170,126,101, 166,121,95, 155,110,88,
+159,118,100, 185,141,114, 175,135,111, 167,121,95, 170,124,99,
+168,127,104, 168,126,102, 171,127,102, 170,125,99, 174,127,99,
+183,140,109, 182,139,109, 171,132,108, 174,131,106, 172,130,105,
+177,134,111, 163,131,107, 162,133,111, 164,133,113, 172,138,116,
+180,143,118, 168,138,117, 165,134,114, 150,123,106, 162,131,112,
+170,139,116, 152,127,109, 147,124,108, 141,121,106, 128,111,98,
+106,96,88, 109,97,92, 101,90,87, 96,86,83, 76,67,66, 96,87,78,
+94,83,75, 83,70,70, 74,64,64, 66,47,39, 46,20,13, 48,23,15, 40,12,4,
+34,7,0, 30,10,6, 15,5,1, 12,4,0, 3,4,0, 3,4,0, 4,6,0, 3,5,0, 3,6,0,
+3,5,0, 2,4,0, 3,5,0, 3,5,0, 3,6,0, 3,5,0, 3,6,0, 3,5,0, 3,5,0, 2,4,0,
+2,4,0, 2,2,0, 1,1,0, 2,1,0, 1,1,0, 1,1,0, 21,8,1, 49,18,4, 33,14,1,
+31,13,0, 18,10,0, 19,12,0, 74,26,4, 62,23,3, 78,28,4, 75,28,3, 102,35,4,
+69,27,2, 54,23,2, 43,20,1, 46,23,1, 25,20,1, 19,19,1, 19,19,2, 14,14,0,
+17,17,0, 20,18,1, 19,17,0, 18,17,1, 18,18,1, 16,12,0, 15,13,0, 16,14,1,
+15,14,0, 17,16,1, 16,14,0, 21,13,0, 30,16,1, 170,55,10, 157,53,8,
+34,24,3, 58,26,4, 92,32,4, 101,32,4, 78,28,4, 51,24,3, 31,22,5, 32,24,6,
+34,24,5, 40,26,8, 52,32,11, 74,47,21, 106,75,44, 144,109,73, 174,140,99,
+170,140,103, 161,131,101, 169,137,107, 168,131,102, 163,125,98,
+161,123,100, 154,115,93, 154,115,94, 159,117,97, 153,112,91, 147,102,82,
+162,120,101, 183,144,119, 171,130,107, 166,122,95, 170,128,102,
+170,129,104, 169,126,100, 170,128,102, 172,128,102, 177,133,103,
+184,135,106, 187,140,110, 166,133,104, 166,125,97, 167,124,100,
+176,132,109, 173,136,112, 172,138,113, 163,132,111, 170,139,115,
+168,137,114, 162,134,113, 174,142,119, 167,134,112, 145,118,103,
+160,129,110, 164,135,113, 142,119,104, 138,119,104, 143,124,109,
+109,97,92, 123,109,103, 119,104,99, 108,95,93, 94,82,80, 75,67,64,
+100,88,81, 93,82,74, 84,71,70, 75,66,62, 61,38,31, 52,24,14, 51,22,13,
+38,10,3, 33,7,1, 21,7,1, 14,6,0, 7,6,0, 3,5,0, 2,4,0, 3,5,0, 3,5,0,
+3,5,0, 3,5,0, 3,5,0, 3,5,0, 3,6,0, 3,5,0, 3,5,0, 3,6,0, 3,5,0, 3,5,0,
+2,4,0, 1,2,0, 1,1,0, 1,1,0, 1,1,0, 1,1,0, 25,9,1, 42,16,3, 29,12,1,
+33,14,2, 15,11,0, 28,15,1, 72,28,3, 68,25,3, 70,25,4, 66,25,2, 88,32,3,
+70,27,2, 61,25,2, 22,19,1, 39,23,1, 25,20,0, 18,19,0, 18,17,1, 15,14,2,
+17,16,0, 20,19,1, 21,19,2, 19,19,1, 21,20,1, 16,13,0, 14,12,0, 15,13,0,
+16,15,0, 16,15,0, 16,15,0, 20,14,0, 24,14,1, 150,49,8, 212,67,13,
+74,30,3, 24,17,3, 31,17,2, 58,24,4, 63,25,5, 46,23,2, 30,20,2, 30,22,3,
+32,20,2, 44,27,8, 65,41,15, 93,62,30, 125,92,57, 170,135,92, 185,149,105,
+181,146,106, 166,135,98, 166,138,103, 158,124,97, 157,120,97, 154,118,95,
+149,111,89, 144,107,86, 146,110,90, 145,98,77, 148,106,90, 168,128,107,
+179,139,116, 167,127,103, 163,123,95, 170,128,99, 168,131,107,
+171,127,99, 170,128,101, 172,130,103, 175,133,103, 182,137,107,
+181,137,108, 160,127,101, 161,126,96, 173,129,104, 178,136,112,
+175,135,112, 174,140,115, 165,134,112, 174,140,114, 169,140,115,
+159,133,111, 164,134,113, 174,141,118, 145,120,103, 143,118,104,
+145,120,105, 143,119,103, 137,116,100, 137,118,104, 116,103,96,
+102,90,86, 119,105,100, 107,94,92, 94,81,81, 93,82,78, 79,70,66,
+106,94,84, 93,83,74, 90,79,70, 79,68,62, 58,30,22, 53,24,15, 50,20,11,
+35,8,0, 26,10,2, 22,10,2, 6,6,0, 3,5,0, 3,4,0, 2,4,0, 2,5,0, 2,5,0,
+2,4,0, 3,5,0, 3,4,0, 3,4,0, 3,5,0, 3,5,0, 3,5,0, 3,5,0, 2,4,0, 2,4,0,
+2,2,0, 2,2,0, 2,2,0, 1,0,0, 3,1,0, 38,15,2, 38,15,3, 37,15,2, 37,16,2,
+13,12,0, 36,18,1, 67,26,2, 73,26,3, 59,22,2, 56,21,2, 72,28,3, 78,29,3,
+63,26,2, 19,19,0, 30,22,1, 25,20,0, 18,18,0, 16,16,1, 17,16,2, 19,18,0,
+19,19,1, 19,18,1, 20,20,1, 21,20,2, 18,17,1, 15,13,1, 15,13,0, 16,15,1,
+16,15,0, 15,14,1, 19,14,0, 22,14,0, 112,38,6, 225,70,12, 148,47,7,
+76,28,5, 50,22,4, 40,18,2, 32,20,4, 32,21,2, 28,19,2, 31,22,4, 35,21,3,
+51,32,12, 78,53,24, 112,80,45, 141,107,70, 186,154,105, 191,156,112,
+186,151,110, 177,144,103, 165,134,98, 165,132,99, 158,121,96, 156,116,92,
+148,110,90, 146,110,92, 141,104,87, 144,100,78, 156,115,96, 166,130,112,
+173,133,112, 167,129,105, 166,128,98, 167,130,98, 166,128,102,
+172,130,99, 169,127,99, 171,130,102, 176,135,105, 183,143,110,
+176,136,105, 152,119,98, 165,123,96, 179,136,108, 165,124,99,
+160,120,101, 157,123,102, 152,123,104, 164,131,109, 176,145,117,
+171,143,115, 156,130,109, 161,132,110, 147,123,104, 133,111,99,
+136,113,101, 133,111,99, 124,105,92, 149,124,106, 127,110,98, 114,101,92,
+95,87,83, 106,93,90, 104,89,87, 98,83,80, 78,69,65, 84,74,67, 105,92,82,
+106,95,83, 106,94,80, 85,71,62, 57,28,19, 55,26,16, 50,20,11, 17,8,1,
+15,8,0, 5,5,0, 3,4,0, 2,4,0, 2,3,0, 2,3,0, 2,3,0, 3,3,0, 3,4,0,
+3,5,0, 3,5,0, 2,4,0, 2,4,0, 2,4,0, 2,4,0, 2,3,0, 2,3,0, 1,2,0, 1,2,0,
+1,2,0, 3,2,0, 13,6,0, 53,20,3, 37,16,2, 40,17,2, 32,16,1, 15,12,0,
+59,24,2, 57,23,2, 54,21,2, 59,22,3, 47,20,2, 60,23,2, 81,27,2, 51,25,2,
+35,23,1, 24,20,1, 33,21,1, 17,17,0, 16,16,0, 19,19,2, 21,20,2, 18,17,0,
+17,16,1, 18,18,1, 22,20,1, 20,17,2, 17,15,1, 16,14,0, 14,14,1, 13,14,0,
+15,15,1, 20,15,1, 22,14,0, 66,25,2, 192,60,11, 199,61,11, 137,43,7,
+99,33,4, 62,22,2, 36,21,4, 31,21,3, 31,21,3, 35,23,7, 43,26,7, 63,40,18,
+88,60,33, 128,95,57, 151,116,77, 192,162,110, 197,164,117, 170,135,102,
+173,137,102, 167,135,97, 154,123,89, 153,118,92, 151,111,86, 146,104,80,
+137,98,78, 143,105,85, 143,105,88, 161,120,100, 170,135,114, 164,130,110,
+169,129,102, 169,132,107, 174,138,105, 158,124,97, 181,143,110,
+165,125,96, 172,131,102, 176,136,105, 177,137,106, 169,129,100,
+151,117,96, 174,131,102, 176,135,107, 167,129,104, 156,122,100,
+149,119,98, 150,120,100, 160,127,108, 173,137,113, 175,145,117,
+160,136,112, 173,141,117, 164,136,115, 135,114,99, 125,107,95,
+143,120,103, 120,102,90, 143,120,103, 136,114,100, 135,114,100,
+88,77,73, 114,99,90, 116,101,89, 106,91,81, 89,78,69, 80,71,61,
+81,71,62, 84,76,69, 86,78,68, 90,81,69, 92,78,65, 65,37,27, 56,26,16,
+5,4,0, 8,5,0, 3,4,0, 2,4,0, 2,3,0, 2,3,0, 2,3,0, 2,3,0, 2,3,0, 2,3,0,
+2,3,0, 2,3,0, 2,3,0, 2,3,0, 2,3,0, 2,3,0, 2,3,0, 1,3,0, 1,2,0, 1,2,0,
+1,2,0, 2,1,0, 43,15,2, 55,21,2, 50,20,2, 44,18,2, 28,15,0, 27,15,1,
+62,25,2, 47,18,2, 97,34,6, 94,32,7, 40,17,1, 66,20,2, 77,28,2, 39,24,1,
+37,23,1, 25,20,1, 21,19,0, 16,16,0, 15,16,0, 19,18,2, 20,19,1, 17,17,0,
+18,18,0, 20,20,1, 22,20,1, 22,20,2, 20,18,2, 18,17,1, 14,14,0, 15,15,0,
+16,15,1, 17,14,1, 20,14,1, 40,19,1, 132,44,7, 185,57,9, 178,53,9,
+130,41,6, 100,31,4, 54,23,4, 27,19,3, 35,22,5, 48,34,12, 57,38,16,
+76,51,27, 104,75,47, 140,111,71, 161,128,87, 182,155,103, 189,158,111,
+166,131,100, 166,129,100, 159,123,90, 160,128,93, 152,119,91, 149,110,84,
+142,102,78, 143,105,86, 143,102,79, 146,106,87, 164,127,107, 174,136,112,
+171,134,110, 173,136,107, 172,136,108, 179,142,111, 151,117,92,
+181,146,110, 161,122,92, 167,129,100, 176,136,105, 177,139,108,
+171,129,99, 158,123,97, 179,137,105, 173,131,102, 168,127,101,
+159,118,93, 151,116,94, 150,118,98, 148,120,100, 177,140,110,
+182,150,119, 168,141,117, 162,136,114, 168,141,119, 158,132,113,
+155,129,112, 134,114,100, 127,108,96, 111,94,86, 112,97,87, 116,98,88,
+102,87,78, 94,82,73, 104,89,78, 97,83,72, 87,74,67, 90,77,70, 88,75,70,
+88,77,68, 108,94,81, 105,92,75, 95,83,70, 91,80,67, 74,50,39, 3,3,0,
+2,4,0, 3,4,0, 2,3,0, 3,3,0, 2,3,0, 2,3,0, 2,2,0, 2,1,0, 1,2,0, 2,2,0,
+1,2,0, 1,2,0, 1,2,0, 1,2,0, 2,2,0, 1,2,0, 1,2,0, 1,2,0, 1,1,0, 2,2,0,
+5,3,0, 73,26,4, 54,21,2, 59,23,3, 49,20,1, 30,17,1, 43,19,1, 56,21,3,
+103,34,6, 117,39,6, 105,36,6, 38,15,0, 82,26,3, 66,29,3, 32,22,1,
+34,22,1, 33,21,1, 19,18,1, 18,18,0, 17,15,0, 21,20,2, 19,18,1, 19,18,0,
+19,18,0, 21,20,1, 21,21,1, 20,20,1, 21,19,2, 18,17,2, 15,15,0, 16,15,1,
+15,14,1, 14,13,1, 19,13,0, 31,17,1, 71,28,3, 150,48,8, 167,51,9,
+178,55,10, 137,43,6, 71,24,3, 32,16,4, 43,27,11, 62,42,20, 75,50,25,
+85,58,31, 122,92,58, 143,114,72, 171,142,96, 188,162,107, 178,148,101,
+173,141,105, 162,127,99, 152,117,85, 152,118,85, 144,112,84, 141,104,79,
+139,100,76, 142,105,84, 140,98,76, 156,114,93, 167,131,109, 175,140,115,
+173,137,111, 177,138,107, 173,140,110, 171,142,110, 147,112,88,
+169,134,108, 154,120,93, 160,126,100, 169,134,108, 173,139,112,
+162,126,101, 151,120,99, 167,134,106, 165,128,104, 154,117,96,
+151,118,95, 153,121,97, 152,122,101, 143,115,97, 156,124,102,
+170,141,113, 182,151,123, 167,141,116, 173,144,120, 166,138,117,
+135,114,103, 132,111,102, 132,111,101, 103,89,82, 121,102,94,
+118,99,92, 104,89,83, 98,84,75, 104,88,76, 118,97,85, 110,92,83,
+104,86,80, 116,96,88, 108,90,83, 97,83,75, 113,97,86, 103,90,84,
+96,84,80, 94,84,73, 2,3,0, 1,3,0, 2,3,0, 2,3,0, 3,3,0, 1,2,0, 1,2,0,
+1,1,0, 1,1,0, 1,1,0, 1,1,0, 1,2,0, 1,2,0, 1,2,0, 1,2,0, 1,2,0, 2,2,0,
+1,2,0, 1,1,0, 1,1,0, 2,1,0, 22,8,1, 74,26,4, 62,24,2, 43,19,0, 45,21,1,
+36,17,0, 63,24,2, 57,21,2, 93,32,5, 106,34,5, 92,30,4, 33,15,0, 94,33,4,
+55,28,2, 35,22,0, 34,21,2, 31,20,1, 18,19,1, 21,20,2, 16,16,0, 21,21,2,
+18,18,0, 21,19,1, 19,18,0, 20,19,1, 21,20,1, 20,20,2, 20,19,1, 18,17,2,
+16,16,1, 14,13,0, 14,13,0, 11,11,0, 21,15,0, 27,15,0, 43,19,1, 112,37,6,
+145,45,7, 175,54,10, 193,59,11, 95,29,6, 44,16,3, 42,26,9, 75,51,29,
+93,63,38, 106,76,46, 133,102,62, 150,118,74, 168,139,90, 194,168,112,
+180,149,100, 164,133,94, 162,125,92, 157,123,91, 154,123,91, 144,112,85,
+143,105,78, 145,106,81, 136,98,78, 137,99,81, 160,120,96, 173,137,111,
+178,140,109, 174,139,111, 174,139,109, 174,140,108, 177,144,108,
+144,107,83, 157,115,90, 155,116,87, 158,122,91, 173,136,104, 174,136,105,
+168,128,100, 151,117,95, 162,127,105, 169,130,101, 161,118,92,
+160,120,93, 163,121,95, 174,132,102, 170,136,106, 161,135,104,
+161,136,104, 169,143,115, 161,137,113, 165,137,115, 170,141,118,
+140,119,104, 132,110,101, 118,100,94, 121,103,96, 101,90,84,
+113,98,92, 108,95,89, 108,94,86, 95,84,70, 96,83,68, 94,78,66,
+87,73,65, 103,87,77, 111,94,83, 111,94,84, 93,80,73, 114,97,88,
+114,99,91, 112,98,91, 3,2,0, 1,2,0, 2,3,0, 2,2,0, 1,2,0, 1,1,0, 1,1,0,
+1,1,0, 1,1,0, 1,1,0, 0,1,0, 1,0,0, 1,0,0, 1,1,0, 1,1,0, 1,1,0, 1,1,0,
+1,1,0, 1,1,0, 1,1,0, 2,1,0, 36,13,2, 58,21,3, 64,24,3, 51,22,2, 36,18,1,
+48,20,1, 54,20,2, 66,24,3, 86,30,3, 121,36,5, 68,22,2, 23,14,0, 79,30,3,
+44,23,1, 37,21,1, 29,19,1, 29,21,1, 21,21,1, 21,20,1, 16,16,1, 21,20,1,
+18,18,0, 21,18,1, 19,18,0, 20,19,1, 21,20,1, 19,18,1, 17,16,1, 19,18,2,
+14,15,1, 15,12,0, 12,12,0, 14,13,0, 21,14,0, 25,15,0, 34,16,0, 67,25,2,
+114,36,5, 150,46,8, 164,51,9, 144,41,7, 54,19,3, 45,29,10, 90,64,38,
+120,90,57, 127,95,58, 131,100,60, 156,123,78, 167,134,88, 205,176,118,
+183,153,104, 166,136,96, 163,128,90, 161,124,87, 150,117,84, 141,107,79,
+140,104,79, 142,105,81, 131,93,72, 138,103,84, 162,124,101, 174,137,109,
+179,139,107, 174,139,109, 172,136,104, 178,144,109, 173,138,102,
+142,107,83, 152,109,85, 156,114,87, 161,123,90, 168,131,99, 170,131,101,
+169,129,100, 161,122,97, 146,115,98, 149,112,91, 159,120,97, 160,117,93,
+163,120,94, 169,129,101, 171,138,107, 161,136,107, 176,148,111,
+171,142,109, 180,150,120, 159,134,112, 158,132,110, 154,129,110,
+138,114,100, 122,101,93, 107,92,86, 98,86,80, 101,87,84, 106,92,88,
+104,92,87, 105,91,81, 81,70,60, 92,78,63, 84,70,60, 93,78,67, 101,86,78,
+104,88,85, 106,91,85, 83,72,67, 93,81,74, 89,78,73, 2,2,0, 1,2,0, 2,2,0,
+1,3,0, 1,3,0, 1,1,0, 1,1,0, 1,1,0, 0,0,0, 0,0,0, 0,1,0, 0,0,0, 0,0,0,
+0,0,0, 1,1,0, 1,1,0, 1,1,0, 1,1,0, 1,1,0, 1,1,0, 8,3,0, 41,15,3, 32,12,1,
+47,17,3, 42,18,2, 25,14,0, 50,20,2, 39,15,1, 85,29,4, 106,33,4, 123,34,5,
+61,21,2, 20,15,0, 45,23,2, 40,21,1, 35,20,1, 23,19,1, 28,22,1, 22,22,1,
+19,20,1, 18,18,1, 20,19,1, 18,18,0, 18,18,0, 19,18,0, 20,19,1, 20,19,1,
+17,16,1, 17,14,1, 18,17,2, 15,14,1, 14,12,1, 13,13,1, 18,16,1, 20,14,0,
+24,15,0, 30,15,0, 42,19,0, 84,30,4, 139,42,7, 154,47,8, 148,41,7,
+86,26,5, 54,33,13, 99,72,43, 143,114,71, 140,107,65, 138,104,65,
+154,120,76, 180,147,98, 197,167,112, 181,152,103, 165,134,95, 160,125,87,
+154,115,81, 144,109,80, 141,105,75, 143,105,77, 135,99,77, 133,97,79,
+142,108,86, 165,129,106, 173,136,107, 175,136,105, 173,138,109,
+172,136,104, 176,143,109, 169,134,100, 143,107,84, 157,112,87,
+154,110,85, 157,118,89, 165,126,96, 167,127,98, 171,131,101, 166,126,98,
+136,104,89, 139,103,85, 159,125,105, 152,113,92, 159,121,96, 165,129,99,
+167,132,103, 164,135,108, 173,142,113, 178,147,115, 169,141,109,
+169,142,115, 167,138,114, 148,126,103, 127,107,92, 119,100,88, 103,87,80,
+99,85,78, 80,70,67, 97,85,82, 93,83,79, 109,96,90, 101,88,77, 81,70,58,
+81,69,59, 91,76,67, 89,78,75, 84,72,70, 85,74,72, 91,78,75, 76,66,62,
+86,75,70, 2,2,0, 2,3,0, 1,2,0, 1,2,0, 1,2,0, 1,1,0, 1,1,0, 1,1,0,
+0,0,0, 0,0,0, 0,0,0, 0,0,0, 1,1,0, 0,1,0, 0,0,0, 1,0,0, 1,1,0, 1,1,0,
+1,0,0, 2,1,0, 31,11,1, 53,20,4, 29,12,1, 26,11,1, 24,10,1, 16,10,0,
+33,13,1, 58,22,2, 99,33,4, 123,35,5, 108,30,3, 76,26,4, 24,17,0,
+29,19,1, 53,24,2, 25,18,0, 20,18,1, 24,20,0, 22,22,2, 18,19,1, 16,17,2,
+18,18,0, 21,19,1, 17,16,1, 16,16,1, 21,20,2, 19,18,1, 16,14,0, 16,14,1,
+17,16,1, 15,11,0, 14,13,1, 16,16,1, 19,16,1, 20,15,0, 22,15,0, 26,14,0,
+37,18,1, 56,23,3, 107,33,4, 159,49,8, 132,37,6, 124,33,7, 56,30,11,
+97,69,42, 145,114,72, 150,116,75, 136,102,64, 151,117,73, 185,153,102,
+184,151,100, 173,143,96, 159,127,90, 154,118,82, 151,112,78, 146,112,82,
+138,102,73, 131,94,70, 128,90,68, 136,101,81, 152,118,96, 160,128,107,
+170,134,107, 168,129,100, 171,136,108, 172,136,103, 181,147,113,
+167,131,99, 140,105,82, 157,111,89, 153,112,83, 159,120,89, 162,122,94,
+167,128,99, 175,135,104, 165,124,96, 133,99,85, 132,96,81, 162,131,111,
+144,109,90, 143,110,90, 150,117,93, 160,123,96, 169,136,105, 160,132,107,
+179,146,115, 173,143,113, 166,139,108, 159,135,109, 162,136,108,
+134,114,95, 132,112,96, 131,108,96, 126,103,93, 106,88,80, 118,99,89,
+102,87,79, 111,96,86, 100,87,78, 89,77,71, 48,42,40, 87,78,72, 109,92,83,
+107,88,83, 103,87,83, 86,74,72, 91,76,73, 90,77,68, 4,2,0, 1,2,0,
+1,2,0, 1,2,0, 1,2,0, 1,1,0, 1,1,0, 0,1,0, 0,1,0, 1,0,0, 0,0,0, 0,0,0,
+1,1,0, 1,1,0, 0,0,0, 1,0,0, 1,0,0, 0,0,0, 1,1,0, 8,3,0, 75,27,4,
+92,32,6, 60,22,3, 28,12,0, 23,10,1, 31,13,1, 49,19,2, 97,32,4,
+99,33,4, 122,36,5, 102,29,4, 75,27,3, 20,16,0, 20,18,0, 48,23,2,
+19,17,0, 22,20,1, 24,21,1, 23,21,2, 19,17,1, 15,16,1, 19,18,1, 20,19,1,
+18,17,1, 17,17,1, 19,19,2, 18,16,1, 16,14,0, 18,17,1, 15,14,0, 14,10,0,
+17,16,2, 18,17,1, 19,17,1, 20,16,0, 23,15,0, 24,15,1, 34,18,1, 40,18,1,
+68,24,2, 134,42,7, 132,37,6, 130,35,8, 71,27,7, 89,61,39, 134,101,66,
+155,120,80, 140,103,67, 146,111,71, 175,142,95, 194,157,106, 171,138,93,
+169,135,97, 153,116,80, 147,109,78, 145,111,80, 137,102,73, 133,97,75,
+128,92,70, 142,108,86, 159,123,100, 160,128,105, 159,127,106, 162,125,99,
+166,131,103, 173,136,104, 186,151,117, 163,126,95, 139,99,78, 150,110,88,
+152,113,84, 159,119,89, 160,121,93, 170,132,102, 170,130,99, 160,119,91,
+126,89,71, 121,87,74, 151,121,104, 146,112,93, 146,112,90, 138,108,88,
+149,117,93, 152,120,94, 143,118,95, 156,128,103, 162,135,108,
+166,139,110, 155,129,104, 159,132,107, 147,125,101, 131,111,94,
+126,104,94, 126,104,96, 118,99,92, 102,86,78, 109,89,79, 121,99,88,
+113,93,85, 108,91,85, 72,62,58, 96,80,72, 91,75,68, 104,85,78, 85,71,66,
+90,74,68, 90,73,70, 90,74,70,
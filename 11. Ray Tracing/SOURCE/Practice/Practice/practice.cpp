@@ -1,15 +1,19 @@
 #define GLM_ENABLE_EXPERIMENTAL
 
 #include "glSetup.h"
+#include "threadAffinity.h"
+#include "checkpoint.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <glm/gtc/constants.hpp>	//pi()
 #include <glm/gtx/string_cast.hpp>	//glm::to_string()
 using namespace glm;
 
 #include <iostream>
 #include <fstream>
+#include <string.h>
 using namespace std;
 
 #include <omp.h>
@@ -46,13 +50,67 @@ bool	profiling = false;
 //OpemMP
 bool	useOpenMP = true;
 
+//rendering modes for interactive previews
+enum RenderMode { FULL_RES = 0, CHECKERBOARD, HALF_RES, PROGRESSIVE, N_RENDER_MODES };
+int		renderMode = FULL_RES;
+const char* renderModeName[N_RENDER_MODES] = { "Full resolution", "Checkerboard", "Half resolution", "Progressive" };
+const char* renderModeFile[N_RENDER_MODES] = { "full.ppm", "checkerboard.ppm", "half.ppm", "progressive.ppm" };
+
+//progressive rendering: one jittered sample per pixel every frame while the scene is unchanged
+float*	accumBuffer = NULL;			//sum of the samples, 3 floats per pixel
+int		nSamples = 0;				//samples accumulated in every pixel
+unsigned int	sampleSeed = 1;		//seed of the counter-based random numbers
+unsigned long long	accumHash = 0;	//scene of the accumulated samples
+
+//periodic checkpoints of the progressive rendering
+const char*	checkpointFile = "progressive.ckpt";
+const char*	resumeFile = NULL;		//checkpoint to resume from, given by -resume
+double	checkpointInterval = 30;	//seconds
+double	lastCheckpoint = 0;
+
+//NUMA-aware placement of the threads and the per-pixel buffers
+int		threadPlacement = PLACEMENT_NONE;
+bool	firstTouch = false;		//rows statically partitioned and touched first by their threads
+const int	ROW_CHUNK = 4;		//rows in a chunk of the static partition
+
+//per-thread scratch allocated by its own thread, padded to a cache line
+struct ThreadScratch
+{
+	int		traced;
+	int		reconstructed;
+	char	pad[56];
+};
+const int	MAX_THREADS = 256;
+ThreadScratch* scratch[MAX_THREADS];
+int		nThreads = 1;
+
+//frame counter to alternate the checkerboard parity
+int		frame = 0;
+
+//statistics of the last ray-traced frame
+struct RenderStats
+{
+	int		tracedPixels;		//pixels shaded with recursive ray casting
+	int		reconstructedPixels;	//pixels filled by the edge-aware filter
+	int		samples;			//samples per pixel of the progressive rendering
+	double	traceTime;			//seconds in ray tracing
+	double	reconstructTime;	//seconds in reconstruction/upsampling
+}	stats;
+
 //ray
 struct Ray
 {
 	vec3	p0; //start
 	vec3	p1; //emd
 
-	Ray(const vec3& _p0, const vec3& _p1) { p0 = _p0; p1 = _p1; }
+	//ray cone for the texture level of detail
+	float	width;	//width of the cone at p0
+	float	spread;	//spread angle of the cone in radians
+
+	Ray(const vec3& _p0, const vec3& _p1, float _width = 0, float _spread = 0)
+	{
+		p0 = _p0; p1 = _p1; width = _width; spread = _spread;
+	}
 };
 
 //light
@@ -66,9 +124,45 @@ struct Light
 	vec3	specular;
 };
 
+//mipmapped texture sampled by the ray tracer
+const int	MAX_MIPMAP_LEVELS = 16;
+struct MipmapTexture
+{
+	int		nLevels;
+	int		w[MAX_MIPMAP_LEVELS];		//width of each level
+	int		h[MAX_MIPMAP_LEVELS];		//height of each level
+	vec3*	texel[MAX_MIPMAP_LEVELS];	//RGB in [0, 1] of each level
+};
+
+//checkerboard, demon head, marble
+MipmapTexture	texture[3];
+int		nTextures = 0;
+
+//texture of each sphere, -1 for no texture
+int		sphereTexture[7] = { -1, -1, -1, -1, -1, -1, -1 };
+
+//texture mapping: off, only the base level, mip level from ray cones
+enum TextureMode { TEXTURE_OFF = 0, TEXTURE_BASE_LEVEL, TEXTURE_RAY_CONE, N_TEXTURE_MODES };
+int		textureMode = TEXTURE_RAY_CONE;
+const char* textureModeName[N_TEXTURE_MODES] = { "No texture", "Base level texture", "Ray-cone mipmapped texture" };
+
+//eye to object coordinate system for the normals of the spheres
+mat3	normalToObject;
+
 //ray-traced image
 GLubyte* image = NULL;
 
+//per-pixel buffers for the checkerboard and half-resolution modes
+vec3*	colorBuffer = NULL;		//clamped intensity of each pixel
+int*	objectBuffer = NULL;	//object hit by the primary ray, -1 for the background
+vec3*	normalBuffer = NULL;	//normal at the primary intersection
+
+//half-resolution image: (m+1)/2 x (n+1)/2
+int		m_half = 0, n_half = 0;
+vec3*	halfColor = NULL;
+int*	halfObject = NULL;
+vec3*	halfNormal = NULL;
+
 int		m = 0, m_prev = -1;	//width of the image m=windowW
 int		n = 0, n_prev = -1;	//height of the image n=windowH
 float	r = 0;				//aspect ratio
@@ -153,6 +247,107 @@ int findIntersection(const Ray& ray, vec3& p, vec3& n, int E)
 	return	iSphere;
 }
 
+//build the mipmap levels of an 8-bit image with n channels (1 or 3) by 2x2 box filtering
+bool buildMipmapTexture(MipmapTexture& t, const GLubyte* data, int w, int h, int n)
+{
+	if (n != 1 && n != 3) return false;
+
+	//base level
+	t.nLevels = 1;
+	t.w[0] = w;	t.h[0] = h;
+	t.texel[0] = new vec3[w * h];
+	for (int k = 0; k < w * h; k++)
+		for (int c = 0; c < 3; c++)
+			t.texel[0][k][c] = data[n * k + (n == 3 ? c : 0)] / 255.0f;
+
+	//coarser levels down to 1x1
+	while ((t.w[t.nLevels - 1] > 1 || t.h[t.nLevels - 1] > 1) && t.nLevels < MAX_MIPMAP_LEVELS)
+	{
+		int		l = t.nLevels;
+		int		w0 = t.w[l - 1], h0 = t.h[l - 1];
+
+		t.w[l] = std::max(w0 / 2, 1);
+		t.h[l] = std::max(h0 / 2, 1);
+		t.texel[l] = new vec3[t.w[l] * t.h[l]];
+
+		for (int j = 0; j < t.h[l]; j++)
+			for (int i = 0; i < t.w[l]; i++)
+			{
+				int		i0 = std::min(2 * i, w0 - 1), i1 = std::min(2 * i + 1, w0 - 1);
+				int		j0 = std::min(2 * j, h0 - 1), j1 = std::min(2 * j + 1, h0 - 1);
+
+				const vec3* T = t.texel[l - 1];
+				t.texel[l][t.w[l] * j + i] = 0.25f * (T[w0 * j0 + i0] + T[w0 * j0 + i1] + T[w0 * j1 + i0] + T[w0 * j1 + i1]);
+			}
+
+		t.nLevels++;
+	}
+
+	return true;
+}
+
+void deleteMipmapTexture(MipmapTexture& t)
+{
+	for (int l = 0; l < t.nLevels; l++)
+		delete[] t.texel[l];
+	t.nLevels = 0;
+}
+
+//bilinear lookup in a level with repeat wrapping
+inline vec3
+sampleLevel(const MipmapTexture& t, int l, float u, float v)
+{
+	int		w = t.w[l], h = t.h[l];
+	float	x = u * w - 0.5f;
+	float	y = v * h - 0.5f;
+	int		i0 = (int)floor(x), j0 = (int)floor(y);
+	float	tx = x - i0, ty = y - j0;
+
+	int		i1 = i0 + 1, j1 = j0 + 1;
+	i0 = ((i0 % w) + w) % w;	i1 = ((i1 % w) + w) % w;
+	j0 = ((j0 % h) + h) % h;	j1 = ((j1 % h) + h) % h;
+
+	const vec3* T = t.texel[l];
+	vec3	c0 = (1 - tx) * T[w * j0 + i0] + tx * T[w * j0 + i1];
+	vec3	c1 = (1 - tx) * T[w * j1 + i0] + tx * T[w * j1 + i1];
+
+	return	(1 - ty) * c0 + ty * c1;
+}
+
+//trilinear lookup at the given level of detail
+inline vec3
+sampleTexture(const MipmapTexture& t, float u, float v, float lod)
+{
+	lod = std::min(std::max(lod, 0.0f), float(t.nLevels - 1));
+
+	int		l = (int)lod;
+	float	f = lod - l;
+	if (f == 0 || l == t.nLevels - 1)	return sampleLevel(t, l, u, v);
+
+	return	(1 - f) * sampleLevel(t, l, u, v) + f * sampleLevel(t, l + 1, u, v);
+}
+
+//diffuse color of the textured sphere i at p with the normal n in the eye coordinate system
+//w is the width of the ray cone arriving at p
+vec3 sphereTextureColor(int i, const vec3& n, const Ray& ray, float w)
+{
+	const MipmapTexture& t = texture[sphereTexture[i]];
+
+	//spherical coordinates of the normal in the object coordinate system
+	vec3	n_o = normalToObject * n;
+	float	u = 0.5f + atan2(n_o.z, n_o.x) / (2 * pi<float>());
+	float	v = acos(std::min(std::max(n_o.y, -1.0f), 1.0f)) / pi<float>();
+
+	if (textureMode == TEXTURE_BASE_LEVEL) return sampleLevel(t, 0, u, v);
+
+	//footprint of the cone in texels: the cone is stretched by 1/cos at grazing angles
+	float	cosine = std::max(fabs(dot(n, normalize(ray.p1 - ray.p0))), 0.01f);
+	float	texelsPerUnit = std::max(t.w[0] / (2 * pi<float>() * radius[i]), t.h[0] / (pi<float>() * radius[i]));
+	float	footprint = w * texelsPerUnit / cosine;
+
+	return	sampleTexture(t, u, v, log2(std::max(footprint, 1.0f)));
+}
+
 //ambient intensity
 inline	vec3
 ambient(const Light& l)
@@ -165,8 +360,8 @@ ambient(const Light& l)
 	return I;
 }
 
-//ambient, diffuse, specular
-vec3 phong(const vec3& n, const vec3& v, const Light& l, const vec3& r) {
+//ambient, diffuse, specular with the diffuse reflectance kd
+vec3 phong(const vec3& n, const vec3& v, const Light& l, const vec3& r, const vec3& kd) {
 	vec3	I = ambient(l);
 
 	float	lambertian = std::max(dot(n, l.p_eye), 0.0f);
@@ -174,7 +369,7 @@ vec3 phong(const vec3& n, const vec3& v, const Light& l, const vec3& r) {
 		float	specular = pow(std::max(dot(v, r), 0.0f), m_shininess);
 
 		for (int i = 0; i < 3; i++) {
-			I[i] += m_diffuse[i] * lambertian * l.diffuse[i];
+			I[i] += kd[i] * lambertian * l.diffuse[i];
 			I[i] += m_specular[i] * specular * l.specular[i];
 		}
 	}
@@ -184,7 +379,9 @@ vec3 phong(const vec3& n, const vec3& v, const Light& l, const vec3& r) {
 
 //compute the intensity from ray using recursive ray casting
 //exclude an intersection with the object E where the ray start from
-vec3 intensity(const Ray& ray, const Light l[], int nLights, int depth, int E = -1)
+//the object and the normal at the closest intersection are returned if requested
+vec3 intensity(const Ray& ray, const Light l[], int nLights, int depth, int E = -1,
+	int* hitObject = NULL, vec3* hitNormal = NULL)
 {
 	vec3	I(0, 0, 0);		//final intensity
 
@@ -192,8 +389,19 @@ vec3 intensity(const Ray& ray, const Light l[], int nLights, int depth, int E =
 	vec3	p, n;
 	int		iObject = findIntersection(ray, p, n, E);
 
+	if (hitObject) *hitObject = iObject;
+	if (hitNormal) *hitNormal = (iObject != -1) ? n : vec3(0, 0, 0);
+
 	if (iObject != -1) //hit an object
 	{
+		//width of the ray cone at the intersection
+		float	w = ray.width + ray.spread * length(p - ray.p0);
+
+		//diffuse reflectance from the material or the texture
+		vec3	kd = m_diffuse;
+		if (textureMode != TEXTURE_OFF && sphereTexture[iObject] != -1)
+			kd = sphereTextureColor(iObject, n, ray, w);
+
 		for (int i = 0; i < nLights; i++) {
 			//shadow ray
 			vec3	p_shadow, n_shadow; //not used
@@ -208,7 +416,7 @@ vec3 intensity(const Ray& ray, const Light l[], int nLights, int depth, int E =
 				vec3	v = normalize(ray.p0 - ray.p1);			//direction to the viewer
 				vec3	r = normalize(reflect(l[i].p_eye, n));	//reflection of light
 
-				I += phong(n, v, l[i], r);
+				I += phong(n, v, l[i], r, kd);
 			}
 			else I += ambient(l[i]);		//shadowed
 		}
@@ -219,7 +427,9 @@ vec3 intensity(const Ray& ray, const Light l[], int nLights, int depth, int E =
 			//reflection ray
 			vec3	r = normalize(reflect(ray.p0 - ray.p1, n));
 			vec3	pr = p + 1.0E10f * r;		//point far away from p along r
-			Ray		recursiveRay(p, pr);
+
+			//a convex sphere of radius R widens the reflected cone by 2w/R
+			Ray		recursiveRay(p, pr, w, ray.spread + 2 * w / radius[iObject]);
 
 			vec3	I_R = intensity(recursiveRay, l, nLights, depth + 1, iObject);
 
@@ -246,6 +456,416 @@ setPixelValue(int i, int j, const vec3& I)
 	image[3 * m * j_r + 3 * i + 2] = (GLubyte)(I[2] * 255);
 }
 
+//image plane of the current frame for the primary rays
+float	x_left, y_top;		//center of the top-left pixel
+float	delta_w, delta_h;	//pixel size in the image plane
+float	dn_ray, df_ray;		//near and far distances
+
+//primary ray through the point (x, y) in pixel units, (0, 0) for the center of the top-left pixel
+//its cone covers footprint x footprint pixels
+inline Ray
+primaryRay(float x, float y, float footprint = 1)
+{
+	//position in the near plane (image plane)
+	float	x_i = x_left + delta_w * x;
+	float	y_j = y_top - delta_h * y;
+
+	//primary ray: the camera faces the negative z-axis as in OpenGL
+	vec3	s(x_i, y_j, -dn_ray);			//start point in the near plane
+	vec3	e = (df_ray / dn_ray) * s;		//end point in the far plance
+
+	//ray cone from the eye through the pixel
+	float	spread = footprint * delta_h / dn_ray;
+
+	return	Ray(s, e, spread * length(s), spread);
+}
+
+//clamping the intensity values
+inline vec3
+clampIntensity(vec3 I)
+{
+	for (int k = 0; k < 3; k++)
+		I[k] = std::min(I[k], 1.0f);
+
+	return I;
+}
+
+//ray trace the pixel (i, j) and keep its color, object and normal
+inline void
+tracePixel(int i, int j)
+{
+	int		k = m * j + i;
+
+	vec3	I = intensity(primaryRay(float(i), float(j)), light, nLights, 1, -1, &objectBuffer[k], &normalBuffer[k]);
+	colorBuffer[k] = clampIntensity(I);
+}
+
+//find only the object and the normal seen through the pixel (i, j) without shading
+inline void
+castPixel(int i, int j)
+{
+	int		k = m * j + i;
+
+	vec3	p;
+	objectBuffer[k] = findIntersection(primaryRay(float(i), float(j)), p, normalBuffer[k], -1);
+	if (objectBuffer[k] == -1) normalBuffer[k] = vec3(0, 0, 0);
+}
+
+//edge-aware weight of a neighboring sample from its object and normal
+inline float
+edgeWeight(int object, const vec3& normal, int object_k, const vec3& normal_k)
+{
+	if (object != object_k)	return 0;	//different objects or the background
+	if (object == -1)		return 1;	//both in the background
+
+	float	c = std::max(dot(normal, normal_k), 0.0f);
+	c *= c;	c *= c;	c *= c;				//cos^8 to preserve creases
+	return c;
+}
+
+//call body(j) for every row j in parallel
+//with the first touch, the static partition keeps each row on the thread that touched it first
+//the team is that of prepareThreads(), each of its threads having a scratch
+template <class Body>
+void forEachRow(int nRows, Body body)
+{
+	if (firstTouch)
+	{
+#pragma omp parallel for schedule(static, ROW_CHUNK) num_threads(nThreads) if (useOpenMP)
+		for (int j = 0; j < nRows; j++)
+			body(j);
+	}
+	else
+	{
+#pragma omp parallel for schedule(dynamic) num_threads(nThreads) if (useOpenMP)	//static, guided, auto, runtime
+		for (int j = 0; j < nRows; j++)
+			body(j);
+	}
+}
+
+//scratch of the calling thread
+inline ThreadScratch&
+threadScratch()
+{
+	return *scratch[omp_get_thread_num()];
+}
+
+void resetScratch()
+{
+	for (int t = 0; t < nThreads; t++)
+		scratch[t]->traced = scratch[t]->reconstructed = 0;
+}
+
+//pixel counts of all the threads into the statistics
+void gatherScratch()
+{
+	stats.tracedPixels = stats.reconstructedPixels = 0;
+	for (int t = 0; t < nThreads; t++)
+	{
+		stats.tracedPixels += scratch[t]->traced;
+		stats.reconstructedPixels += scratch[t]->reconstructed;
+	}
+}
+
+//checkerboard rendering: trace a half of the pixels alternating the parity every frame
+//and reconstruct the others from their 4-neighbors with the edge-aware weights
+void checkerboardTracing()
+{
+	int		parity = frame & 1;
+
+	resetScratch();
+
+	double	t0 = omp_get_wtime();
+
+	//trace the pixels of the current parity and cast primary rays for the others
+	forEachRow(n, [&](int j) {
+		ThreadScratch& S = threadScratch();
+		for (int i = 0; i < m; i++)
+		{
+			if (((i + j) & 1) == parity) { tracePixel(i, j); S.traced++; }
+			else castPixel(i, j);
+		}
+	});
+
+	double	t1 = omp_get_wtime();
+
+	//reconstruct the missing pixels
+	forEachRow(n, [&](int j) {
+		ThreadScratch& S = threadScratch();
+		for (int i = 0; i < m; i++)
+		{
+			if (((i + j) & 1) == parity) continue;
+
+			int		k = m * j + i;
+			int		neighbor[4][2] = { { i - 1, j }, { i + 1, j }, { i, j - 1 }, { i, j + 1 } };
+
+			vec3	I(0, 0, 0);
+			float	W = 0;
+			for (int q = 0; q < 4; q++)
+			{
+				int		i_q = neighbor[q][0], j_q = neighbor[q][1];
+				if (i_q < 0 || i_q >= m || j_q < 0 || j_q >= n)	continue;
+
+				int		k_q = m * j_q + i_q;
+				float	w = edgeWeight(objectBuffer[k], normalBuffer[k], objectBuffer[k_q], normalBuffer[k_q]);
+
+				I += w * colorBuffer[k_q];
+				W += w;
+			}
+
+			//no neighbor on the same surface (e.g., thin features): trace the pixel
+			if (W < 1.0e-3f) { tracePixel(i, j); S.traced++; }
+			else { colorBuffer[k] = I / W; S.reconstructed++; }
+		}
+	});
+
+	double	t2 = omp_get_wtime();
+
+	gatherScratch();
+	stats.samples = 1;
+	stats.traceTime = t1 - t0;
+	stats.reconstructTime = t2 - t1;
+}
+
+//half-resolution rendering: trace the centers of 2x2 pixel blocks
+//and upsample them with the bilateral weights from the full-resolution primary hits
+void halfResolutionTracing()
+{
+	resetScratch();
+
+	double	t0 = omp_get_wtime();
+
+	//shade the half-resolution image
+	forEachRow(n_half, [&](int j) {
+		ThreadScratch& S = threadScratch();
+		for (int i = 0; i < m_half; i++)
+		{
+			int		k = m_half * j + i;
+
+			//center of the block (2i, 2j) ~ (2i+1, 2j+1)
+			vec3	I = intensity(primaryRay(2.0f * i + 0.5f, 2.0f * j + 0.5f, 2), light, nLights, 1, -1, &halfObject[k], &halfNormal[k]);
+			halfColor[k] = clampIntensity(I);
+			S.traced++;
+		}
+	});
+
+	//primary hits in the full resolution as the guide of the upsampling
+	forEachRow(n, [&](int j) {
+		for (int i = 0; i < m; i++)
+			castPixel(i, j);
+	});
+
+	double	t1 = omp_get_wtime();
+
+	//joint bilateral upsampling
+	forEachRow(n, [&](int j) {
+		ThreadScratch& S = threadScratch();
+		for (int i = 0; i < m; i++)
+		{
+			int		k = m * j + i;
+
+			//position in the half-resolution image
+			float	x = 0.5f * i - 0.25f;
+			float	y = 0.5f * j - 0.25f;
+			int		i0 = (int)floor(x), j0 = (int)floor(y);
+			float	tx = x - i0, ty = y - j0;
+
+			vec3	I(0, 0, 0);
+			float	W = 0;
+			for (int q = 0; q < 4; q++)
+			{
+				int		i_q = std::min(std::max(i0 + (q & 1), 0), m_half - 1);
+				int		j_q = std::min(std::max(j0 + (q >> 1), 0), n_half - 1);
+				float	w_s = ((q & 1) ? tx : 1 - tx) * ((q >> 1) ? ty : 1 - ty);	//bilinear
+
+				int		k_q = m_half * j_q + i_q;
+				float	w = w_s * edgeWeight(objectBuffer[k], normalBuffer[k], halfObject[k_q], halfNormal[k_q]);
+
+				I += w * halfColor[k_q];
+				W += w;
+			}
+
+			//no half-resolution sample on the same surface: trace the pixel
+			if (W < 1.0e-3f) { tracePixel(i, j); S.traced++; }
+			else { colorBuffer[k] = I / W; S.reconstructed++; }
+		}
+	});
+
+	double	t2 = omp_get_wtime();
+
+	gatherScratch();
+	stats.samples = 1;
+	stats.traceTime = t1 - t0;
+	stats.reconstructTime = t2 - t1;
+}
+
+//counter-based random numbers: the same sample of the same pixel gets the same numbers
+//regardless of the threads, so that a resumed rendering continues exactly
+inline unsigned int
+hashRandom(unsigned int x)
+{
+	x ^= x >> 16;	x *= 0x7feb352d;
+	x ^= x >> 15;	x *= 0x846ca68b;
+	x ^= x >> 16;
+	return x;
+}
+
+inline float
+uniformRandom(unsigned int& state)
+{
+	state = hashRandom(state);
+	return (state >> 8) * (1.0f / 16777216.0f);	//[0, 1)
+}
+
+//hash of everything that affects the progressive image
+unsigned long long sceneHash()
+{
+	unsigned long long	h = HASH_SEED;
+
+	h = hashBytes(h, &m, sizeof(m));
+	h = hashBytes(h, &n, sizeof(n));
+	h = hashBytes(h, &currTime, sizeof(currTime));
+	h = hashBytes(h, &DEPTH, sizeof(DEPTH));
+	h = hashBytes(h, &textureMode, sizeof(textureMode));
+
+	h = hashBytes(h, &eye, sizeof(eye));
+	h = hashBytes(h, &up, sizeof(up));
+	h = hashBytes(h, &center, sizeof(center));
+
+	h = hashBytes(h, &nSpheres, sizeof(nSpheres));
+	h = hashBytes(h, center_world, sizeof(vec3) * nSpheres);
+	h = hashBytes(h, radius, sizeof(float) * nSpheres);
+	h = hashBytes(h, sphereTexture, sizeof(int) * nSpheres);
+
+	for (int i = 0; i < nLights; i++)
+	{
+		h = hashBytes(h, &light[i].p, sizeof(light[i].p));
+		h = hashBytes(h, &light[i].ambient, sizeof(light[i].ambient));
+		h = hashBytes(h, &light[i].diffuse, sizeof(light[i].diffuse));
+		h = hashBytes(h, &light[i].specular, sizeof(light[i].specular));
+	}
+
+	h = hashBytes(h, &m_ambient, sizeof(m_ambient));
+	h = hashBytes(h, &m_diffuse, sizeof(m_diffuse));
+	h = hashBytes(h, &m_specular, sizeof(m_specular));
+	h = hashBytes(h, &m_shininess, sizeof(m_shininess));
+	h = hashBytes(h, &I_back, sizeof(I_back));
+
+	return h;
+}
+
+//state of the progressive rendering for a checkpoint
+CheckpointHeader progressiveState()
+{
+	CheckpointHeader	header;
+	memset(&header, 0, sizeof(header));
+
+	header.sceneHash = accumHash;
+	header.m = m;	header.n = n;
+	header.nSamples = nSamples;
+	header.seed = sampleSeed;
+	header.currTime = currTime;
+	header.depth = DEPTH;
+	for (int i = 0; i < 3; i++) header.specular[i] = m_specular[i];
+	header.textureMode = textureMode;
+
+	return header;
+}
+
+//add a jittered sample to every pixel and display the average
+void progressiveTracing()
+{
+	unsigned long long	h = sceneHash();
+	if (h != accumHash || nSamples == 0)	//restart if anything has changed
+	{
+		memset(accumBuffer, 0, sizeof(float) * 3 * m * n);
+		nSamples = 0;
+		accumHash = h;
+
+		lastCheckpoint = omp_get_wtime();
+	}
+
+	double	t0 = omp_get_wtime();
+
+	forEachRow(n, [&](int j) {
+		for (int i = 0; i < m; i++)
+		{
+			int		k = m * j + i;
+
+			//random position in the pixel
+			unsigned int	state = sampleSeed ^ hashRandom(k + hashRandom(nSamples));
+			float	dx = uniformRandom(state) - 0.5f;
+			float	dy = uniformRandom(state) - 0.5f;
+
+			vec3	I = clampIntensity(intensity(primaryRay(i + dx, j + dy), light, nLights, 1));
+
+			float*	A = accumBuffer + 3 * k;
+			for (int c = 0; c < 3; c++)
+				A[c] += I[c];
+
+			setPixelValue(i, j, vec3(A[0], A[1], A[2]) / float(nSamples + 1));
+		}
+	});
+
+	nSamples++;
+
+	stats.tracedPixels = m * n;
+	stats.reconstructedPixels = 0;
+	stats.samples = nSamples;
+	stats.traceTime = omp_get_wtime() - t0;
+	stats.reconstructTime = 0;
+
+	//periodic checkpoint without stalling the tracer
+	double	now = omp_get_wtime();
+	if (now - lastCheckpoint > checkpointInterval)
+	{
+		if (writeCheckpointAsync(checkpointFile, progressiveState(), accumBuffer))
+			lastCheckpoint = now;
+	}
+}
+
+//continue the progressive rendering from a checkpoint
+bool resumeProgressive(const char* filename)
+{
+	CheckpointHeader	header;
+	float*	accum = NULL;
+	if (!readCheckpoint(filename, header, accum)) return false;
+
+	if (header.m != m || header.n != n)
+	{
+		cout << "Checkpoint of " << header.m << " x " << header.n << " can't resume in " << m << " x " << n << endl;
+		delete[] accum;
+		return false;
+	}
+
+	//restore the interactive parameters and check the rest of the scene
+	currTime = header.currTime;
+	DEPTH = header.depth;
+	for (int i = 0; i < 3; i++) m_specular[i] = header.specular[i];
+	textureMode = header.textureMode;
+
+	if (sceneHash() != header.sceneHash)
+	{
+		cout << "Checkpoint " << filename << " is of a different scene" << endl;
+		delete[] accum;
+		return false;
+	}
+
+	memcpy(accumBuffer, accum, sizeof(float) * 3 * m * n);
+	delete[] accum;
+
+	nSamples = header.nSamples;
+	sampleSeed = header.seed;
+	accumHash = header.sceneHash;
+
+	renderMode = PROGRESSIVE;
+	pause = true;
+	lastCheckpoint = omp_get_wtime();
+
+	cout << "Resumed " << filename << " at " << nSamples << " samples" << endl;
+	return true;
+}
+
 //ray tracing
 void rayTracing()
 {
@@ -273,49 +893,116 @@ void rayTracing()
 		viewModel = rotate(viewModel, radians(theta), axis);
 	}
 
+	//rigid transformation: the inverse of the rotation is its transpose
+	normalToObject = transpose(mat3(viewModel));
+
 	//perspective projection for ray tracing
 	float	fovy = 27.0; //field of view angle in degrees in the y direction (35mm lens)
-	float	dn = nearDist; //near distance from COP
-	float	df = farDist; //far distance from COP
+	dn_ray = nearDist; //near distance from COP
+	df_ray = farDist; //far distance from COP
 
 	//size of the image plane in the workspace
-	float	h = dn * tan(radians(fovy));
+	float	h = dn_ray * tan(radians(fovy));
 	float	w = h * r;
 
 	//pixel size in the image plane
-	float	delta_w = w / m;
-	float	delta_h = h / n;
+	delta_w = w / m;
+	delta_h = h / n;
 
-	//compute the intensity of each pixel in the image plane
-#pragma omp parallel for schedule(dynamic) if (useOpenMP)	//static, guided, auto, runtime
-	for (int i = 0; i < m; i++)
-		for (int j = 0; j < n; j++)
-		{
-			//position in the near plane (image plane)
-			float	x_i = (-w / 2 + delta_w / 2) + delta_w * i;
-			float	y_j = (h / 2 - delta_h / 2) - delta_h * j;
+	//center of the top-left pixel
+	x_left = -w / 2 + delta_w / 2;
+	y_top = h / 2 - delta_h / 2;
 
-			//primary ray: the camera faces the negative z-axis as in OpenGL
-			vec3	s(x_i, y_j, -dn);	//start point in the near plane
-			vec3	e = (df / dn) * s;	//end point in the far plance
+	if (renderMode == PROGRESSIVE)
+	{
+		progressiveTracing();
 
-			//compute the RGB intensities using recursive ray casting
-			vec3	I = intensity(Ray(s, e), light, nLights, 1);
+		frame++;
+		return;
+	}
+
+	if (renderMode == CHECKERBOARD || renderMode == HALF_RES)
+	{
+		if (renderMode == CHECKERBOARD)	checkerboardTracing();
+		else							halfResolutionTracing();
+
+		//store the pixel values
+		forEachRow(n, [&](int j) {
+			for (int i = 0; i < m; i++)
+				setPixelValue(i, j, colorBuffer[m * j + i]);
+		});
 
-			//clamping the intensity values
-			for (int k = 0; k < 3; k++)
-				I[k] = std::min(I[k], 1.0f);
+		frame++;
+		return;
+	}
+
+	double	t0 = omp_get_wtime();
+
+	//compute the intensity of each pixel in the image plane row by row
+	forEachRow(n, [&](int j) {
+		for (int i = 0; i < m; i++)
+		{
+			//compute the RGB intensities using recursive ray casting
+			vec3	I = intensity(primaryRay(float(i), float(j)), light, nLights, 1);
 
 			//store the pixel value
-			setPixelValue(i, j, I);
+			setPixelValue(i, j, clampIntensity(I));
 		}
-}
+	});
 
+	stats.tracedPixels = m * n;
+	stats.reconstructedPixels = 0;
+	stats.samples = 1;
+	stats.traceTime = omp_get_wtime() - t0;
+	stats.reconstructTime = 0;
+
+	frame++;
+}
 
 void deleteStorageForImage()
 {
-	if (image) delete[] image;
-	image = NULL;
+	freePages(image);			image = NULL;
+
+	freePages(colorBuffer);		colorBuffer = NULL;
+	freePages(objectBuffer);	objectBuffer = NULL;
+	freePages(normalBuffer);	normalBuffer = NULL;
+
+	freePages(halfColor);		halfColor = NULL;
+	freePages(halfObject);		halfObject = NULL;
+	freePages(halfNormal);		halfNormal = NULL;
+
+	freePages(accumBuffer);		accumBuffer = NULL;
+	nSamples = 0;
+}
+
+//clear the per-pixel buffers
+//with the first touch, every row is cleared by the thread that will write it,
+//so that its pages are placed on the NUMA node of that thread
+void clearStorageForImage()
+{
+	auto clearRow = [&](int j) {
+		memset(image + 3 * m * ((n - 1) - j), 0, 3 * m);	//upside down as in setPixelValue()
+		memset(colorBuffer + m * j, 0, sizeof(vec3) * m);
+		memset(objectBuffer + m * j, 0, sizeof(int) * m);
+		memset(normalBuffer + m * j, 0, sizeof(vec3) * m);
+		memset(accumBuffer + 3 * m * j, 0, sizeof(float) * 3 * m);
+	};
+	auto clearHalfRow = [&](int j) {
+		memset(halfColor + m_half * j, 0, sizeof(vec3) * m_half);
+		memset(halfObject + m_half * j, 0, sizeof(int) * m_half);
+		memset(halfNormal + m_half * j, 0, sizeof(vec3) * m_half);
+	};
+
+	if (firstTouch)
+	{
+		forEachRow(n, clearRow);
+		forEachRow(n_half, clearHalfRow);
+	}
+	else	//all the pages on the node of the main thread
+	{
+		for (int j = 0; j < n; j++)			clearRow(j);
+		for (int j = 0; j < n_half; j++)	clearHalfRow(j);
+	}
 }
 
 void prepareStorageForImage()
@@ -327,13 +1014,143 @@ void prepareStorageForImage()
 	cout << "Image size: " << m << " x " << n << endl;
 
 	//memory allocation for the ray-traced image
-	image = new GLubyte[m * n * 3];
+	//pages are not placed until the first touch in clearStorageForImage()
+	image = (GLubyte*)allocatePages(m * n * 3);
 	if (image == NULL)
 	{
 		cout << "Image(" << m << ", " << n << ") allocation failure!" << endl;
 		return;
 	}
 
+	//per-pixel buffers for the checkerboard and half-resolution modes
+	colorBuffer = (vec3*)allocatePages(sizeof(vec3) * m * n);
+	objectBuffer = (int*)allocatePages(sizeof(int) * m * n);
+	normalBuffer = (vec3*)allocatePages(sizeof(vec3) * m * n);
+
+	m_half = (m + 1) / 2;
+	n_half = (n + 1) / 2;
+	halfColor = (vec3*)allocatePages(sizeof(vec3) * m_half * n_half);
+	halfObject = (int*)allocatePages(sizeof(int) * m_half * n_half);
+	halfNormal = (vec3*)allocatePages(sizeof(vec3) * m_half * n_half);
+
+	//progressive rendering restarts in a new image
+	accumBuffer = (float*)allocatePages(sizeof(float) * 3 * m * n);
+	nSamples = 0;
+
+	clearStorageForImage();
+}
+
+void deleteThreadScratch()
+{
+	for (int t = 0; t < nThreads; t++)
+	{
+		freePages(scratch[t]);
+		scratch[t] = NULL;
+	}
+}
+
+//pin the threads by the placement and let each thread allocate its own scratch
+void prepareThreads()
+{
+	deleteThreadScratch();
+
+	nThreads = std::min(omp_get_max_threads(), MAX_THREADS);
+
+#pragma omp parallel num_threads(nThreads)
+	{
+		int		t = omp_get_thread_num();
+
+		pinThread(t, nThreads, threadPlacement);
+
+		scratch[t] = (ThreadScratch*)allocatePages(sizeof(ThreadScratch));
+		memset(scratch[t], 0, sizeof(ThreadScratch));	//first touch by the owner
+	}
+}
+
+//change the thread placement and the first touch of the buffers
+void setThreadPlacement(int placement, bool _firstTouch)
+{
+	threadPlacement = placement;
+	firstTouch = _firstTouch;
+
+	prepareThreads();
+	if (image) prepareStorageForImage();
+
+	rayTracingRequired = true;
+}
+
+//average time per frame for every thread placement with and without the first touch
+void benchmarkThreadPlacement()
+{
+	const int	nFrames = 10;
+
+	int		placement0 = threadPlacement;
+	bool	firstTouch0 = firstTouch;
+
+	cout << endl << "Benchmark: " << m << " x " << n << ", " << nThreads << " threads, ";
+	cout << getNumNumaNodes() << " NUMA nodes, " << renderModeName[renderMode] << endl;
+
+	double	baseline = 0;
+	for (int placement = 0; placement < N_PLACEMENTS; placement++)
+		for (int touch = 0; touch < 2; touch++)
+		{
+			setThreadPlacement(placement, touch == 1);
+
+			rayTracing();	//warming up
+
+			double	t0 = omp_get_wtime();
+			for (int i = 0; i < nFrames; i++)
+				rayTracing();
+			double	t = (omp_get_wtime() - t0) / nFrames;
+
+			if (baseline == 0) baseline = t;
+
+			cout << "  " << threadPlacementName[placement] << (touch ? " + first touch" : "");
+			cout << ": " << t * 1000 << "ms/frame, speedup = " << baseline / t << endl;
+		}
+
+	setThreadPlacement(placement0, firstTouch0);
+}
+
+//checkerboard texture as in the texture mapping example
+void loadCheckerboardTexture(MipmapTexture& t)
+{
+	const int w = 64; const int h = 64;
+	GLubyte	checkerboard[w * h];
+
+	for (int i = 0; i < w; i++)
+		for (int j = 0; j < h; j++)
+			checkerboard[w * j + i] = (((i & 0x8) == 0) ^ ((j & 0x8) == 0)) * 255;
+
+	buildMipmapTexture(t, checkerboard, w, h, 1);
+}
+
+GLubyte demonHeadImage[3 * 128 * 128] =
+{
+#include "m02_demon_image.h"
+};
+
+//raw texture file with n channels
+bool loadRawTexture(MipmapTexture& t, const char* filename, int w, int h, int n)
+{
+	//open the raw texture file
+	ifstream is(filename, ios::binary);
+	if (is.fail())
+	{
+		cout << "Can't open " << filename << endl;
+		return false;
+	}
+
+	//read all the texels
+	GLubyte* raw = new GLubyte[w * h * n];
+	is.read((char*)raw, w * h * n);
+	if (!is) cout << "Error: only " << is.gcount() << "bytes could be read!" << endl;
+
+	bool	success = buildMipmapTexture(t, raw, w, h, n);
+
+	delete[] raw;
+
+	return success;
 }
 
 //texture
@@ -347,6 +1164,23 @@ void loadRenderedImage()
 	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 }
 
+//save the ray-traced image as a binary PPM to compare it with the full-resolution one
+bool saveImage(const char* filename)
+{
+	ofstream	file(filename, ios::binary);
+	if (!file)
+	{
+		cerr << "Can't write " << filename << endl;
+		return false;
+	}
+
+	file << "P6\n" << m << " " << n << "\n255\n";
+	for (int j = n - 1; j >= 0; j--)	//top row first
+		file.write((const char*)image + 3 * m * j, 3 * m);
+
+	return file.good();
+}
+
 void init()
 {
 #pragma omp parallel
@@ -358,6 +1192,9 @@ void init()
 		}
 	}
 
+	//thread placement and per-thread scratch
+	prepareThreads();
+
 	//two directional lights in this example
 	nLights = 0;
 	light[0].p = vec4(0.5, 0.5, 0.75, 1);	//directional light
@@ -383,6 +1220,17 @@ void init()
 	center_world[nSpheres] = vec3(0, 0, r);		radius[nSpheres] = 0.5f;	nSpheres++;
 	center_world[nSpheres] = vec3(0, 0, -r);	radius[nSpheres] = 0.5f;	nSpheres++;
 
+	//textures for the spheres
+	nTextures = 0;
+	loadCheckerboardTexture(texture[nTextures++]);
+	buildMipmapTexture(texture[nTextures++], demonHeadImage, 128, 128, 3);
+	if (loadRawTexture(texture[nTextures], "m02_marble.raw", 512, 512, 3)) nTextures++;
+
+	sphereTexture[0] = nTextures - 1;	//marble if loaded
+	sphereTexture[1] = 1;	sphereTexture[3] = 1;	//demon head
+	sphereTexture[2] = 0;	sphereTexture[4] = 0;	//checkerboard
+	sphereTexture[5] = 0;
+
 	//keyboard
 	cout << endl;
 	cout << "Keyboard input: space for play/pause" << endl;
@@ -391,12 +1239,33 @@ void init()
 	cout << "Keyboard input: t for texture mapping/direct drawing" << endl;
 	cout << "Keyboard input: p for parallel computing on/off" << endl;
 	cout << "Keyboard input: [1:9] for ray tracing depth" << endl;
+	cout << "Keyboard input: r for full/checkerboard/half resolution/progressive rendering" << endl;
+	cout << "Keyboard input: m for no texture/base level/ray-cone mipmapped texture" << endl;
+	cout << "Keyboard input: s for the rendering statistics on/off" << endl;
+	cout << "Keyboard input: a for no/compact/scatter thread affinity" << endl;
+	cout << "Keyboard input: f for the NUMA first touch of the image on/off" << endl;
+	cout << "Keyboard input: b for benchmarking the thread placements" << endl;
+	cout << "Keyboard input: k for writing a checkpoint of the progressive rendering" << endl;
+	cout << "Keyboard input: w for saving the image of the current rendering mode" << endl;
 }
 
 void quit()
 {
+	//the last checkpoint of the progressive rendering
+	waitForCheckpoint();
+	if (renderMode == PROGRESSIVE && nSamples > 0)
+		writeCheckpoint(checkpointFile, progressiveState(), accumBuffer);
+
 	//delete image
 	deleteStorageForImage();
+
+	//delete the per-thread scratch
+	deleteThreadScratch();
+
+	//delete textures
+	for (int i = 0; i < nTextures; i++)
+		deleteMipmapTexture(texture[i]);
+	nTextures = 0;
 }
 
 //texture quad
@@ -414,6 +1283,16 @@ void drawTextureQuad(float aspect)
 
 int main(int argc, char* argv[])
 {
+	//-checkpoint file: checkpoint of the progressive rendering
+	//-resume: continue the progressive rendering from the checkpoint
+	bool	resume = false;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-checkpoint") == 0 && i + 1 < argc)	checkpointFile = argv[++i];
+		else if (strcmp(argv[i], "-resume") == 0)					resume = true;
+	}
+	if (resume) resumeFile = checkpointFile;
+
 	//vsync should be a 0 for precise time stepping
 	vsync = 0;
 
@@ -449,7 +1328,7 @@ int main(int argc, char* argv[])
 	float	previous = (float)glfwGetTime();
 	float	elapsed = 0;
 	while (!glfwWindowShouldClose(window)) {
-		glfwPollEvents();
+		pollEvents(window);
 
 		float	now = (float)glfwGetTime();
 		float	delta = now - previous;
@@ -483,6 +1362,9 @@ int main(int argc, char* argv[])
 			prepareStorageForImage();
 			rayTracingRequired = true;	//request for new ray tracng
 
+			//resume only in the first image
+			if (resumeFile) { resumeProgressive(resumeFile); resumeFile = NULL; }
+
 			m_prev = m;		n_prev = n;	//keep the previous size
 		}
 
@@ -490,7 +1372,16 @@ int main(int argc, char* argv[])
 		if (rayTracingRequired)
 		{
 			rayTracing();
-			rayTracingRequired = false;
+			rayTracingRequired = (renderMode == PROGRESSIVE);	//keep refining
+
+			if (profiling)
+			{
+				cout << renderModeName[renderMode] << ": traced = " << stats.tracedPixels;
+				cout << ", reconstructed = " << stats.reconstructedPixels;
+				cout << ", samples = " << stats.samples;
+				cout << ", trace = " << stats.traceTime * 1000 << "ms";
+				cout << ", reconstruct = " << stats.reconstructTime * 1000 << "ms" << endl;
+			}
 
 			if (textureMapping)		//employ texture mapping to display the ray-traced image
 			{
@@ -542,6 +1433,24 @@ void setRayTracingDepth(int depth)
 	rayTracingRequired = true;
 }
 
+//no texture/base level/ray-cone mipmapped texture
+void nextTextureMode()
+{
+	textureMode = (textureMode + 1) % N_TEXTURE_MODES;
+	cout << textureModeName[textureMode] << endl;
+
+	rayTracingRequired = true;
+}
+
+//full/checkerboard/half resolution rendering
+void nextRenderMode()
+{
+	renderMode = (renderMode + 1) % N_RENDER_MODES;
+	cout << renderModeName[renderMode] << endl;
+
+	rayTracingRequired = true;
+}
+
 void keyboard(GLFWwindow* window, int key, int scancode, int action, int mods) {
 	if (action == GLFW_PRESS || action == GLFW_REPEAT) {
 		switch (key) {
@@ -573,6 +1482,41 @@ void keyboard(GLFWwindow* window, int key, int scancode, int action, int mods) {
 			else				cout << "Direct Drawing" << endl;
 			break;
 
+			//rendering mode
+		case GLFW_KEY_R: nextRenderMode(); break;
+
+			//texture mapping on the spheres
+		case GLFW_KEY_M: nextTextureMode(); break;
+
+			//NUMA-aware thread placement
+		case GLFW_KEY_A:
+			setThreadPlacement((threadPlacement + 1) % N_PLACEMENTS, firstTouch);
+			cout << threadPlacementName[threadPlacement] << endl;
+			break;
+		case GLFW_KEY_F:
+			setThreadPlacement(threadPlacement, !firstTouch);
+			cout << "First touch " << (firstTouch ? "on" : "off") << endl;
+			break;
+		case GLFW_KEY_B: benchmarkThreadPlacement(); break;
+
+			//checkpoint of the progressive rendering
+		case GLFW_KEY_K:
+			if (renderMode == PROGRESSIVE && nSamples > 0 && writeCheckpointAsync(checkpointFile, progressiveState(), accumBuffer))
+			{
+				lastCheckpoint = omp_get_wtime();
+				cout << "Checkpoint " << checkpointFile << " at " << nSamples << " samples" << endl;
+			}
+			break;
+
+			//image for the comparison with ImageDiff
+		case GLFW_KEY_W:
+			if (saveImage(renderModeFile[renderMode]))
+				cout << renderModeName[renderMode] << " image " << renderModeFile[renderMode] << endl;
+			break;
+
+			//rendering statistics
+		case GLFW_KEY_S: profiling = !profiling; break;
+
 			//OpenMP
 		case GLFW_KEY_P: useOpenMP = !useOpenMP;
 			if (useOpenMP)	cout << "Parallel computing" << endl;
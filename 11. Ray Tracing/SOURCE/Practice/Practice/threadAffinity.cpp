@@ -0,0 +1,214 @@
+#include "threadAffinity.h"
+
+#include <vector>
+#include <map>
+#include <mutex>
+#include <iostream>
+using namespace std;
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <stdio.h>
+#endif
+
+const char* threadPlacementName[N_PLACEMENTS] = { "No affinity", "Compact", "Scatter" };
+
+//processors of each NUMA node
+struct Processor
+{
+	int		group;	//processor group on Windows, 0 otherwise
+	int		index;	//processor number in the group
+};
+static vector<vector<Processor>> nodes;
+
+#if defined(_WIN32)
+static void queryTopology()
+{
+	ULONG	highest = 0;
+	if (!GetNumaHighestNodeNumber(&highest)) highest = 0;
+
+	for (USHORT node = 0; node <= highest; node++)
+	{
+		GROUP_AFFINITY	ga;
+		if (!GetNumaNodeProcessorMaskEx(node, &ga) || ga.Mask == 0) continue;
+
+		vector<Processor>	processors;
+		for (int i = 0; i < 8 * (int)sizeof(KAFFINITY); i++)
+			if (ga.Mask & ((KAFFINITY)1 << i)) processors.push_back({ ga.Group, i });
+
+		nodes.push_back(processors);
+	}
+}
+#else
+//parse a cpulist such as "0-15,32-47"
+static void parseCpuList(const char* list, vector<Processor>& processors)
+{
+	int		a, b, k;
+	while (sscanf(list, "%d%n", &a, &k) == 1)
+	{
+		list += k;
+		b = a;
+		if (*list == '-' && sscanf(list + 1, "%d%n", &b, &k) == 1) list += 1 + k;
+
+		for (int i = a; i <= b; i++)
+			processors.push_back({ 0, i });
+
+		if (*list != ',') break;
+		list++;
+	}
+}
+
+static void queryTopology()
+{
+	for (int node = 0; ; node++)
+	{
+		char	filename[256];
+		snprintf(filename, sizeof(filename), "/sys/devices/system/node/node%d/cpulist", node);
+
+		FILE*	fp = fopen(filename, "r");
+		if (fp == NULL) break;
+
+		char	list[4096] = "";
+		if (fgets(list, sizeof(list), fp) == NULL) list[0] = 0;
+		fclose(fp);
+
+		vector<Processor>	processors;
+		parseCpuList(list, processors);
+		if (!processors.empty()) nodes.push_back(processors);
+	}
+}
+#endif
+
+static void initializeTopology()
+{
+	if (!nodes.empty()) return;
+
+	queryTopology();
+
+	//no NUMA information: a single node of all the processors
+	if (nodes.empty())
+	{
+#if defined(_WIN32)
+		SYSTEM_INFO	info;
+		GetSystemInfo(&info);
+		int		nProcessors = (int)info.dwNumberOfProcessors;
+#else
+		int		nProcessors = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+		vector<Processor>	processors;
+		for (int i = 0; i < nProcessors; i++)
+			processors.push_back({ 0, i });
+		nodes.push_back(processors);
+	}
+
+	cout << "NUMA nodes = " << nodes.size() << ":";
+	for (size_t i = 0; i < nodes.size(); i++)
+		cout << " " << nodes[i].size();
+	cout << " processors" << endl;
+}
+
+int getNumNumaNodes()
+{
+#pragma omp critical(topology)
+	initializeTopology();
+
+	return (int)nodes.size();
+}
+
+bool pinThread(int t, int nThreads, int placement)
+{
+	getNumNumaNodes();
+
+	int		nNodes = (int)nodes.size();
+	int		nProcessors = 0;
+	for (int i = 0; i < nNodes; i++)
+		nProcessors += (int)nodes[i].size();
+
+	Processor	p = { 0, 0 };
+	if (placement == PLACEMENT_COMPACT)
+	{
+		int		k = t % nProcessors;
+		for (int i = 0; i < nNodes; i++)
+		{
+			if (k < (int)nodes[i].size()) { p = nodes[i][k]; break; }
+			k -= (int)nodes[i].size();
+		}
+	}
+	else if (placement == PLACEMENT_SCATTER)
+	{
+		const vector<Processor>& node = nodes[t % nNodes];
+		p = node[(t / nNodes) % node.size()];
+	}
+
+#if defined(_WIN32)
+	if (placement == PLACEMENT_NONE)
+	{
+		DWORD_PTR	processMask, systemMask;
+		if (!GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask)) return false;
+		return SetThreadAffinityMask(GetCurrentThread(), processMask) != 0;
+	}
+
+	GROUP_AFFINITY	ga;
+	ZeroMemory(&ga, sizeof(ga));
+	ga.Group = (WORD)p.group;
+	ga.Mask = (KAFFINITY)1 << p.index;
+	return SetThreadGroupAffinity(GetCurrentThread(), &ga, NULL) != 0;
+#else
+	cpu_set_t	cpus;
+	CPU_ZERO(&cpus);
+	if (placement == PLACEMENT_NONE)
+	{
+		for (int i = 0; i < nNodes; i++)
+			for (size_t k = 0; k < nodes[i].size(); k++)
+				CPU_SET(nodes[i][k].index, &cpus);
+	}
+	else CPU_SET(p.index, &cpus);
+
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+#endif
+}
+
+#if !defined(_WIN32)
+//sizes of the mappings for munmap(), kept aside rather than in the mapping
+//as a header written by the allocating thread would place its first page on that thread's node
+static map<void*, size_t>	mappingSize;
+static mutex	mappingLock;
+#endif
+
+void* allocatePages(size_t size)
+{
+#if defined(_WIN32)
+	return VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+	void*	p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (p == MAP_FAILED) return NULL;
+
+	lock_guard<mutex>	lock(mappingLock);
+	mappingSize[p] = size;
+	return p;
+#endif
+}
+
+void freePages(void* p)
+{
+	if (p == NULL) return;
+
+#if defined(_WIN32)
+	VirtualFree(p, 0, MEM_RELEASE);
+#else
+	size_t	size;
+	{
+		lock_guard<mutex>	lock(mappingLock);
+		auto	m = mappingSize.find(p);
+		if (m == mappingSize.end()) return;
+		size = m->second;
+		mappingSize.erase(m);
+	}
+	munmap(p, size);
+#endif
+}
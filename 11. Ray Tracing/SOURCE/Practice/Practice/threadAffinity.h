@@ -0,0 +1,21 @@
+#ifndef __THREAD_AFFINITY_H_
+#define __THREAD_AFFINITY_H_
+
+#include <stddef.h>
+
+//placement of the threads on the processors of the NUMA nodes
+//compact fills the processors of a node before the next one
+//scatter assigns the threads to the nodes in a round-robin fashion
+enum ThreadPlacement { PLACEMENT_NONE = 0, PLACEMENT_COMPACT, PLACEMENT_SCATTER, N_PLACEMENTS };
+extern const char* threadPlacementName[N_PLACEMENTS];
+
+int getNumNumaNodes();
+
+//pin the calling thread t of nThreads by the placement, or unpin it for PLACEMENT_NONE
+bool pinThread(int t, int nThreads, int placement);
+
+//memory pages committed on the first write, i.e., on the NUMA node of the first thread to touch them
+void* allocatePages(size_t size);
+void freePages(void* p);
+
+#endif
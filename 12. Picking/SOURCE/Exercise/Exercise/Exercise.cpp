@@ -1,4 +1,5 @@
 #include "glSetup.h"
+#include "quadricCache.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -78,7 +79,7 @@ int main(int argc, char* argv[]) {
 	init();
 
 	while (!glfwWindowShouldClose(window)) {
-		glfwPollEvents();
+		pollEvents(window);
 
 		render(window);				//draw one frame
 		glfwSwapBuffers(window);
@@ -92,19 +93,8 @@ int main(int argc, char* argv[]) {
 	return 0;
 }
 
-//sphere
-GLUquadric* sphere = NULL;
-
 void init()
 {
-	//prepare quadric shapes
-	sphere = gluNewQuadric();
-	gluQuadricDrawStyle(sphere, GLU_FILL);
-	gluQuadricNormals(sphere, GLU_SMOOTH);
-	gluQuadricOrientation(sphere, GLU_OUTSIDE);
-	gluQuadricTexture(sphere, GLU_FALSE);
-
-
 	//keyboard
 	cout << endl;
 	cout << "Keyboard Input : x for axes on/off" << endl;
@@ -114,8 +104,8 @@ void init()
 
 void quit()
 {
-	//delete quadric shapes
-	gluDeleteQuadric(sphere);
+	//delete the tessellations of the quadric shapes
+	deleteQuadricCache();
 }
 
 //material
@@ -132,10 +122,10 @@ void setupColoredMaterial(const vec3& color) {
 	glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, mat_shininess);
 }
 
-// draw objects using a GLU quadric
+// draw a sphere using a GLU quadric tessellated once per slices and stacks
 void drawSphere(float radius, int slices, int stacks)
 {
-	gluSphere(sphere, radius, slices, stacks);
+	drawQuadricSphere(radius, slices, stacks);
 }
 
 //light
@@ -1,11 +1,17 @@
+#include <GL/glew.h>
 #include "glSetup.h"
+#include "mesh.h"
+#include "meshGL.h"
+#include "quadricCache.h"
 
 #include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>	// translate()
 #include <glm/gtc/type_ptr.hpp>
 using namespace glm;
 
 #include <iostream>
 #include <fstream>
+#include <vector>
 using namespace std;
 
 void init();
@@ -43,8 +49,22 @@ int view = 1; // Top, front, bird-eye view
 // Picking
 int picked = -1;
 
+// Grid of gridSize x gridSize spheres in the extent of the 3x3 ones, drawn instanced if supported
+int gridSize = 3;
+bool instanced = true;
+vector<InstanceGL> grid;
+InstancesGL gridGL;
+int gridPicked = -1; // Picked object of the uploaded instances
+
+// Sphere mesh of the instanced grid tessellated by the size of the spheres on screen
+MeshGL sphereGL;
+int sphereGLSlices = 0;
+
 int main(int argc, char* argv[])
 {
+	// Size of the grid, e.g., 100 for 100x100 spheres
+	if (argc > 1) gridSize = std::max(atoi(argv[1]), 1);
+
 	// Field of view of 85mm lens in degree
 	fovy = 16.1f;
 
@@ -52,6 +72,14 @@ int main(int argc, char* argv[])
 	GLFWwindow* window = initializeOpenGL(argc, argv, bgColor);
 	if (window == NULL) return -1;
 
+	// GLEW for the instanced drawing
+	GLenum error = glewInit();
+	if (error != GLEW_OK)
+	{
+		cerr << "ERROR: " << glewGetErrorString(error) << endl;
+		return -1;
+	}
+
 	// Callbacks
 	glfwSetKeyCallback(window, keyboard);
 	glfwSetMouseButtonCallback(window, mouseButton);
@@ -71,7 +99,7 @@ int main(int argc, char* argv[])
 	// Main loop
 	while (!glfwWindowShouldClose(window))
 	{
-		glfwPollEvents(); // Events
+		pollEvents(window); // Events
 
 		render(window); // Draw one frame
 		glfwSwapBuffers(window); // Swap buffers
@@ -87,31 +115,26 @@ int main(int argc, char* argv[])
 	return 0;
 }
 
-// Sphere
-GLUquadricObj* sphere = NULL;
-
 void
 init()
 {
-	// Prepare quadric shapes
-	sphere = gluNewQuadric();
-	gluQuadricDrawStyle(sphere, GLU_FILL);
-	gluQuadricNormals(sphere, GLU_SMOOTH);
-	gluQuadricOrientation(sphere, GLU_OUTSIDE);
-	gluQuadricTexture(sphere, GL_FALSE);
-
 	// Usage
 	cout << endl;
 	cout << "Keyboard input: x for axes on/off" << endl;
 	cout << "Keyboard input: v for the top, front, bird-eye view" << endl;
-	cout << "Mouse button down: Select an object" << endl;
+	cout << "Keyboard input: n for instanced drawing on/off" << endl;
+	cout << "Mouse button down: Select an object among " << gridSize << "x" << gridSize << " spheres" << endl;
 }
 
 void 
 quit()
 {
-	// Delete quadric shapes
-	gluDeleteQuadric(sphere);
+	// Delete the tessellations of the quadric shapes
+	deleteQuadricCache();
+
+	// Delete the instances
+	deleteInstancesGL(gridGL);
+	deleteMeshGL(sphereGL);
 }
 
 // Material
@@ -130,13 +153,6 @@ setupColoredMaterial(const vec3& color)
 	glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, mat_shininess);
 }
 
-// Draw a sphere using a GLU quadric
-void 
-drawSphere(float radius, int slices, int stacks)
-{
-	gluSphere(sphere, radius, slices, stacks);
-}
-
 // Light
 void 
 setupLight(const vec4& p)
@@ -151,6 +167,61 @@ setupLight(const vec4& p)
 	glLightfv(GL_LIGHT0, GL_POSITION, value_ptr(p));
 }
 
+// Sphere mesh tessellated by its size on screen at the origin of the current modelview matrix
+const MeshGL&
+sphereMeshGL(float radius)
+{
+	int slices = sphereSlices(radius, currentPixelsPerUnit());
+	if (slices != sphereGLSlices)
+	{
+		Mesh sphere;
+		createSphereMesh(sphere, radius, slices, slices / 2);
+		deleteMeshGL(sphereGL);
+		createMeshGL(sphere, sphereGL);
+		deleteMesh(sphere);
+
+		sphereGLSlices = slices;
+	}
+	return sphereGL;
+}
+
+// Position of the sphere in the i-th row and j-th column of the grid
+vec3
+gridPosition(int i, int j)
+{
+	float c = (gridSize - 1) / 2.0f;
+	return vec3((j - c) * 4.0f, (c - i) * 2.0f, 0);
+}
+
+// Draw all the spheres in a single call, the selected one with the second material
+void
+drawGridInstanced()
+{
+	// Instances uploaded again only when the selection changes
+	if (grid.empty() || gridPicked != picked)
+	{
+		grid.resize(gridSize * gridSize);
+		for (int i = 0; i < gridSize; i++)
+			for (int j = 0; j < gridSize; j++)
+			{
+				InstanceGL& instance = grid[gridSize * i + j];
+				instance.model = translate(mat4(1.0), gridPosition(i, j));
+				instance.material = (picked == (gridSize * i + j)) ? 1.0f : 0.0f;
+			}
+		uploadInstancesGL(grid.data(), (int)grid.size(), gridGL);
+		gridPicked = picked;
+	}
+
+	// Materials
+	MaterialGL materials[2];
+	setupColoredMaterial(vec3(1, 1, 1)); // Non-selected
+	materials[0] = currentMaterialGL();
+	setupColoredMaterial(vec3(0, 0, 1)); // Selected
+	materials[1] = currentMaterialGL();
+
+	drawSmoothMeshGL(sphereMeshGL(0.7f), gridGL, materials, 2);
+}
+
 void 
 render(GLFWwindow* window)
 {
@@ -195,38 +266,40 @@ render(GLFWwindow* window)
 
 	// Draw objects
 	//
-	// 3x3 spheres or bunnies
-	glScalef(0.4f, 0.4f, 0.4f);
+	// gridSize x gridSize spheres scaled to the extent of the 3x3 ones
+	float s = 1.2f / gridSize;
+	glScalef(s, s, s);
 
-	vec3 u[3];  // y-axis
-	vec3 v[3];  // x-axis
-	u[0] = vec3(0, 1, 0) * 2.0f;  u[1] = vec3(0, 0, 0); u[2] = -u[0];
-	v[0] = -vec3(1, 0, 0) * 4.0f; v[1] = vec3(0, 0, 0); v[2] = -v[0];
+	// Selection needs the name of each sphere, drawn one by one
+	GLint renderMode;
+	glGetIntegerv(GL_RENDER_MODE, &renderMode);
 
-	for (int i = 0; i < 3; i++)
+	if (instanced && renderMode == GL_RENDER && instancingSupported())
 	{
-		glPushMatrix();
-		glTranslatef(u[i].x, u[i].y, u[i].z);
+		drawGridInstanced();
+		return;
+	}
 
-		for (int j = 0; j < 3; j++)
+	for (int i = 0; i < gridSize; i++)
+		for (int j = 0; j < gridSize; j++)
 		{
 			glPushMatrix();
-			glTranslatef(v[j].x, v[j].y, v[j].z);
+
+			vec3 p = gridPosition(i, j);
+			glTranslatef(p.x, p.y, p.z);
 
 			// Material
-			if (picked == (3 * i + j)) setupColoredMaterial(vec3(0, 0, 1)); // Selected
+			if (picked == (gridSize * i + j)) setupColoredMaterial(vec3(0, 0, 1)); // Selected
 			else setupColoredMaterial(vec3(1, 1, 1)); // Non-selected
 
 			// Picking
-			glLoadName(3 * i + j); // Replace the name for the i-th row, j-th column
+			glLoadName(gridSize * i + j); // Replace the name for the i-th row, j-th column
 
-			// Draw a sphere
-			drawSphere(0.7f, 64, 64);
+			// Draw a sphere tessellated by its size on screen
+			drawQuadricSphereLOD(0.7f);
 
 			glPopMatrix();
 		}
-		glPopMatrix();
-	}
 }
 
 void
@@ -245,6 +318,13 @@ keyboard(GLFWwindow* window, int key, int scancode, int action, int mods)
 
 			// Top, front, bird-eye view
 		case GLFW_KEY_V: view = (view + 1) % 3; break;
+
+			// Instanced drawing on/off
+		case GLFW_KEY_N:
+			instanced = !instanced;
+			if (instanced && !instancingSupported()) cout << "Instanced drawing is not supported" << endl;
+			else cout << "Instanced drawing " << (instanced ? "on" : "off") << endl;
+			break;
 		}
 	}
 }
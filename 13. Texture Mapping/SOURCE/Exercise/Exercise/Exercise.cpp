@@ -88,7 +88,7 @@ int main(int argc, char* argv[])
 	float elapsed = 0;
 	while (!glfwWindowShouldClose(window))
 	{
-		glfwPollEvents();
+		pollEvents(window);
 
 		// Time passed during a single loop
 		float now = (float)glfwGetTime();
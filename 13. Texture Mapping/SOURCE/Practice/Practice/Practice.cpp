@@ -1,5 +1,6 @@
 #include <GL/glew.h>
 #include "glSetup.h"
+#include "assetLoader.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -115,7 +116,7 @@ int main(int argc, char* argv[])
 	float elapsed = 0;
 	while (!glfwWindowShouldClose(window))
 	{
-		glfwPollEvents();
+		pollEvents(window);
 
 		// Time passed during a single loop
 		float now = (float)glfwGetTime();
@@ -194,33 +195,22 @@ void loadDemonHeadTexture()
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 }
 
-bool loadRawTexture(const char* filename, int w, int h, int n)
+// Upload an image read by the asset loader
+bool loadRawTexture(const Image& image)
 {
-	// Open the raw texture file
-	ifstream is(filename, ios::binary);
-	if (is.fail())
-	{
-		cout << "Can't open " << filename << endl;
-		return false;
-	}
-
-	// Allocate memory
-	GLubyte* raw = new GLubyte[w * h * n];
-
-	// Read all the texels
-	is.read((char*)raw, w * h * n);
-	if (!is) cout << "Error: only " << is.gcount() << "bytes could be read!" << endl;
+	if (image.texel == NULL) return false;
 
 	// Only 3 and 1
-	if (n == 3)
+	int w = image.width, h = image.height;
+	if (image.nChannels == 3)
 	{
 		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB8, w, h, 0,
-			GL_RGB, GL_UNSIGNED_BYTE, raw);
+			GL_RGB, GL_UNSIGNED_BYTE, image.texel);
 	}
-	else if (n == 1)
+	else if (image.nChannels == 1)
 	{
 		glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE8, w, h, 0,
-			GL_LUMINANCE, GL_UNSIGNED_BYTE, raw);
+			GL_LUMINANCE, GL_UNSIGNED_BYTE, image.texel);
 	}
 	else
 	{
@@ -232,9 +222,6 @@ bool loadRawTexture(const char* filename, int w, int h, int n)
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-	// Deallocate memory
-	delete[] raw;
-
 	return true;
 }
 
@@ -301,6 +288,12 @@ void turnForwardDirection(float degree)
 
 void init()
 {
+	// Read the raw images at once on worker threads while the others are generated
+	AssetLoader loader;
+	Image marble = Image(), logo = Image();
+	loadRawImageAsync(loader, "m02_marble.raw", 512, 512, 3, marble);
+	loadRawImageAsync(loader, "m02_logo.raw", 512, 512, 1, logo);
+
 	// Forward and backward direction for naviagtion
 	computeMovementDirections();
 
@@ -319,11 +312,16 @@ void init()
 	loadDemonHeadTexture();
 
 	// Raw texture
+	waitAssets(loader);
+
 	glBindTexture(GL_TEXTURE_2D, texID[2]);
-	loadRawTexture("m02_marble.raw", 512, 512, 3);
+	loadRawTexture(marble);
 
 	glBindTexture(GL_TEXTURE_2D, texID[3]);
-	loadRawTexture("m02_logo.raw", 512, 512, 1);
+	loadRawTexture(logo);
+
+	deleteImage(marble);
+	deleteImage(logo);
 
 	// Keyboard
 	cout << endl;
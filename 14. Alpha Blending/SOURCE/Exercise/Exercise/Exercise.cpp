@@ -82,7 +82,7 @@ int main(int argc, char* argv[])
 	float elapsed = 0;
 	while (!glfwWindowShouldClose(window))
 	{
-		glfwPollEvents(); //Events
+		pollEvents(window); //Events
 
 		// Time passed during a single loop
 		float now = (float)glfwGetTime();
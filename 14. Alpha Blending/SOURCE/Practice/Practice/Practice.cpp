@@ -1,4 +1,8 @@
+#include <GL/glew.h>
 #include "glSetup.h"
+#include "mesh.h"
+#include "meshGL.h"
+#include "assetLoader.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -13,8 +17,12 @@ void	quit();
 void	render(GLFWwindow* window);
 void	keyboard(GLFWwindow* window, int key, int code, int action, int mods);
 
-bool	readMesh(const char* filename);
-void	deleteMesh();
+void	prepareDepthSortData();
+void	deleteDepthSortData();
+
+//mesh read from an OFF file and its vertex/index buffers
+Mesh	mesh;
+MeshGL	meshGL;
 
 // camera configuation
 vec3	eye(0, 0, 3);
@@ -62,6 +70,14 @@ int main(int argc, char* argv[])
 	GLFWwindow* window = initializeOpenGL(argc, argv, bgColor);
 	if (window == NULL) return -1;
 
+	//GLEW for the vertex and index buffers
+	GLenum	error = glewInit();
+	if (error != GLEW_OK)
+	{
+		cerr << "ERROR: " << glewGetErrorString(error) << endl;
+		return -1;
+	}
+
 
 	// Callbacks
 	glfwSetKeyCallback(window, keyboard);
@@ -84,7 +100,7 @@ int main(int argc, char* argv[])
 	float elapsed = 0;
 	while (!glfwWindowShouldClose(window))
 	{
-		glfwPollEvents();
+		pollEvents(window);
 
 		// Time passed during a single loop
 		float now = (float)glfwGetTime();
@@ -142,38 +158,30 @@ void loadCheckerboardTexture()
 	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 }
 
-bool loadAlphaTexture(const char* filename, int w, int h)
+//upload a single channel image read by the asset loader as the alpha
+bool loadAlphaTexture(const Image& image)
 {
-	// Open the raw texture file
-	ifstream is(filename, ios::binary);
-	if (is.fail())
-	{
-		cout << "Can't open " << filename << endl;
-		return false;
-	}
-
-	// Allocate memory
-	GLubyte* raw = new GLubyte[w * h];
-
-	// Read all the texels
-	is.read((char*)raw, w * h);
-	if (!is) cout << "Error: only " << is.gcount() << "bytes could be read!" << endl;
+	if (image.texel == NULL) return false;
 
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w, h, 0, GL_ALPHA, GL_UNSIGNED_BYTE, raw);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, image.width, image.height, 0, GL_ALPHA, GL_UNSIGNED_BYTE, image.texel);
 
 	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
 	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
 	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 
-	// Deallocate memory
-	delete[] raw;
-
 	return true;
 }
 
 void init()
 {
+	//read the images and the mesh at once on worker threads, uploaded below once loaded
+	AssetLoader	loader;
+	Image		logo = Image(), ornament = Image();
+	loadRawImageAsync(loader, "m02_logo.raw", 512, 512, 1, logo);
+	loadRawImageAsync(loader, "m02_grayscale_ornament.raw", 512, 512, 1, ornament);
+	loadMeshAsync(loader, "m01_bunny.off", mesh);
+
 	//gemerate 7 textures and bind appropriate images
 	glGenTextures(7, texID);
 
@@ -181,45 +189,51 @@ void init()
 	glBindTexture(GL_TEXTURE_2D, texID[0]);
 	loadCheckerboardTexture();
 
+	waitAssets(loader);
+
 	//raw texture
 	glBindTexture(GL_TEXTURE_2D, texID[1]);
 	glPixelTransferf(GL_RED_BIAS, 1.0);
 	glPixelTransferf(GL_GREEN_BIAS, 0.0);
 	glPixelTransferf(GL_BLUE_BIAS, 0.0);
-	loadAlphaTexture("m02_logo.raw", 512, 512);
+	loadAlphaTexture(logo);
 
 	glBindTexture(GL_TEXTURE_2D, texID[2]);
 	glPixelTransferf(GL_RED_BIAS, 0.0);
 	glPixelTransferf(GL_GREEN_BIAS, 1.0);
 	glPixelTransferf(GL_BLUE_BIAS, 0.0);
-	loadAlphaTexture("m02_logo.raw", 512, 512);
+	loadAlphaTexture(logo);
 
 	glBindTexture(GL_TEXTURE_2D, texID[3]);
 	glPixelTransferf(GL_RED_BIAS, 0.0);
 	glPixelTransferf(GL_GREEN_BIAS, 0.0);
 	glPixelTransferf(GL_BLUE_BIAS, 1.0);
-	loadAlphaTexture("m02_logo.raw", 512, 512);
+	loadAlphaTexture(logo);
 
 	glBindTexture(GL_TEXTURE_2D, texID[4]);
 	glPixelTransferf(GL_RED_BIAS, 1.0);
 	glPixelTransferf(GL_GREEN_BIAS, 0.0);
 	glPixelTransferf(GL_BLUE_BIAS, 0.0);
-	loadAlphaTexture("m02_grayscale_ornament.raw", 512, 512);
+	loadAlphaTexture(ornament);
 
 	glBindTexture(GL_TEXTURE_2D, texID[5]);
 	glPixelTransferf(GL_RED_BIAS, 0.0);
 	glPixelTransferf(GL_GREEN_BIAS, 1.0);
 	glPixelTransferf(GL_BLUE_BIAS, 0.0);
-	loadAlphaTexture("m02_grayscale_ornament.raw", 512, 512);
+	loadAlphaTexture(ornament);
 
 	glBindTexture(GL_TEXTURE_2D, texID[6]);
 	glPixelTransferf(GL_RED_BIAS, 0.0);
 	glPixelTransferf(GL_GREEN_BIAS, 0.0);
 	glPixelTransferf(GL_BLUE_BIAS, 1.0);
-	loadAlphaTexture("m02_grayscale_ornament.raw", 512, 512);
+	loadAlphaTexture(ornament);
+
+	deleteImage(logo);
+	deleteImage(ornament);
 
 	//prepare mesh
-	readMesh("m01_bunny.off");
+	createMeshGL(mesh, meshGL);
+	prepareDepthSortData();
 
 	//keyboard
 	cout << endl;
@@ -237,7 +251,9 @@ void init()
 
 void quit() {
 	//delete mesh
-	deleteMesh();
+	deleteMeshGL(meshGL);
+	deleteMesh(mesh);
+	deleteDepthSortData();
 }
 
 // Material
@@ -328,14 +344,6 @@ void drawTexturedCube()
 	}
 }
 
-//read a mesh from a given OFF file
-int		nVertices = 0, nFaces = 0, nEdges = 0;
-glm::vec3* vertex = NULL;
-glm::vec3* vnormal = NULL; //vetex normal
-glm::vec3* fnormal = NULL; //face normal
-int* face[3] = { NULL, NULL, NULL };
-
-
 struct DepthSortData
 {
 	int		i;		//face index
@@ -344,105 +352,28 @@ struct DepthSortData
 };
 DepthSortData* fdsd = NULL;
 
-bool readMesh(const char* filename) {
-	ifstream	is(filename);
-	if (is.fail()) return false;
-
-	char	magicNumber[256];
-	is >> magicNumber;
-
-	// # vertices, # faces, # edges
-	is >> nVertices >> nFaces >> nEdges;
-	cout << "# vertices = " << nVertices << endl;
-	cout << "# faces = " << nFaces << endl;
-
-	//vertices
-	vertex = new vec3[nVertices];
-	for (int i = 0; i < nVertices; i++)
-		is >> vertex[i].x >> vertex[i].y >> vertex[i].z;
-
-	//vertex normals
-	vnormal = new glm::vec3[nVertices];
-	for (int i = 0; i < nVertices; i++)
-		vnormal[i] = glm::vec3(0, 0, 0);
-
-	//face normals
-	fnormal = new glm::vec3[nFaces];
-
-	//faces
-	face[0] = new int[nFaces]; //only support triangles
-	face[1] = new int[nFaces];
-	face[2] = new int[nFaces];
-
-	//depth sort data
-	fdsd = new DepthSortData[nFaces];
-
-	int n;
-	vec3	center;
-	for (int i = 0; i < nFaces; i++) {
-		is >> n >> face[0][i] >> face[1][i] >> face[2][i];
-		if (n != 3) cout << "# vertices of the " << i << "-th faces = " << n << endl;
-
-		//normal vector of the face
-		glm::vec3	v1 = vertex[face[1][i]] - vertex[face[0][i]];
-		glm::vec3	v2 = vertex[face[2][i]] - vertex[face[0][i]];
-		glm::vec3	v = normalize(cross(v1, v2));
-
-		fnormal[i] = v;
-
-		//add it to the normal vector of each vertex
-		vnormal[face[0][i]] += v;
-		vnormal[face[1][i]] += v;
-		vnormal[face[2][i]] += v;
-
-		//depth sorting data
-		center = vertex[face[0][i]] / 3.0f;
-		center += vertex[face[1][i]] / 3.0f;
-		center += vertex[face[2][i]] / 3.0f;
+//depth sorting data with the face centers
+void prepareDepthSortData() {
+	fdsd = new DepthSortData[mesh.nFaces];
 
+	for (int i = 0; i < mesh.nFaces; i++) {
 		fdsd[i].i = i;
-		fdsd[i].center = vec4(center, 1.0f);
+		fdsd[i].center = vec4(mesh.fcenter[i], 1.0f);
 	}
-
-	//normalization of the normal vectors
-	for (int i = 0; i < nVertices; i++)
-		vnormal[i] = normalize(vnormal[i]);
-
-	return true;
 }
 
-//delete the vertices and faces of the mesh
-void deleteMesh() {
-	if (vertex) { delete[] vertex; vertex = NULL; }
-	if (vnormal) { delete[] vnormal; vnormal = NULL; }
-	if (fnormal) { delete[] fnormal; fnormal = NULL; }
-	if (face[0]) { delete[] face[0]; face[0] = NULL; }
-	if (face[1]) { delete[] face[1]; face[1] = NULL; }
-	if (face[2]) { delete[] face[2]; face[2] = NULL; }
+void deleteDepthSortData() {
 	if (fdsd) { delete[] fdsd; fdsd = NULL; }
 }
 
 //draw a flat mesh by specifying its face normal vectors
 void drawFlatMesh() {
-	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < nFaces; i++) {
-		glNormal3fv(value_ptr(fnormal[i]));
-		for (int j = 0; j < 3; j++)
-			glVertex3fv(value_ptr(vertex[face[j][i]]));
-	}
-	glEnd();
+	drawFlatMeshGL(meshGL);
 }
 
 //draw a smooth mesh by specifying its vertex normal vectors
 void drawSmoothMesh() {
-	//glShadeModel(GL_SMOOTH);//ӽ
-	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < nFaces; i++)
-		for (int j = 0; j < 3; j++) {
-			glNormal3fv(value_ptr(vnormal[face[j][i]]));
-			glVertex3fv(value_ptr(vertex[face[j][i]]));
-		}
-	glEnd();
+	drawSmoothMeshGL(meshGL);
 }
 
 //decreasing order to draw the farther faces first
@@ -468,7 +399,7 @@ void sortMeshFace()
 	mat4	M = make_mat4(modelView);
 
 	//depth of every face
-	for (int i = 0; i < nFaces; i++)
+	for (int i = 0; i < mesh.nFaces; i++)
 	{
 		//face center in the eye coordinate system
 		vec4	center_eye = M * fdsd[i].center;
@@ -478,7 +409,7 @@ void sortMeshFace()
 	}
 
 	//depth sorting
-	qsort(fdsd, nFaces, sizeof(DepthSortData), compare);
+	qsort(fdsd, mesh.nFaces, sizeof(DepthSortData), compare);
 }
 
 //draw a flat mesh with depth sorting
@@ -489,13 +420,13 @@ void drawSortedFlatMesh()
 
 	//geometry
 	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < nFaces; i++)
+	for (int i = 0; i < mesh.nFaces; i++)
 	{
 		int iFace = fdsd[i].i;
 
-		glNormal3fv(value_ptr(fnormal[iFace]));
+		glNormal3fv(value_ptr(mesh.fnormal[iFace]));
 		for (int j = 0; j < 3; j++)
-			glVertex3fv(value_ptr(vertex[face[j][iFace]]));
+			glVertex3fv(value_ptr(mesh.vertex[mesh.face[iFace][j]]));
 	}
 	glEnd();
 }
@@ -507,12 +438,12 @@ void drawSortedSmoothMesh() {
 
 	//geometry
 	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < nFaces; i++)
+	for (int i = 0; i < mesh.nFaces; i++)
 		for (int j = 0; j < 3; j++) {
 			int		iFace = fdsd[i].i;
 
-			glNormal3fv(value_ptr(vnormal[face[j][iFace]]));
-			glVertex3fv(value_ptr(vertex[face[j][iFace]]));
+			glNormal3fv(value_ptr(mesh.vnormal[mesh.face[iFace][j]]));
+			glVertex3fv(value_ptr(mesh.vertex[mesh.face[iFace][j]]));
 		}
 	glEnd();
 }
@@ -0,0 +1,39 @@
+#include "assetLoader.h"
+
+#include <iostream>
+using namespace std;
+
+shared_future<bool> loadRawImageAsync(AssetLoader& loader, const char* filename, int width, int height, int nChannels, Image& image)
+{
+	Image*	target = &image;
+	return startLoad(loader, filename, [target, width, height, nChannels](const char* name, ostream&)
+	{
+		return readRawImage(name, width, height, nChannels, *target);
+	});
+}
+
+float loadingProgress(const AssetLoader& loader)
+{
+	if (loader.loads.empty()) return 1;
+	return (float)(loader.nLoaded + loader.nFailed) / loader.loads.size();
+}
+
+bool waitAssets(AssetLoader& loader)
+{
+	bool	success = true;
+	for (size_t i = 0; i < loader.loads.size(); i++)
+	{
+		bool	loaded = loader.loads[i].get();
+		cout << loader.logs[i]->str();
+		if (!loaded)
+		{
+			cerr << "Failed to load " << loader.filenames[i] << endl;
+			success = false;
+		}
+	}
+
+	loader.filenames.clear();
+	loader.loads.clear();
+	loader.logs.clear();
+	return success;
+}
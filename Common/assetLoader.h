@@ -0,0 +1,74 @@
+#ifndef __ASSET_LOADER_H_
+#define __ASSET_LOADER_H_
+
+#include "image.h"
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <sstream>
+#include <atomic>
+#include <future>
+#include <algorithm>
+#include <omp.h>
+
+//meshes and images read, parsed and decoded on worker threads at once,
+//the startup taking as long as the slowest asset instead of all of them in turn
+//nothing touches GL there: the caller uploads the assets on the context thread once loaded
+struct AssetLoader
+{
+	std::vector<std::string>			filenames;
+	std::vector<std::shared_future<bool>>	loads;
+	std::vector<std::shared_ptr<std::ostringstream>>	logs;	//messages of each load, printed in order by waitAssets()
+
+	std::atomic<int>	nStarted, nLoaded, nFailed;
+};
+
+//cap the OpenMP teams of the calling worker to its share of the processors
+//among the loads in progress, which would oversubscribe them with a full team each
+//inline as the loaders of other assets, e.g., mesh.cpp, are not to link this module
+inline void shareProcessors(const AssetLoader& loader)
+{
+	int		nPending = std::max(1, loader.nStarted - loader.nLoaded - loader.nFailed);
+	omp_set_num_threads(std::max(1, omp_get_num_procs() / nPending));
+}
+
+//run load(filename, log) on a thread of its own, counting it once done
+//the load writes its messages to log rather than to cout, interleaved with the other loads
+//the loaders of each kind of asset live next to its reader, e.g., loadMeshAsync() in mesh.h,
+//so that a program loading only images doesn't link the mesh code
+template <typename Load>
+std::shared_future<bool> startLoad(AssetLoader& loader, const char* filename, Load load)
+{
+	if (loader.loads.empty()) loader.nStarted = loader.nLoaded = loader.nFailed = 0;
+	loader.nStarted++;
+
+	std::string		name = filename;
+	std::shared_ptr<std::ostringstream>	log = std::make_shared<std::ostringstream>();
+	std::shared_future<bool>	result = std::async(std::launch::async, [&loader, name, log, load]()
+	{
+		shareProcessors(loader);
+		bool	success = load(name.c_str(), *log);
+		if (success)	loader.nLoaded++;
+		else			loader.nFailed++;
+		return success;
+	}).share();
+
+	loader.filenames.push_back(name);
+	loader.loads.push_back(result);
+	loader.logs.push_back(log);
+	return result;
+}
+
+//start reading an image into the given one, which must outlive the load
+//the future tells whether it succeeded, e.g., to upload an asset as soon as it is ready
+std::shared_future<bool> loadRawImageAsync(AssetLoader& loader, const char* filename, int width, int height, int nChannels, Image& image);
+
+//fraction of the assets loaded or failed so far, 1 if none
+float loadingProgress(const AssetLoader& loader);
+
+//wait for every asset, printing the messages of each and reporting the ones failed, then forget them
+//returns true if all of them loaded
+bool waitAssets(AssetLoader& loader);
+
+#endif
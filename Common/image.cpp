@@ -0,0 +1,37 @@
+#include "image.h"
+
+#include <fstream>
+#include <iostream>
+using namespace std;
+
+bool readRawImage(const char* filename, int width, int height, int nChannels, Image& image)
+{
+	ifstream	is(filename, ios::binary);
+	if (is.fail())
+	{
+		cerr << "Can't open " << filename << endl;
+		return false;
+	}
+
+	size_t	size = (size_t)width * height * nChannels;
+	image.width = width;
+	image.height = height;
+	image.nChannels = nChannels;
+	image.texel = new unsigned char[size];
+
+	is.read((char*)image.texel, size);
+	if (!is)
+	{
+		cerr << filename << " is truncated: only " << is.gcount() << " bytes could be read" << endl;
+		deleteImage(image);
+		return false;
+	}
+
+	return true;
+}
+
+void deleteImage(Image& image)
+{
+	delete[] image.texel;
+	image = Image();
+}
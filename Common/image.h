@@ -0,0 +1,15 @@
+#ifndef __IMAGE_H_
+#define __IMAGE_H_
+
+//8-bit texels of a raw image, n channels interleaved row by row
+struct Image
+{
+	int				width, height, nChannels;
+	unsigned char*	texel;
+};
+
+//a headerless raw file of the given size as exported by image editors
+bool readRawImage(const char* filename, int width, int height, int nChannels, Image& image);
+void deleteImage(Image& image);
+
+#endif
@@ -0,0 +1,71 @@
+#include "mappedFile.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+bool mapFile(const char* filename, MappedFile& file, bool copyOnWrite)
+{
+	file.data = NULL;
+	file.size = 0;
+	file.mapping = NULL;
+
+#ifdef _WIN32
+	HANDLE	handle = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (handle == INVALID_HANDLE_VALUE) return false;
+
+	LARGE_INTEGER	size;
+	if (!GetFileSizeEx(handle, &size) || size.QuadPart == 0) { CloseHandle(handle); return false; }
+
+	//the mapping keeps the file open
+	HANDLE	mapping = CreateFileMappingA(handle, NULL, copyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(handle);
+	if (mapping == NULL) return false;
+
+	void*	data = MapViewOfFile(mapping, copyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+	if (data == NULL) { CloseHandle(mapping); return false; }
+
+	file.mapping = mapping;
+	size_t	fileSize = (size_t)size.QuadPart;
+#else
+	int		fd = open(filename, O_RDONLY);
+	if (fd < 0) return false;
+
+	struct stat	st;
+	if (fstat(fd, &st) != 0 || st.st_size == 0) { close(fd); return false; }
+
+	void*	data = mmap(NULL, (size_t)st.st_size, copyOnWrite ? PROT_READ | PROT_WRITE : PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) return false;
+
+	size_t	fileSize = (size_t)st.st_size;
+#endif
+
+	file.data = (const char*)data;
+	file.size = fileSize;
+
+	return true;
+}
+
+void unmapFile(MappedFile& file)
+{
+	if (file.data == NULL) return;
+
+#ifdef _WIN32
+	UnmapViewOfFile(file.data);
+	CloseHandle((HANDLE)file.mapping);
+#else
+	munmap((void*)file.data, file.size);
+#endif
+
+	file.data = NULL;
+	file.size = 0;
+	file.mapping = NULL;
+}
@@ -0,0 +1,19 @@
+#ifndef __MAPPED_FILE_H_
+#define __MAPPED_FILE_H_
+
+#include <stddef.h>
+
+//read-only memory mapping of a whole file
+struct MappedFile
+{
+	const char*	data;
+	size_t		size;
+
+	void*		mapping;	//file mapping handle on Windows
+};
+
+//copy-on-write pages can be modified in memory without changing the file
+bool mapFile(const char* filename, MappedFile& file, bool copyOnWrite = false);
+void unmapFile(MappedFile& file);
+
+#endif
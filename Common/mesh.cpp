@@ -0,0 +1,527 @@
+#include "mesh.h"
+#include "meshCache.h"
+#include "meshOptimize.h"
+#include "meshWeld.h"
+#include "meshImport.h"
+#include "assetLoader.h"
+
+#include <string.h>
+#include <limits.h>
+#include <charconv>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <omp.h>
+using namespace std;
+using namespace glm;
+
+//chunks of the data lines parsed in parallel
+const size_t	MIN_CHUNK_SIZE = 64 * 1024;
+const size_t	CACHE_LINE = 64;
+
+static inline bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+//skip spaces and tabs within the current line
+static inline const char* skipSpaces(const char* p, const char* end)
+{
+	while (p < end && isSpace(*p)) p++;
+	return p;
+}
+
+//skip white spaces and comments across lines
+static const char* skipBlank(const char* p, const char* end)
+{
+	while (p < end)
+	{
+		if (isSpace(*p) || *p == '\n') p++;
+		else if (*p == '#') { while (p < end && *p != '\n') p++; }
+		else break;
+	}
+	return p;
+}
+
+//beginning of the next line
+static inline const char* nextLine(const char* p, const char* end)
+{
+	const char*	q = (const char*)memchr(p, '\n', end - p);
+	return q ? q + 1 : end;
+}
+
+//a line holding data, i.e., neither empty nor a comment
+static inline bool isDataLine(const char* p, const char* end)
+{
+	p = skipSpaces(p, end);
+	return p < end && *p != '\n' && *p != '#';
+}
+
+template <typename T>
+static inline bool parse(const char*& p, const char* end, T& value)
+{
+	p = skipSpaces(p, end);
+	from_chars_result	r = from_chars(p, end, value);
+	if (r.ec != errc()) return false;
+	p = r.ptr;
+	return true;
+}
+
+//split [begin, end) into chunks starting at line boundaries
+static vector<const char*> splitLines(const char* begin, const char* end)
+{
+	size_t	size = end - begin;
+	size_t	nChunks = max((size_t)1, min(size / MIN_CHUNK_SIZE, (size_t)omp_get_max_threads() * 8));
+
+	vector<const char*>	bound(1, begin);
+	for (size_t c = 1; c < nChunks; c++)
+	{
+		const char*	p = max(begin + size * c / nChunks, bound.back());
+		bound.push_back(p == begin ? begin : nextLine(p - 1, end));
+	}
+	bound.push_back(end);
+
+	return bound;
+}
+
+static inline size_t alignUp(size_t n) { return (n + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE; }
+
+//one allocation for all the arrays, each aligned to a cache line
+void createMesh(Mesh& mesh, int nVertices, int nFaces)
+{
+	size_t	vertexBytes = alignUp(sizeof(vec3) * nVertices);
+	size_t	faceBytes = alignUp(sizeof(vec3) * nFaces);
+	size_t	indexBytes = alignUp(sizeof(uvec3) * nFaces);
+
+	mesh = Mesh();
+	mesh.nVertices = nVertices;
+	mesh.nFaces = nFaces;
+	mesh.storage = new char[2 * vertexBytes + 2 * faceBytes + indexBytes + CACHE_LINE];
+
+	char*	p = (char*)alignUp((size_t)mesh.storage);
+	mesh.vertex = (vec3*)p;		p += vertexBytes;
+	mesh.vnormal = (vec3*)p;	p += vertexBytes;
+	mesh.fnormal = (vec3*)p;	p += faceBytes;
+	mesh.fcenter = (vec3*)p;	p += faceBytes;
+	mesh.face = (uvec3*)p;
+}
+
+//parse the OFF file mapped in memory
+static bool parseOFF(const char* filename, const MappedFile& file, Mesh& mesh)
+{
+	const char*	p = file.data;
+	const char*	end = file.data + file.size;
+
+	//magic number, # vertices, # faces, # edges
+	int		nVertices = 0, nFaces = 0, nEdges = 0;
+	p = skipBlank(p, end);
+	bool	valid = (end - p >= 3) && p[0] == 'O' && p[1] == 'F' && p[2] == 'F';
+	if (valid) { p = skipBlank(p + 3, end);	valid = parse(p, end, nVertices); }
+	if (valid) { p = skipBlank(p, end);		valid = parse(p, end, nFaces); }
+	if (valid) { p = skipBlank(p, end);		valid = parse(p, end, nEdges); }
+	if (!valid || nVertices < 0 || nFaces < 0)
+	{
+		cerr << filename << " is not an OFF file" << endl;
+		return false;
+	}
+	meshLog() << "# vertices = " << nVertices << endl;
+	meshLog() << "# faces = " << nFaces << endl;
+
+	vector<const char*>	bound = splitLines(nextLine(p, end), end);
+	int		nChunks = (int)bound.size() - 1;
+
+	//# data lines in each chunk and # triangles of the faces starting in it
+	vector<long long>	firstLine(nChunks + 1, 0);
+	vector<long long>	firstTriangle(nChunks + 1, 0);
+
+#pragma omp parallel for schedule(static)
+	for (int c = 0; c < nChunks; c++)
+		for (const char* q = bound[c]; q < bound[c + 1]; q = nextLine(q, end))
+			if (isDataLine(q, end)) firstLine[c + 1]++;
+
+	for (int c = 0; c < nChunks; c++)
+		firstLine[c + 1] += firstLine[c];
+
+	if (firstLine[nChunks] < (long long)nVertices + nFaces)
+	{
+		cerr << filename << " is truncated" << endl;
+		return false;
+	}
+
+	//polygons with n vertices become n-2 triangles
+#pragma omp parallel for schedule(static) reduction(&&:valid)
+	for (int c = 0; c < nChunks; c++)
+	{
+		long long	line = firstLine[c];
+		for (const char* q = bound[c]; q < bound[c + 1]; q = nextLine(q, end))
+		{
+			if (!isDataLine(q, end)) continue;
+			if (line >= nVertices && line < (long long)nVertices + nFaces)
+			{
+				int		n = 0;
+				if (parse(q, end, n) && n >= 3) firstTriangle[c + 1] += n - 2;
+				else valid = false;
+			}
+			line++;
+		}
+	}
+
+	for (int c = 0; c < nChunks; c++)
+		firstTriangle[c + 1] += firstTriangle[c];
+
+	if (!valid || firstTriangle[nChunks] > INT_MAX)
+	{
+		cerr << filename << " has invalid faces" << endl;
+		return false;
+	}
+
+	int		nTriangles = (int)firstTriangle[nChunks];
+	if (nTriangles != nFaces) meshLog() << "# triangles = " << nTriangles << endl;
+
+	createMesh(mesh, nVertices, nTriangles);
+
+	//vertices and faces
+#pragma omp parallel for schedule(static) reduction(&&:valid)
+	for (int c = 0; c < nChunks; c++)
+	{
+		long long	line = firstLine[c];
+		int			t = (int)firstTriangle[c];
+		for (const char* q = bound[c]; q < bound[c + 1] && line < (long long)nVertices + nFaces; q = nextLine(q, end))
+		{
+			if (!isDataLine(q, end)) continue;
+
+			if (line < nVertices)
+			{
+				vec3&	v = mesh.vertex[line];
+				valid = parse(q, end, v.x) && parse(q, end, v.y) && parse(q, end, v.z) && valid;
+			}
+			else
+			{
+				//fan triangulation of the polygon
+				int		n = 0, v0 = 0, v1 = 0, v2 = 0;
+				parse(q, end, n);
+				valid = parse(q, end, v0) && parse(q, end, v1) && valid;
+				for (int k = 2; k < n; k++, t++)
+				{
+					valid = parse(q, end, v2) && valid;
+					mesh.face[t][0] = v0;
+					mesh.face[t][1] = v1;
+					mesh.face[t][2] = v2;
+					valid = valid && v0 >= 0 && v0 < nVertices && v1 >= 0 && v1 < nVertices && v2 >= 0 && v2 < nVertices;
+					v1 = v2;
+				}
+			}
+			line++;
+		}
+	}
+
+	if (!valid)
+	{
+		cerr << filename << " has invalid vertices or faces" << endl;
+		deleteMesh(mesh);
+		return false;
+	}
+
+	return true;
+}
+
+//an OFF file or a file viewed by meshImport
+static bool parseMesh(const char* filename, const MappedFile& file, Mesh& mesh)
+{
+	if (!isViewedMeshFile(filename)) return parseOFF(filename, file, mesh);
+
+	MeshView	view;
+	return viewMesh(filename, file, view) && copyMeshView(filename, view, mesh);
+}
+
+bool parseMesh(const char* filename, Mesh& mesh)
+{
+	mesh = Mesh();
+
+	size_t	length = strlen(filename);
+	if (length > 7 && strcmp(filename + length - 7, ".mcache") == 0) return mapMeshCache(filename, mesh);
+
+	MappedFile	file;
+	if (!mapFile(filename, file))
+	{
+		cerr << "Can't open " << filename << endl;
+		return false;
+	}
+
+	bool	success = parseMesh(filename, file, mesh);
+	unmapFile(file);
+	return success;
+}
+
+bool readMesh(const char* filename, Mesh& mesh)
+{
+	mesh = Mesh();
+
+	//a cache by itself
+	size_t	length = strlen(filename);
+	if (length > 7 && strcmp(filename + length - 7, ".mcache") == 0)
+	{
+		if (!mapMeshCache(filename, mesh)) return false;
+
+		meshLog() << "# vertices = " << mesh.nVertices << endl;
+		meshLog() << "# faces = " << mesh.nFaces << endl;
+		meshLog() << "Mapped " << filename << endl;
+		return true;
+	}
+
+	MappedFile	file;
+	if (!mapFile(filename, file))
+	{
+		cerr << "Can't open " << filename << endl;
+		return false;
+	}
+
+	//binary cache next to the mesh file
+	string		cacheFile = string(filename) + ".mcache";
+	uint64_t	sourceHash = hashContent(file.data, file.size);
+	uint64_t	sourceSize = file.size;
+
+	if (mapMeshCache(cacheFile.c_str(), sourceHash, sourceSize, mesh))
+	{
+		unmapFile(file);
+
+		meshLog() << "# vertices = " << mesh.nVertices << endl;
+		meshLog() << "# faces = " << mesh.nFaces << endl;
+		meshLog() << "Mapped " << cacheFile << endl;
+		return true;
+	}
+
+	bool	success = parseMesh(filename, file, mesh);
+	unmapFile(file);
+	if (!success) return false;
+
+	//duplicate vertices of scanned meshes would split the smooth normals
+	printWeldStats(weldMesh(mesh));
+
+	computeNormals(mesh);
+	computeCenters(mesh);
+
+	//face and vertex order for the vertex cache, paid once before caching
+	VertexCacheStats	before = analyzeVertexCache(mesh);
+	optimizeMesh(mesh);
+	VertexCacheStats	after = analyzeVertexCache(mesh);
+	meshLog() << "ACMR = " << before.acmr << " -> " << after.acmr;
+	meshLog() << ", ATVR = " << before.atvr << " -> " << after.atvr << endl;
+
+	if (writeMeshCache(cacheFile.c_str(), mesh, sourceHash, sourceSize))
+		meshLog() << "Wrote " << cacheFile << endl;
+
+	return true;
+}
+
+shared_future<bool> loadMeshAsync(AssetLoader& loader, const char* filename, Mesh& mesh)
+{
+	Mesh*	target = &mesh;
+	return startLoad(loader, filename, [target](const char* name, ostream& log)
+	{
+		//the worker may be a pooled thread running other tasks afterwards
+		setMeshLog(&log);
+		bool	success = readMesh(name, *target);
+		setMeshLog(NULL);
+		return success;
+	});
+}
+
+static thread_local ostream*	meshLogStream = NULL;
+
+ostream& meshLog() { return meshLogStream ? *meshLogStream : cout; }
+void setMeshLog(ostream* log) { meshLogStream = log; }
+
+void deleteMesh(Mesh& mesh)
+{
+	delete[] mesh.storage;
+	unmapFile(mesh.cache);
+	mesh = Mesh();
+}
+
+void createFaceArrays(const Mesh& mesh, FaceArrays& arrays)
+{
+	size_t	indexBytes = alignUp(sizeof(uint32_t) * mesh.nFaces);
+
+	arrays.nFaces = mesh.nFaces;
+	arrays.storage = new char[3 * indexBytes + CACHE_LINE];
+
+	char*	p = (char*)alignUp((size_t)arrays.storage);
+	for (int j = 0; j < 3; j++) { arrays.index[j] = (uint32_t*)p; p += indexBytes; }
+
+#pragma omp parallel for schedule(static)
+	for (int i = 0; i < mesh.nFaces; i++)
+		for (int j = 0; j < 3; j++)
+			arrays.index[j][i] = mesh.face[i][j];
+}
+
+void deleteFaceArrays(FaceArrays& arrays)
+{
+	delete[] arrays.storage;
+	arrays = FaceArrays();
+}
+
+const char*	normalWeightingName[N_WEIGHTINGS] = { "Uniform weighting", "Area weighting", "Angle weighting" };
+
+void buildVertexFaces(const Mesh& mesh, VertexFaces& adjacency)
+{
+	int		nVertices = mesh.nVertices;
+	adjacency.nVertices = nVertices;
+	adjacency.start = new int[nVertices + 1];
+	adjacency.faces = new int[3 * (size_t)mesh.nFaces];
+
+	int*	start = adjacency.start;
+	memset(start, 0, sizeof(int) * (nVertices + 1));
+
+	//# faces of each vertex
+#pragma omp parallel for schedule(static)
+	for (int i = 0; i < mesh.nFaces; i++)
+		for (int j = 0; j < 3; j++)
+		{
+#pragma omp atomic
+			start[mesh.face[i][j] + 1]++;
+		}
+
+	for (int i = 0; i < nVertices; i++)
+		start[i + 1] += start[i];
+
+	//faces in increasing order to sum them in the same order as the serial scatter
+	int*	next = new int[nVertices];
+	memcpy(next, start, sizeof(int) * nVertices);
+	for (int i = 0; i < mesh.nFaces; i++)
+		for (int j = 0; j < 3; j++)
+			adjacency.faces[next[mesh.face[i][j]]++] = i;
+	delete[] next;
+}
+
+void deleteVertexFaces(VertexFaces& adjacency)
+{
+	delete[] adjacency.start;
+	delete[] adjacency.faces;
+	adjacency.start = adjacency.faces = NULL;
+	adjacency.nVertices = 0;
+}
+
+//zero vector for degenerate faces
+static inline vec3 safeNormalize(const vec3& v)
+{
+	return (dot(v, v) > 0) ? normalize(v) : vec3(0, 0, 0);
+}
+
+//interior angle of face f at vertex v
+static inline float cornerAngle(const Mesh& mesh, int f, int v)
+{
+	ivec3	t(mesh.face[f]);
+	int		j = (t[0] == v) ? 0 : (t[1] == v) ? 1 : 2;
+	vec3	e1 = mesh.vertex[t[(j + 1) % 3]] - mesh.vertex[v];
+	vec3	e2 = mesh.vertex[t[(j + 2) % 3]] - mesh.vertex[v];
+
+	float	l = length(e1) * length(e2);
+	return (l > 0) ? acos(clamp(dot(e1, e2) / l, -1.0f, 1.0f)) : 0.0f;
+}
+
+void computeNormals(Mesh& mesh, const VertexFaces& adjacency, NormalWeighting weighting)
+{
+	//normal vector of each face
+#pragma omp parallel for schedule(static)
+	for (int i = 0; i < mesh.nFaces; i++)
+	{
+		vec3	v1 = mesh.vertex[mesh.face[i][1]] - mesh.vertex[mesh.face[i][0]];
+		vec3	v2 = mesh.vertex[mesh.face[i][2]] - mesh.vertex[mesh.face[i][0]];
+		mesh.fnormal[i] = safeNormalize(cross(v1, v2));
+	}
+
+	//gather the adjacent face normals of each vertex in a fixed order
+#pragma omp parallel for schedule(static)
+	for (int i = 0; i < mesh.nVertices; i++)
+	{
+		vec3	n(0, 0, 0);
+		for (int k = adjacency.start[i]; k < adjacency.start[i + 1]; k++)
+		{
+			int		f = adjacency.faces[k];
+			switch (weighting)
+			{
+			case WEIGHT_AREA:
+				//twice the area along the normal
+				n += cross(mesh.vertex[mesh.face[f][1]] - mesh.vertex[mesh.face[f][0]],
+					mesh.vertex[mesh.face[f][2]] - mesh.vertex[mesh.face[f][0]]);
+				break;
+			case WEIGHT_ANGLE:
+				n += cornerAngle(mesh, f, i) * mesh.fnormal[f];
+				break;
+			default:
+				n += mesh.fnormal[f];
+				break;
+			}
+		}
+		mesh.vnormal[i] = safeNormalize(n);
+	}
+}
+
+void computeNormals(Mesh& mesh, NormalWeighting weighting)
+{
+	VertexFaces	adjacency;
+	buildVertexFaces(mesh, adjacency);
+	computeNormals(mesh, adjacency, weighting);
+	deleteVertexFaces(adjacency);
+}
+
+void computeCenters(Mesh& mesh)
+{
+#pragma omp parallel for schedule(static)
+	for (int i = 0; i < mesh.nFaces; i++)
+		mesh.fcenter[i] = (mesh.vertex[mesh.face[i][0]] + mesh.vertex[mesh.face[i][1]] + mesh.vertex[mesh.face[i][2]]) / 3.0f;
+
+	//bounding box
+	vec3	bmin(0, 0, 0), bmax(0, 0, 0);
+	if (mesh.nVertices > 0) bmin = bmax = mesh.vertex[0];
+	for (int i = 1; i < mesh.nVertices; i++)
+	{
+		bmin = min(bmin, mesh.vertex[i]);
+		bmax = max(bmax, mesh.vertex[i]);
+	}
+	mesh.bmin = bmin;
+	mesh.bmax = bmax;
+}
+
+void createSphereMesh(Mesh& mesh, float radius, int slices, int stacks)
+{
+	slices = std::max(slices, 3);
+	stacks = std::max(stacks, 2);
+	createMesh(mesh, 2 + (stacks - 1) * slices, 2 * slices * (stacks - 1));
+
+	//the north pole, the rings from the north to the south and the south pole
+	const float	pi = 3.14159265f;
+	int		south = mesh.nVertices - 1;
+	mesh.vnormal[0] = vec3(0, 0, 1);
+	mesh.vnormal[south] = vec3(0, 0, -1);
+	for (int k = 1; k < stacks; k++)
+	{
+		float	phi = pi * k / stacks;
+		for (int s = 0; s < slices; s++)
+		{
+			float	theta = 2 * pi * s / slices;
+			mesh.vnormal[1 + (k - 1) * slices + s] = vec3(sinf(phi) * cosf(theta), sinf(phi) * sinf(theta), cosf(phi));
+		}
+	}
+	for (int v = 0; v < mesh.nVertices; v++) mesh.vertex[v] = radius * mesh.vnormal[v];
+
+	//counterclockwise seen from the outside
+	auto	ring = [&](int k, int s) { return (unsigned)(1 + (k - 1) * slices + s % slices); };
+	int		f = 0;
+	for (int s = 0; s < slices; s++)
+	{
+		mesh.face[f++] = uvec3(0, ring(1, s), ring(1, s + 1));
+		for (int k = 1; k < stacks - 1; k++)
+		{
+			mesh.face[f++] = uvec3(ring(k, s), ring(k + 1, s), ring(k + 1, s + 1));
+			mesh.face[f++] = uvec3(ring(k, s), ring(k + 1, s + 1), ring(k, s + 1));
+		}
+		mesh.face[f++] = uvec3(ring(stacks - 1, s), south, ring(stacks - 1, s + 1));
+	}
+
+	for (int i = 0; i < mesh.nFaces; i++)
+	{
+		const uvec3&	t = mesh.face[i];
+		mesh.fnormal[i] = safeNormalize(cross(mesh.vertex[t[1]] - mesh.vertex[t[0]], mesh.vertex[t[2]] - mesh.vertex[t[0]]));
+	}
+	computeCenters(mesh);
+}
@@ -0,0 +1,96 @@
+#ifndef __MESH_H_
+#define __MESH_H_
+
+#include "mappedFile.h"
+
+#include <stdint.h>
+#include <iosfwd>
+#include <future>
+#include <glm/glm.hpp>
+
+//triangle mesh whose arrays share a single allocation or a mapped cache file
+struct Mesh
+{
+	int		nVertices, nFaces;
+
+	glm::vec3*	vertex;
+	glm::vec3*	vnormal;	//vertex normal
+	glm::vec3*	fnormal;	//face normal
+	glm::vec3*	fcenter;	//face center
+	glm::uvec3*	face;		//vertex indices of each triangle, interleaved
+
+	glm::vec3	bmin, bmax;	//bounding box
+
+	char*		storage;	//the single block holding the arrays above
+	MappedFile	cache;		//or the binary cache they point into
+};
+
+//read a mesh from an OFF, binary PLY or glTF binary (.glb) file, see meshImport.h,
+//triangulating polygons as fans and welding duplicate vertices, see weldMesh()
+//the binary cache written next to the file is used while its content is unchanged
+//a .mcache file, e.g., from the MeshSubdivide tool, is mapped by itself
+bool readMesh(const char* filename, Mesh& mesh);
+
+//readMesh() on a worker thread of the loader, see assetLoader.h, into a mesh outliving the load
+//a file is to be loaded once, as readMesh() writes its cache next to it
+struct AssetLoader;
+std::shared_future<bool> loadMeshAsync(AssetLoader& loader, const char* filename, Mesh& mesh);
+
+//where readMesh() prints its statistics on the calling thread, cout unless set
+//loadMeshAsync() sets it to the log of the load for the messages of one mesh to stay together
+std::ostream& meshLog();
+void setMeshLog(std::ostream* log);
+
+//the faces and vertices of a mesh file as stored, without welding, normals, reordering or the cache
+//a .mcache file is mapped as it is, with its normals
+bool parseMesh(const char* filename, Mesh& mesh);
+
+//allocate the arrays of a mesh in a single cache-aligned block
+void createMesh(Mesh& mesh, int nVertices, int nFaces);
+
+//delete the vertices and faces of the mesh
+void deleteMesh(Mesh& mesh);
+
+//structure-of-arrays copy of the face indices for SIMD kernels loading one corner of
+//several faces at once, generated on demand since the walks over whole faces are faster
+//with the interleaved layout touching a single cache line per face
+struct FaceArrays
+{
+	int			nFaces;
+	uint32_t*	index[3];	//corner j of face i is index[j][i]
+	char*		storage;
+};
+
+void createFaceArrays(const Mesh& mesh, FaceArrays& arrays);
+void deleteFaceArrays(FaceArrays& arrays);
+
+//weighting of the adjacent face normals in a vertex normal
+enum NormalWeighting { WEIGHT_UNIFORM = 0, WEIGHT_AREA, WEIGHT_ANGLE, N_WEIGHTINGS };
+extern const char*	normalWeightingName[N_WEIGHTINGS];
+
+//compressed (CSR) vertex-to-face adjacency built once per topology
+//the faces of vertex i are faces[start[i]] ... faces[start[i+1]-1] in increasing order
+struct VertexFaces
+{
+	int		nVertices;
+	int*	start;
+	int*	faces;
+};
+
+void buildVertexFaces(const Mesh& mesh, VertexFaces& adjacency);
+void deleteVertexFaces(VertexFaces& adjacency);
+
+//face normals and vertex normals gathered from the adjacent faces in parallel
+//the results are bit-identical for any number of threads
+//the uniform weighting sums the unit face normals as the lessons always did
+void computeNormals(Mesh& mesh, const VertexFaces& adjacency, NormalWeighting weighting = WEIGHT_UNIFORM);
+void computeNormals(Mesh& mesh, NormalWeighting weighting = WEIGHT_UNIFORM);
+
+//face centers and the bounding box
+void computeCenters(Mesh& mesh);
+
+//sphere around the z-axis like gluSphere(), with a single vertex at each pole,
+//its vertex normals exact, e.g., for drawing it instanced with a MeshGL
+void createSphereMesh(Mesh& mesh, float radius, int slices, int stacks);
+
+#endif
@@ -0,0 +1,222 @@
+#include "meshCache.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+using namespace std;
+using namespace glm;
+
+//file layout: header followed by the arrays, each at a 64-byte aligned offset
+static const char		MAGIC[4] = { 'M', 'E', 'S', 'H' };
+static const uint32_t	VERSION = 4;	//2: faces and vertices in the optimized order, 3: interleaved faces, 4: welded
+static const uint64_t	ALIGNMENT = 64;
+
+enum MeshSection { SECTION_VERTEX = 0, SECTION_VNORMAL, SECTION_FNORMAL, SECTION_FCENTER,
+	SECTION_FACE, N_SECTIONS };
+
+struct MeshCacheHeader
+{
+	char		magic[4];
+	uint32_t	version;
+	uint64_t	sourceHash;		//content hash of the OFF file
+	uint64_t	sourceSize;
+
+	int32_t		nVertices, nFaces;
+	float		bmin[3], bmax[3];
+
+	uint64_t	offset[N_SECTIONS];
+	char		pad[32];
+};
+static_assert(sizeof(MeshCacheHeader) % ALIGNMENT == 0, "the arrays follow the header aligned");
+
+//block-wise hash to be computed in parallel
+const size_t	HASH_BLOCK = 1 << 20;
+
+static uint64_t hashBlock(const unsigned char* p, size_t size, uint64_t h)
+{
+	size_t	i = 0;
+	for (; i + 8 <= size; i += 8)
+	{
+		uint64_t	w;
+		memcpy(&w, p + i, 8);
+		h = (h ^ w) * 0x9E3779B97F4A7C15ULL;
+		h ^= h >> 32;
+	}
+	for (; i < size; i++)
+		h = (h ^ p[i]) * 1099511628211ULL;
+
+	return h;
+}
+
+uint64_t hashContent(const char* data, size_t size)
+{
+	int		nBlocks = (int)((size + HASH_BLOCK - 1) / HASH_BLOCK);
+	vector<uint64_t>	h(nBlocks);
+
+#pragma omp parallel for schedule(static)
+	for (int b = 0; b < nBlocks; b++)
+	{
+		size_t	begin = (size_t)b * HASH_BLOCK;
+		h[b] = hashBlock((const unsigned char*)data + begin, min(HASH_BLOCK, size - begin), 14695981039346656037ULL);
+	}
+
+	//blocks combined in order
+	return hashBlock((const unsigned char*)h.data(), sizeof(uint64_t) * h.size(), size);
+}
+
+static void sectionSizes(int nVertices, int nFaces, uint64_t size[N_SECTIONS])
+{
+	size[SECTION_VERTEX] = size[SECTION_VNORMAL] = sizeof(vec3) * (uint64_t)nVertices;
+	size[SECTION_FNORMAL] = size[SECTION_FCENTER] = sizeof(vec3) * (uint64_t)nFaces;
+	size[SECTION_FACE] = sizeof(uvec3) * (uint64_t)nFaces;
+}
+
+static const void* sectionData(const Mesh& mesh, int s)
+{
+	switch (s)
+	{
+	case SECTION_VERTEX:	return mesh.vertex;
+	case SECTION_VNORMAL:	return mesh.vnormal;
+	case SECTION_FNORMAL:	return mesh.fnormal;
+	case SECTION_FCENTER:	return mesh.fcenter;
+	default:				return mesh.face;
+	}
+}
+
+bool writeMeshCache(const char* filename, const Mesh& mesh, uint64_t sourceHash, uint64_t sourceSize)
+{
+	MeshCacheHeader	header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, MAGIC, sizeof(MAGIC));
+	header.version = VERSION;
+	header.sourceHash = sourceHash;
+	header.sourceSize = sourceSize;
+	header.nVertices = mesh.nVertices;
+	header.nFaces = mesh.nFaces;
+	for (int k = 0; k < 3; k++) { header.bmin[k] = mesh.bmin[k]; header.bmax[k] = mesh.bmax[k]; }
+
+	uint64_t	size[N_SECTIONS];
+	sectionSizes(mesh.nVertices, mesh.nFaces, size);
+
+	uint64_t	offset = sizeof(header);
+	for (int s = 0; s < N_SECTIONS; s++)
+	{
+		header.offset[s] = offset;
+		offset = (offset + size[s] + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+	}
+
+	//written to a temporary file and renamed not to leave a broken cache
+	string	temp = string(filename) + ".tmp";
+
+	FILE*	fp = fopen(temp.c_str(), "wb");
+	if (fp == NULL)
+	{
+		cerr << "Can't write " << temp << endl;
+		return false;
+	}
+
+	static const char	zero[ALIGNMENT] = { 0 };
+	bool	success = fwrite(&header, sizeof(header), 1, fp) == 1;
+	for (int s = 0; s < N_SECTIONS && success; s++)
+	{
+		uint64_t	padding = (s + 1 < N_SECTIONS) ? header.offset[s + 1] - header.offset[s] - size[s] : 0;
+		success = fwrite(sectionData(mesh, s), 1, (size_t)size[s], fp) == size[s]
+			&& fwrite(zero, 1, (size_t)padding, fp) == padding;
+	}
+	success = (fclose(fp) == 0) && success;
+
+	if (success)
+	{
+		remove(filename);
+		success = rename(temp.c_str(), filename) == 0;
+	}
+	if (!success)
+	{
+		cerr << "Failed in writing " << filename << endl;
+		remove(temp.c_str());
+	}
+
+	return success;
+}
+
+//the source is not checked for a cache given by itself
+static bool mapMeshCache(const char* filename, bool checkSource, uint64_t sourceHash, uint64_t sourceSize, Mesh& mesh)
+{
+	//copy-on-write for the lessons modifying the mesh in memory
+	MappedFile	file;
+	if (!mapFile(filename, file, true))
+	{
+		if (!checkSource) cerr << filename << " is not a mesh cache" << endl;
+		return false;
+	}
+
+	MeshCacheHeader	header;
+	bool	valid = file.size >= sizeof(header);
+	if (valid)
+	{
+		memcpy(&header, file.data, sizeof(header));
+		valid = memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 && header.version == VERSION
+			&& (!checkSource || (header.sourceHash == sourceHash && header.sourceSize == sourceSize))
+			&& header.nVertices >= 0 && header.nFaces >= 0;
+	}
+
+	uint64_t	size[N_SECTIONS];
+	if (valid) sectionSizes(header.nVertices, header.nFaces, size);
+	for (int s = 0; s < N_SECTIONS && valid; s++)
+		valid = header.offset[s] % ALIGNMENT == 0 && header.offset[s] <= file.size && size[s] <= file.size - header.offset[s];
+
+	if (!valid)
+	{
+		if (!checkSource) cerr << filename << " is not a mesh cache" << endl;
+		unmapFile(file);
+		return false;
+	}
+
+	//a cache given by itself is not known to be written by writeMeshCache(),
+	//so its faces are validated as those of an imported file
+	if (!checkSource)
+	{
+		const uvec3*	face = (const uvec3*)((const char*)file.data + header.offset[SECTION_FACE]);
+		uint32_t	nVertices = (uint32_t)header.nVertices;
+		int			nFaces = header.nFaces;
+#pragma omp parallel for schedule(static) reduction(&&:valid)
+		for (int i = 0; i < nFaces; i++)
+			valid = valid && face[i][0] < nVertices && face[i][1] < nVertices && face[i][2] < nVertices;
+
+		if (!valid)
+		{
+			cerr << filename << " has invalid faces" << endl;
+			unmapFile(file);
+			return false;
+		}
+	}
+
+	//the arrays point into the mapping
+	char*	data = (char*)file.data;
+	mesh.nVertices = header.nVertices;
+	mesh.nFaces = header.nFaces;
+	mesh.vertex = (vec3*)(data + header.offset[SECTION_VERTEX]);
+	mesh.vnormal = (vec3*)(data + header.offset[SECTION_VNORMAL]);
+	mesh.fnormal = (vec3*)(data + header.offset[SECTION_FNORMAL]);
+	mesh.fcenter = (vec3*)(data + header.offset[SECTION_FCENTER]);
+	mesh.face = (uvec3*)(data + header.offset[SECTION_FACE]);
+	mesh.bmin = vec3(header.bmin[0], header.bmin[1], header.bmin[2]);
+	mesh.bmax = vec3(header.bmax[0], header.bmax[1], header.bmax[2]);
+	mesh.storage = NULL;
+	mesh.cache = file;
+
+	return true;
+}
+
+bool mapMeshCache(const char* filename, uint64_t sourceHash, uint64_t sourceSize, Mesh& mesh)
+{
+	return mapMeshCache(filename, true, sourceHash, sourceSize, mesh);
+}
+
+bool mapMeshCache(const char* filename, Mesh& mesh)
+{
+	return mapMeshCache(filename, false, 0, 0, mesh);
+}
@@ -0,0 +1,18 @@
+#ifndef __MESH_CACHE_H_
+#define __MESH_CACHE_H_
+
+#include "mesh.h"
+
+#include <stdint.h>
+
+//content hash of a source file for invalidating its cache
+uint64_t hashContent(const char* data, size_t size);
+
+//binary mesh container with 64-byte aligned arrays mapped without parsing
+bool writeMeshCache(const char* filename, const Mesh& mesh, uint64_t sourceHash, uint64_t sourceSize);
+bool mapMeshCache(const char* filename, uint64_t sourceHash, uint64_t sourceSize, Mesh& mesh);
+
+//a cache file by itself, e.g., a generated mesh without an OFF file
+bool mapMeshCache(const char* filename, Mesh& mesh);
+
+#endif
@@ -0,0 +1,91 @@
+#include "meshCompact.h"
+
+#include <math.h>
+using namespace glm;
+
+const size_t	CACHE_LINE = 64;
+
+static inline size_t alignUp(size_t n) { return (n + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE; }
+
+static inline float signNotZero(float x) { return x >= 0 ? 1.0f : -1.0f; }
+
+vec2 octEncode(const vec3& n)
+{
+	vec2	e = vec2(n.x, n.y) / (fabsf(n.x) + fabsf(n.y) + fabsf(n.z));
+	if (n.z < 0) e = vec2((1 - fabsf(e.y)) * signNotZero(e.x), (1 - fabsf(e.x)) * signNotZero(e.y));
+	return e;
+}
+
+vec3 octDecode(const vec2& e)
+{
+	vec3	n(e.x, e.y, 1 - fabsf(e.x) - fabsf(e.y));
+	if (n.z < 0) n = vec3((1 - fabsf(e.y)) * signNotZero(e.x), (1 - fabsf(e.x)) * signNotZero(e.y), n.z);
+	return normalize(n);
+}
+
+static inline int16_t quantize(float x)
+{
+	return (int16_t)floorf(clamp(x, -1.0f, 1.0f) * QUANTIZE_MAX + 0.5f);
+}
+
+static inline void encodeNormal(const vec3& n, int16_t* q)
+{
+	//zero normals of degenerate faces stay zero
+	if (n.x == 0 && n.y == 0 && n.z == 0) { q[0] = q[1] = 0; return; }
+
+	vec2	e = octEncode(n);
+	q[0] = quantize(e.x);
+	q[1] = quantize(e.y);
+}
+
+void createCompactMesh(const Mesh& mesh, CompactMesh& compact)
+{
+	compact = CompactMesh();
+	compact.nVertices = mesh.nVertices;
+	compact.nFaces = mesh.nFaces;
+
+	bool	small = mesh.nVertices <= 65536;
+	size_t	vertexBytes = alignUp(sizeof(int16_t) * 3 * mesh.nVertices);
+	size_t	vnormalBytes = alignUp(sizeof(int16_t) * 2 * mesh.nVertices);
+	size_t	fnormalBytes = alignUp(sizeof(int16_t) * 2 * mesh.nFaces);
+	size_t	indexBytes = alignUp((small ? sizeof(uint16_t) : sizeof(uint32_t)) * 3 * mesh.nFaces);
+	compact.storage = new char[vertexBytes + vnormalBytes + fnormalBytes + indexBytes + CACHE_LINE];
+
+	char*	p = (char*)alignUp((size_t)compact.storage);
+	compact.vertex = (int16_t*)p;	p += vertexBytes;
+	compact.vnormal = (int16_t*)p;	p += vnormalBytes;
+	compact.fnormal = (int16_t*)p;	p += fnormalBytes;
+	if (small)	compact.index16 = (uint16_t*)p;
+	else		compact.index32 = (uint32_t*)p;
+
+	//the bounding box mapped onto [-32767, 32767]^3, flat sides kept apart from zero scale
+	compact.center = 0.5f * (mesh.bmin + mesh.bmax);
+	compact.scale = max(0.5f * (mesh.bmax - mesh.bmin), vec3(1e-20f)) / QUANTIZE_MAX;
+	vec3	inverse = vec3(1.0f) / (compact.scale * QUANTIZE_MAX);
+
+#pragma omp parallel for schedule(static)
+	for (int i = 0; i < mesh.nVertices; i++)
+	{
+		vec3	q = (mesh.vertex[i] - compact.center) * inverse;
+		for (int k = 0; k < 3; k++) compact.vertex[3 * (size_t)i + k] = quantize(q[k]);
+		encodeNormal(mesh.vnormal[i], compact.vnormal + 2 * (size_t)i);
+	}
+
+#pragma omp parallel for schedule(static)
+	for (int i = 0; i < mesh.nFaces; i++)
+	{
+		encodeNormal(mesh.fnormal[i], compact.fnormal + 2 * (size_t)i);
+		for (int j = 0; j < 3; j++)
+		{
+			size_t	k = 3 * (size_t)i + j;
+			if (small)	compact.index16[k] = (uint16_t)mesh.face[i][j];
+			else		compact.index32[k] = (uint32_t)mesh.face[i][j];
+		}
+	}
+}
+
+void deleteCompactMesh(CompactMesh& compact)
+{
+	delete[] compact.storage;
+	compact = CompactMesh();
+}
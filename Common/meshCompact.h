@@ -0,0 +1,57 @@
+#ifndef __MESH_COMPACT_H_
+#define __MESH_COMPACT_H_
+
+#include "mesh.h"
+
+#include <stdint.h>
+
+//largest magnitude of the 16-bit quantized values
+const float		QUANTIZE_MAX = 32767.0f;
+
+//mesh quantized to 16-bit positions over its bounding box, 2x16-bit octahedral normals
+//and 16-bit indices when the vertices fit, 10 bytes per vertex instead of 36
+struct CompactMesh
+{
+	int		nVertices, nFaces;
+
+	glm::vec3	center;		//position = center + scale * quantized position
+	glm::vec3	scale;
+
+	int16_t*	vertex;		//3 per vertex
+	int16_t*	vnormal;	//2 per vertex
+	int16_t*	fnormal;	//2 per face
+	uint16_t*	index16;	//3 per face if nVertices <= 65536
+	uint32_t*	index32;	//3 per face otherwise
+
+	char*		storage;
+};
+
+void createCompactMesh(const Mesh& mesh, CompactMesh& compact);
+void deleteCompactMesh(CompactMesh& compact);
+
+//octahedral mapping of a unit vector onto the square [-1, 1]^2
+glm::vec2 octEncode(const glm::vec3& n);
+glm::vec3 octDecode(const glm::vec2& e);
+
+//decoding for the CPU, e.g., a ray tracer
+inline glm::vec3 decodePosition(const CompactMesh& mesh, int i)
+{
+	const int16_t*	q = mesh.vertex + 3 * (size_t)i;
+	return mesh.center + mesh.scale * glm::vec3(q[0], q[1], q[2]);
+}
+
+inline glm::vec3 decodeNormal(const int16_t* q)
+{
+	return octDecode(glm::vec2(q[0], q[1]) / QUANTIZE_MAX);
+}
+
+inline glm::vec3 decodeVertexNormal(const CompactMesh& mesh, int i) { return decodeNormal(mesh.vnormal + 2 * (size_t)i); }
+inline glm::vec3 decodeFaceNormal(const CompactMesh& mesh, int i) { return decodeNormal(mesh.fnormal + 2 * (size_t)i); }
+
+inline int vertexIndex(const CompactMesh& mesh, int face, int j)
+{
+	size_t	k = 3 * (size_t)face + j;
+	return mesh.index16 ? mesh.index16[k] : (int)mesh.index32[k];
+}
+
+#endif
@@ -0,0 +1,587 @@
+#include "meshGL.h"
+
+#include <stddef.h>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+using namespace std;
+using namespace glm;
+
+#ifdef _MSC_VER
+#pragma comment(lib, "glew32.lib")
+#endif
+
+//interleaved vertex of the buffers
+struct VertexGL
+{
+	vec3	p;	//position
+	vec3	n;	//normal
+};
+
+//quantized vertex of a compact mesh, 12 bytes instead of 24
+struct CompactVertexGL
+{
+	int16_t	p[3];	//position over the bounding box
+	int16_t	pad;
+	int16_t	n[2];	//octahedral normal
+};
+
+const int	N_LIGHTS = 8;
+
+//the fixed function lighting (one-sided, infinite viewer) of the enabled lights with the given material
+static const char*	lightingShader =
+	"#version 120\n"
+	"uniform bool lighting;\n"
+	"uniform bool lightOn[8];\n"
+	"\n"
+	"vec4 shade(vec4 v, vec3 n, vec4 ambient, vec4 diffuse, vec4 specular, float shininess) {\n"
+	"	if (!lighting) return gl_Color;\n"
+	"\n"
+	"	vec4 c = gl_FrontMaterial.emission + gl_LightModel.ambient * ambient;\n"
+	"	for (int i = 0; i < 8; i++) {\n"
+	"		if (!lightOn[i]) continue;\n"
+	"		vec3 L = gl_LightSource[i].position.xyz;\n"
+	"		float att = 1.0;\n"
+	"		if (gl_LightSource[i].position.w != 0.0) {\n"
+	"			L -= v.xyz;\n"
+	"			float d = length(L);\n"
+	"			att = 1.0 / (gl_LightSource[i].constantAttenuation + gl_LightSource[i].linearAttenuation * d\n"
+	"				+ gl_LightSource[i].quadraticAttenuation * d * d);\n"
+	"			if (gl_LightSource[i].spotCutoff <= 90.0) {\n"
+	"				float s = dot(-normalize(L), normalize(gl_LightSource[i].spotDirection));\n"
+	"				att *= s < gl_LightSource[i].spotCosCutoff ? 0.0 : pow(s, gl_LightSource[i].spotExponent);\n"
+	"			}\n"
+	"		}\n"
+	"		L = normalize(L);\n"
+	"		float nDotL = max(dot(n, L), 0.0);\n"
+	"		vec4 term = gl_LightSource[i].ambient * ambient + nDotL * gl_LightSource[i].diffuse * diffuse;\n"
+	"		if (nDotL > 0.0)\n"
+	"			term += pow(max(dot(n, normalize(L + vec3(0.0, 0.0, 1.0))), 0.0), shininess) * gl_LightSource[i].specular * specular;\n"
+	"		c += att * term;\n"
+	"	}\n"
+	"	return vec4(c.rgb, diffuse.a);\n"
+	"}\n";
+
+//dequantization of a compact mesh lit with the current material
+static const char*	compactVertexShader =
+	"attribute vec3 position;\n"
+	"attribute vec2 normal;\n"
+	"uniform vec3 center;\n"
+	"uniform vec3 scale;\n"
+	"\n"
+	"vec3 octDecode(vec2 e) {\n"
+	"	vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));\n"
+	"	if (n.z < 0.0) n.xy = (1.0 - abs(e.yx)) * vec2(e.x >= 0.0 ? 1.0 : -1.0, e.y >= 0.0 ? 1.0 : -1.0);\n"
+	"	return n;\n"
+	"}\n"
+	"\n"
+	"void main() {\n"
+	"	vec4 v = gl_ModelViewMatrix * vec4(center + scale * position, 1.0);\n"
+	"	gl_Position = gl_ProjectionMatrix * v;\n"
+	"	vec3 n = normalize(gl_NormalMatrix * octDecode(normal / 32767.0));\n"
+	"	gl_FrontColor = shade(v, n, gl_FrontMaterial.ambient, gl_FrontMaterial.diffuse, gl_FrontMaterial.specular, gl_FrontMaterial.shininess);\n"
+	"}\n";
+
+//model matrix and material index per instance, the model scaled uniformly if at all
+static const char*	instancedVertexShader =
+	"attribute vec3 position;\n"
+	"attribute vec3 normal;\n"
+	"attribute mat4 model;\n"
+	"attribute float material;\n"
+	"uniform vec4 materialAmbient[8];\n"
+	"uniform vec4 materialDiffuse[8];\n"
+	"uniform vec4 materialSpecular[8];\n"
+	"uniform float materialShininess[8];\n"
+	"\n"
+	"void main() {\n"
+	"	vec4 v = gl_ModelViewMatrix * (model * vec4(position, 1.0));\n"
+	"	gl_Position = gl_ProjectionMatrix * v;\n"
+	"	vec3 n = normalize(gl_NormalMatrix * (mat3(model) * normal));\n"
+	"	int m = int(material);\n"
+	"	gl_FrontColor = shade(v, n, materialAmbient[m], materialDiffuse[m], materialSpecular[m], materialShininess[m]);\n"
+	"}\n";
+
+//a vertex shader after the lighting with its attributes bound in order from 0
+struct ProgramGL
+{
+	GLuint	program;
+	GLint	lightingLocation, lightOnLocation;
+};
+
+static bool createProgram(ProgramGL& program, const char* name, const char* vertexShader, const char* const* attributes, const GLuint* locations, int nAttributes)
+{
+	if (program.program) return true;
+
+	const char*	sources[2] = { lightingShader, vertexShader };
+	GLuint	shader = glCreateShader(GL_VERTEX_SHADER);
+	glShaderSource(shader, 2, sources, NULL);
+	glCompileShader(shader);
+
+	GLint	status = 0;
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+	if (!status)
+	{
+		char	log[1024];
+		glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+		cerr << name << " shader: " << log << endl;
+		glDeleteShader(shader);
+		return false;
+	}
+
+	program.program = glCreateProgram();
+	glAttachShader(program.program, shader);
+	for (int i = 0; i < nAttributes; i++) glBindAttribLocation(program.program, locations[i], attributes[i]);
+	glLinkProgram(program.program);
+	glDeleteShader(shader);
+
+	glGetProgramiv(program.program, GL_LINK_STATUS, &status);
+	if (!status)
+	{
+		char	log[1024];
+		glGetProgramInfoLog(program.program, sizeof(log), NULL, log);
+		cerr << name << " program: " << log << endl;
+		glDeleteProgram(program.program);
+		program.program = 0;
+		return false;
+	}
+
+	program.lightingLocation = glGetUniformLocation(program.program, "lighting");
+	program.lightOnLocation = glGetUniformLocation(program.program, "lightOn");
+	return true;
+}
+
+static void deleteProgram(ProgramGL& program)
+{
+	if (program.program) glDeleteProgram(program.program);
+	program.program = 0;
+}
+
+//the enabled lights of the fixed function state
+static void useProgram(const ProgramGL& program)
+{
+	GLint	lightOn[N_LIGHTS];
+	for (int i = 0; i < N_LIGHTS; i++) lightOn[i] = glIsEnabled(GL_LIGHT0 + i);
+
+	glUseProgram(program.program);
+	glUniform1i(program.lightingLocation, glIsEnabled(GL_LIGHTING));
+	glUniform1iv(program.lightOnLocation, N_LIGHTS, lightOn);
+}
+
+//the program shared by the compact meshes
+static ProgramGL	compactProgram;
+static int			nCompactMeshes = 0;
+static GLint		centerLocation, scaleLocation;
+
+static bool createCompactProgram()
+{
+	if (compactProgram.program) return true;
+
+	const char*	attributes[2] = { "position", "normal" };
+	const GLuint	locations[2] = { 0, 1 };
+	if (!createProgram(compactProgram, "Compact mesh", compactVertexShader, attributes, locations, 2)) return false;
+
+	centerLocation = glGetUniformLocation(compactProgram.program, "center");
+	scaleLocation = glGetUniformLocation(compactProgram.program, "scale");
+	return true;
+}
+
+//the program of the instanced draws, the model matrix taking 4 attribute locations
+static ProgramGL	instancedProgram;
+static int			nInstanceBuffers = 0;
+static GLint		materialLocation[4];
+
+const GLuint	MODEL_LOCATION = 2;
+const GLuint	MATERIAL_LOCATION = 6;
+
+static bool createInstancedProgram()
+{
+	if (instancedProgram.program) return true;
+
+	const char*	attributes[4] = { "position", "normal", "model", "material" };
+	const GLuint	locations[4] = { 0, 1, MODEL_LOCATION, MATERIAL_LOCATION };
+	if (!createProgram(instancedProgram, "Instanced mesh", instancedVertexShader, attributes, locations, 4)) return false;
+
+	const char*	names[4] = { "materialAmbient", "materialDiffuse", "materialSpecular", "materialShininess" };
+	for (int k = 0; k < 4; k++) materialLocation[k] = glGetUniformLocation(instancedProgram.program, names[k]);
+	return true;
+}
+
+static void uploadVertices(const Mesh& mesh, MeshGL& meshGL, bool create)
+{
+	VertexGL*	v = new VertexGL[mesh.nVertices];
+#pragma omp parallel for schedule(static)
+	for (int i = 0; i < mesh.nVertices; i++)
+	{
+		v[i].p = mesh.vertex[i];
+		v[i].n = mesh.vnormal[i];
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, meshGL.vertexBuffer);
+	if (create)	glBufferData(GL_ARRAY_BUFFER, sizeof(VertexGL) * mesh.nVertices, v, GL_STATIC_DRAW);
+	else		glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(VertexGL) * mesh.nVertices, v);
+	delete[] v;
+
+	//split vertices of the flat mesh
+	VertexGL*	f = new VertexGL[3 * (size_t)mesh.nFaces];
+#pragma omp parallel for schedule(static)
+	for (int i = 0; i < mesh.nFaces; i++)
+		for (int j = 0; j < 3; j++)
+		{
+			f[3 * i + j].p = mesh.vertex[mesh.face[i][j]];
+			f[3 * i + j].n = mesh.fnormal[i];
+		}
+
+	glBindBuffer(GL_ARRAY_BUFFER, meshGL.flatBuffer);
+	if (create)	glBufferData(GL_ARRAY_BUFFER, sizeof(VertexGL) * 3 * mesh.nFaces, f, GL_STATIC_DRAW);
+	else		glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(VertexGL) * 3 * mesh.nFaces, f);
+	delete[] f;
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+static bool initializeMeshGL(MeshGL& meshGL)
+{
+	meshGL = MeshGL();
+	meshGL.indexType = GL_UNSIGNED_INT;
+
+	if (glGenBuffers == NULL)
+	{
+		cerr << "Vertex buffer objects are not available: call glewInit()" << endl;
+		return false;
+	}
+	return true;
+}
+
+bool createMeshGL(const Mesh& mesh, MeshGL& meshGL)
+{
+	if (!initializeMeshGL(meshGL)) return false;
+
+	glGenBuffers(1, &meshGL.vertexBuffer);
+	glGenBuffers(1, &meshGL.indexBuffer);
+	glGenBuffers(1, &meshGL.flatBuffer);
+
+	meshGL.nVertices = mesh.nVertices;
+	meshGL.nFaces = mesh.nFaces;
+	uploadVertices(mesh, meshGL, true);
+
+	//the interleaved faces are the index buffer as they are
+	static_assert(sizeof(uvec3) == 3 * sizeof(GLuint), "faces of three GLuint indices");
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshGL.indexBuffer);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uvec3) * mesh.nFaces, mesh.face, GL_STATIC_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+	return true;
+}
+
+bool createMeshGL(const CompactMesh& mesh, MeshGL& meshGL)
+{
+	if (!initializeMeshGL(meshGL)) return false;
+	if (!createCompactProgram()) return false;
+	nCompactMeshes++;
+
+	meshGL.compact = true;
+	meshGL.center = mesh.center;
+	meshGL.scale = mesh.scale;
+	meshGL.nVertices = mesh.nVertices;
+	meshGL.nFaces = mesh.nFaces;
+
+	glGenBuffers(1, &meshGL.vertexBuffer);
+	glGenBuffers(1, &meshGL.indexBuffer);
+	glGenBuffers(1, &meshGL.flatBuffer);
+
+	CompactVertexGL*	v = new CompactVertexGL[mesh.nVertices];
+#pragma omp parallel for schedule(static)
+	for (int i = 0; i < mesh.nVertices; i++)
+	{
+		for (int k = 0; k < 3; k++) v[i].p[k] = mesh.vertex[3 * (size_t)i + k];
+		v[i].pad = 0;
+		for (int k = 0; k < 2; k++) v[i].n[k] = mesh.vnormal[2 * (size_t)i + k];
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, meshGL.vertexBuffer);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(CompactVertexGL) * mesh.nVertices, v, GL_STATIC_DRAW);
+	delete[] v;
+
+	//split vertices of the flat mesh
+	CompactVertexGL*	f = new CompactVertexGL[3 * (size_t)mesh.nFaces];
+#pragma omp parallel for schedule(static)
+	for (int i = 0; i < mesh.nFaces; i++)
+		for (int j = 0; j < 3; j++)
+		{
+			CompactVertexGL&	s = f[3 * (size_t)i + j];
+			int		vi = vertexIndex(mesh, i, j);
+			for (int k = 0; k < 3; k++) s.p[k] = mesh.vertex[3 * (size_t)vi + k];
+			s.pad = 0;
+			for (int k = 0; k < 2; k++) s.n[k] = mesh.fnormal[2 * (size_t)i + k];
+		}
+
+	glBindBuffer(GL_ARRAY_BUFFER, meshGL.flatBuffer);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(CompactVertexGL) * 3 * mesh.nFaces, f, GL_STATIC_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	delete[] f;
+
+	//the indices are already interleaved
+	meshGL.indexType = mesh.index16 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+	size_t		indexSize = mesh.index16 ? sizeof(uint16_t) : sizeof(uint32_t);
+	const void*	index = mesh.index16 ? (const void*)mesh.index16 : (const void*)mesh.index32;
+
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshGL.indexBuffer);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexSize * 3 * mesh.nFaces, index, GL_STATIC_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+	return true;
+}
+
+void deleteMeshGL(MeshGL& meshGL)
+{
+	if (meshGL.vertexBuffer)	glDeleteBuffers(1, &meshGL.vertexBuffer);
+	if (meshGL.indexBuffer)		glDeleteBuffers(1, &meshGL.indexBuffer);
+	if (meshGL.flatBuffer)		glDeleteBuffers(1, &meshGL.flatBuffer);
+
+	//the shared program goes with the last compact mesh
+	if (meshGL.compact && --nCompactMeshes == 0) deleteProgram(compactProgram);
+
+	meshGL = MeshGL();
+}
+
+void updateMeshGL(const Mesh& mesh, MeshGL& meshGL)
+{
+	if (meshGL.vertexBuffer == 0 || meshGL.compact) return;
+	uploadVertices(mesh, meshGL, false);
+}
+
+//vertex and normal arrays sourced from the given buffer
+static void beginArrays(const MeshGL& meshGL, GLuint buffer)
+{
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+
+	if (!meshGL.compact)
+	{
+		glEnableClientState(GL_VERTEX_ARRAY);
+		glEnableClientState(GL_NORMAL_ARRAY);
+		glVertexPointer(3, GL_FLOAT, sizeof(VertexGL), (const GLvoid*)offsetof(VertexGL, p));
+		glNormalPointer(GL_FLOAT, sizeof(VertexGL), (const GLvoid*)offsetof(VertexGL, n));
+		return;
+	}
+
+	useProgram(compactProgram);
+	glUniform3fv(centerLocation, 1, &meshGL.center[0]);
+	glUniform3fv(scaleLocation, 1, &meshGL.scale[0]);
+
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+	glVertexAttribPointer(0, 3, GL_SHORT, GL_FALSE, sizeof(CompactVertexGL), (const GLvoid*)offsetof(CompactVertexGL, p));
+	glVertexAttribPointer(1, 2, GL_SHORT, GL_FALSE, sizeof(CompactVertexGL), (const GLvoid*)offsetof(CompactVertexGL, n));
+}
+
+static void endArrays(const MeshGL& meshGL)
+{
+	if (meshGL.compact)
+	{
+		glDisableVertexAttribArray(0);
+		glDisableVertexAttribArray(1);
+		glUseProgram(0);
+	}
+	else
+	{
+		glDisableClientState(GL_VERTEX_ARRAY);
+		glDisableClientState(GL_NORMAL_ARRAY);
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void drawSmoothMeshGL(const MeshGL& meshGL)
+{
+	if (meshGL.vertexBuffer == 0) return;
+
+	beginArrays(meshGL, meshGL.vertexBuffer);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshGL.indexBuffer);
+	glDrawElements(GL_TRIANGLES, 3 * meshGL.nFaces, meshGL.indexType, 0);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	endArrays(meshGL);
+}
+
+void drawFlatMeshGL(const MeshGL& meshGL)
+{
+	if (meshGL.flatBuffer == 0) return;
+
+	beginArrays(meshGL, meshGL.flatBuffer);
+	glDrawArrays(GL_TRIANGLES, 0, 3 * meshGL.nFaces);
+	endArrays(meshGL);
+}
+
+//vertex or index ranges of the visible meshlets, reused across the draws
+static vector<GLint>			rangeFirst;
+static vector<GLsizei>			rangeCount;
+static vector<const GLvoid*>	rangeOffset;
+
+static void prepareRanges(const Meshlets& meshlets, size_t indexSize)
+{
+	rangeFirst.resize(meshlets.nRanges);
+	rangeCount.resize(meshlets.nRanges);
+	rangeOffset.resize(meshlets.nRanges);
+	for (int r = 0; r < meshlets.nRanges; r++)
+	{
+		rangeFirst[r] = 3 * meshlets.rangeFirst[r];
+		rangeCount[r] = 3 * meshlets.rangeCount[r];
+		rangeOffset[r] = (const GLvoid*)(indexSize * rangeFirst[r]);
+	}
+}
+
+void drawSmoothMeshGL(const MeshGL& meshGL, const Meshlets& meshlets)
+{
+	if (meshGL.vertexBuffer == 0 || meshlets.nRanges == 0) return;
+
+	prepareRanges(meshlets, meshGL.indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint));
+
+	beginArrays(meshGL, meshGL.vertexBuffer);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshGL.indexBuffer);
+	glMultiDrawElements(GL_TRIANGLES, rangeCount.data(), meshGL.indexType, rangeOffset.data(), meshlets.nRanges);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	endArrays(meshGL);
+}
+
+void drawFlatMeshGL(const MeshGL& meshGL, const Meshlets& meshlets)
+{
+	if (meshGL.flatBuffer == 0 || meshlets.nRanges == 0) return;
+
+	prepareRanges(meshlets, 0);
+
+	beginArrays(meshGL, meshGL.flatBuffer);
+	glMultiDrawArrays(GL_TRIANGLES, rangeFirst.data(), rangeCount.data(), meshlets.nRanges);
+	endArrays(meshGL);
+}
+
+MaterialGL currentMaterialGL()
+{
+	MaterialGL	material;
+	glGetMaterialfv(GL_FRONT, GL_AMBIENT, &material.ambient[0]);
+	glGetMaterialfv(GL_FRONT, GL_DIFFUSE, &material.diffuse[0]);
+	glGetMaterialfv(GL_FRONT, GL_SPECULAR, &material.specular[0]);
+	glGetMaterialfv(GL_FRONT, GL_SHININESS, &material.shininess);
+	return material;
+}
+
+bool instancingSupported()
+{
+	//not compiled again every frame after a failure
+	static bool	failed = false;
+	if (!failed && !(GLEW_VERSION_2_0 && GLEW_ARB_instanced_arrays && createInstancedProgram())) failed = true;
+
+	return !failed;
+}
+
+bool uploadInstancesGL(const InstanceGL* instance, int nInstances, InstancesGL& instances)
+{
+	if (!instancingSupported()) return false;
+
+	if (instances.buffer == 0)
+	{
+		glGenBuffers(1, &instances.buffer);
+		nInstanceBuffers++;
+	}
+
+	//orphaned for the instances of the next frame while the GPU may still draw the previous ones
+	glBindBuffer(GL_ARRAY_BUFFER, instances.buffer);
+	if (nInstances > instances.capacity)
+	{
+		glBufferData(GL_ARRAY_BUFFER, sizeof(InstanceGL) * nInstances, instance, GL_STREAM_DRAW);
+		instances.capacity = nInstances;
+	}
+	else
+	{
+		glBufferData(GL_ARRAY_BUFFER, sizeof(InstanceGL) * instances.capacity, NULL, GL_STREAM_DRAW);
+		glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(InstanceGL) * nInstances, instance);
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	instances.nInstances = nInstances;
+	return true;
+}
+
+void deleteInstancesGL(InstancesGL& instances)
+{
+	if (instances.buffer == 0) return;
+
+	//the shared program goes with the last instance buffer
+	glDeleteBuffers(1, &instances.buffer);
+	if (--nInstanceBuffers == 0) deleteProgram(instancedProgram);
+
+	instances = InstancesGL();
+}
+
+//vertex attributes from the given buffer of a full mesh, instance attributes from the instance buffer
+static bool beginInstancedArrays(const MeshGL& meshGL, GLuint buffer, const InstancesGL& instances, const MaterialGL* materials, int nMaterials)
+{
+	if (meshGL.compact || buffer == 0 || instances.nInstances == 0 || !instancingSupported()) return false;
+
+	useProgram(instancedProgram);
+
+	//the material table padded with the last material
+	vec4	ambient[MAX_INSTANCE_MATERIALS], diffuse[MAX_INSTANCE_MATERIALS], specular[MAX_INSTANCE_MATERIALS];
+	GLfloat	shininess[MAX_INSTANCE_MATERIALS];
+	nMaterials = std::min(std::max(nMaterials, 1), MAX_INSTANCE_MATERIALS);
+	for (int m = 0; m < MAX_INSTANCE_MATERIALS; m++)
+	{
+		MaterialGL	material = materials ? materials[std::min(m, nMaterials - 1)] : currentMaterialGL();
+		ambient[m] = material.ambient;
+		diffuse[m] = material.diffuse;
+		specular[m] = material.specular;
+		shininess[m] = material.shininess;
+	}
+	glUniform4fv(materialLocation[0], MAX_INSTANCE_MATERIALS, &ambient[0][0]);
+	glUniform4fv(materialLocation[1], MAX_INSTANCE_MATERIALS, &diffuse[0][0]);
+	glUniform4fv(materialLocation[2], MAX_INSTANCE_MATERIALS, &specular[0][0]);
+	glUniform1fv(materialLocation[3], MAX_INSTANCE_MATERIALS, shininess);
+
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(VertexGL), (const GLvoid*)offsetof(VertexGL, p));
+	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(VertexGL), (const GLvoid*)offsetof(VertexGL, n));
+
+	//one column of the model matrix per location, advancing once per instance
+	glBindBuffer(GL_ARRAY_BUFFER, instances.buffer);
+	for (GLuint c = 0; c < 4; c++)
+	{
+		glEnableVertexAttribArray(MODEL_LOCATION + c);
+		glVertexAttribPointer(MODEL_LOCATION + c, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceGL), (const GLvoid*)(offsetof(InstanceGL, model) + sizeof(vec4) * c));
+		glVertexAttribDivisorARB(MODEL_LOCATION + c, 1);
+	}
+	glEnableVertexAttribArray(MATERIAL_LOCATION);
+	glVertexAttribPointer(MATERIAL_LOCATION, 1, GL_FLOAT, GL_FALSE, sizeof(InstanceGL), (const GLvoid*)offsetof(InstanceGL, material));
+	glVertexAttribDivisorARB(MATERIAL_LOCATION, 1);
+
+	return true;
+}
+
+static void endInstancedArrays()
+{
+	for (GLuint a = MODEL_LOCATION; a <= MATERIAL_LOCATION; a++)
+	{
+		glVertexAttribDivisorARB(a, 0);
+		glDisableVertexAttribArray(a);
+	}
+	glDisableVertexAttribArray(0);
+	glDisableVertexAttribArray(1);
+	glUseProgram(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void drawSmoothMeshGL(const MeshGL& meshGL, const InstancesGL& instances, const MaterialGL* materials, int nMaterials)
+{
+	if (!beginInstancedArrays(meshGL, meshGL.vertexBuffer, instances, materials, nMaterials)) return;
+
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshGL.indexBuffer);
+	glDrawElementsInstancedARB(GL_TRIANGLES, 3 * meshGL.nFaces, meshGL.indexType, 0, instances.nInstances);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	endInstancedArrays();
+}
+
+void drawFlatMeshGL(const MeshGL& meshGL, const InstancesGL& instances, const MaterialGL* materials, int nMaterials)
+{
+	if (!beginInstancedArrays(meshGL, meshGL.flatBuffer, instances, materials, nMaterials)) return;
+
+	glDrawArraysInstancedARB(GL_TRIANGLES, 0, 3 * meshGL.nFaces, instances.nInstances);
+	endInstancedArrays();
+}
@@ -0,0 +1,84 @@
+#ifndef __MESH_GL_H_
+#define __MESH_GL_H_
+
+#include <GL/glew.h>
+
+#include "mesh.h"
+#include "meshCompact.h"
+#include "meshlet.h"
+
+//vertex and index buffers of a mesh uploaded once and drawn without immediate mode
+//requires glewInit() after the OpenGL context is created
+struct MeshGL
+{
+	GLuint	vertexBuffer;	//interleaved position and vertex normal
+	GLuint	indexBuffer;	//3 vertex indices per face
+	GLuint	flatBuffer;		//3 split vertices per face with the face normal
+
+	int		nVertices, nFaces;
+
+	GLenum	indexType;		//GL_UNSIGNED_INT, or GL_UNSIGNED_SHORT for a compact mesh that fits
+
+	//a compact mesh is decoded by a GLSL 1.20 vertex shader lighting it like the fixed function
+	bool		compact;
+	glm::vec3	center, scale;
+};
+
+bool createMeshGL(const Mesh& mesh, MeshGL& meshGL);
+bool createMeshGL(const CompactMesh& mesh, MeshGL& meshGL);
+void deleteMeshGL(MeshGL& meshGL);
+
+//upload the positions and normals of a full mesh again after they changed
+void updateMeshGL(const Mesh& mesh, MeshGL& meshGL);
+
+//glDrawElements() with the vertex normals
+void drawSmoothMeshGL(const MeshGL& meshGL);
+
+//glDrawArrays() of the split vertices with the face normals
+void drawFlatMeshGL(const MeshGL& meshGL);
+
+//only the face ranges of the meshlets left by cullMeshlets() in a single multi-draw call
+void drawSmoothMeshGL(const MeshGL& meshGL, const Meshlets& meshlets);
+void drawFlatMeshGL(const MeshGL& meshGL, const Meshlets& meshlets);
+
+//fixed function material selected per instance
+struct MaterialGL
+{
+	glm::vec4	ambient, diffuse, specular;
+	GLfloat		shininess;
+};
+
+const int	MAX_INSTANCE_MATERIALS = 8;
+
+//the material of the front faces set by glMaterial()
+MaterialGL currentMaterialGL();
+
+//model matrix, applied before the current modelview matrix, and index into the materials of the draw
+//the model matrix is a rotation with a uniform scale and a translation for the normals to be right
+struct InstanceGL
+{
+	glm::mat4	model;
+	GLfloat		material;
+};
+
+//instances of a mesh drawn in a single call with ARB_instanced_arrays
+//by a GLSL 1.20 vertex shader lighting them like the fixed function
+struct InstancesGL
+{
+	GLuint	buffer;
+	int		nInstances, capacity;
+};
+
+//false without ARB_instanced_arrays, the instances to be drawn one by one then
+bool instancingSupported();
+
+//upload the instances, e.g., every frame they move, into a buffer growing as needed
+bool uploadInstancesGL(const InstanceGL* instance, int nInstances, InstancesGL& instances);
+void deleteInstancesGL(InstancesGL& instances);
+
+//all the instances of a full mesh, not a compact one, in one glDrawElementsInstancedARB() or glDrawArraysInstancedARB()
+//with at most MAX_INSTANCE_MATERIALS materials, the current one for none
+void drawSmoothMeshGL(const MeshGL& meshGL, const InstancesGL& instances, const MaterialGL* materials = NULL, int nMaterials = 0);
+void drawFlatMeshGL(const MeshGL& meshGL, const InstancesGL& instances, const MaterialGL* materials = NULL, int nMaterials = 0);
+
+#endif
@@ -0,0 +1,152 @@
+#include "meshHalfEdge.h"
+
+#include <string.h>
+
+//smaller or larger vertex of a half-edge, the same for both of an edge
+static inline int edgeKey(const Mesh& mesh, int h, bool larger)
+{
+	int		a = edgeOrigin(mesh, h), b = edgeTarget(mesh, h);
+	return (a < b) != larger ? a : b;
+}
+
+//stable counting sort of the half-edges in by a vertex of theirs into out,
+//start[v] the first of the ones keyed v
+static void countingSort(const Mesh& mesh, const int* in, int* out, int* start, bool larger)
+{
+	int		nVertices = mesh.nVertices;
+	int		nHalfEdges = 3 * mesh.nFaces;
+	memset(start, 0, sizeof(int) * (nVertices + 1));
+
+#pragma omp parallel for schedule(static)
+	for (int h = 0; h < nHalfEdges; h++)
+	{
+		int		key = edgeKey(mesh, h, larger);
+#pragma omp atomic
+		start[key + 1]++;
+	}
+
+	for (int i = 0; i < nVertices; i++)
+		start[i + 1] += start[i];
+
+	int*	next = new int[nVertices];
+	memcpy(next, start, sizeof(int) * nVertices);
+	for (int i = 0; i < nHalfEdges; i++)
+		out[next[edgeKey(mesh, in[i], larger)]++] = in[i];
+	delete[] next;
+}
+
+void buildHalfEdges(const Mesh& mesh, HalfEdges& halfEdges)
+{
+	int		nVertices = mesh.nVertices;
+	int		nHalfEdges = 3 * mesh.nFaces;
+
+	halfEdges.nVertices = nVertices;
+	halfEdges.nFaces = mesh.nFaces;
+	halfEdges.twin = new int[nHalfEdges];
+	halfEdges.vertexEdge = new int[nVertices];
+	halfEdges.vertexFlags = new uint8_t[nVertices];
+
+	int*	twin = halfEdges.twin;
+	int*	vertexEdge = halfEdges.vertexEdge;
+	uint8_t*	flags = halfEdges.vertexFlags;
+
+	//buckets of the half-edges by their smaller vertex, each ordered by the larger vertex,
+	//by two stable counting sorts, the larger vertex first (radix sort on the vertex pair)
+	int*	start = new int[nVertices + 1];
+	int*	byLarger = new int[nHalfEdges];
+	int*	bucket = new int[nHalfEdges];
+
+	for (int h = 0; h < nHalfEdges; h++) bucket[h] = h;
+	countingSort(mesh, bucket, byLarger, start, true);
+	countingSort(mesh, byLarger, bucket, start, false);
+	delete[] byLarger;
+
+	//match the half-edges of a bucket by their larger vertex, in order after the sorts
+	int		nBoundary = 0, nNonManifold = 0;
+#pragma omp parallel for schedule(dynamic, 1024) reduction(+:nBoundary, nNonManifold)
+	for (int v = 0; v < nVertices; v++)
+	{
+		int*	b = bucket + start[v];
+		int		n = start[v + 1] - start[v];
+
+		//larger vertex of each half-edge
+		auto	other = [&](int h) { return edgeKey(mesh, h, true); };
+
+		for (int i = 0; i < n; )
+		{
+			int		m = i + 1;
+			while (m < n && other(b[m]) == other(b[i])) m++;
+
+			int		h0 = b[i], h1 = b[i + 1 < m ? i + 1 : i];
+			if (m - i == 2 && edgeOrigin(mesh, h0) == edgeTarget(mesh, h1))
+			{
+				twin[h0] = h1;
+				twin[h1] = h0;
+			}
+			else
+			{
+				for (int k = i; k < m; k++) twin[b[k]] = m - i == 1 ? BORDER_EDGE : NON_MANIFOLD_EDGE;
+				if (m - i == 1)	nBoundary++;
+				else			nNonManifold++;
+			}
+			i = m;
+		}
+	}
+	delete[] bucket;
+	delete[] start;
+
+	halfEdges.nBoundaryEdges = nBoundary;
+	halfEdges.nNonManifoldEdges = nNonManifold;
+
+	//an outgoing half-edge per vertex, one without a twin on a border so that its fan starts there
+	int*	degree = new int[nVertices];
+	memset(degree, 0, sizeof(int) * nVertices);
+	memset(flags, 0, nVertices);
+	for (int v = 0; v < nVertices; v++) vertexEdge[v] = -1;
+	for (int h = 0; h < nHalfEdges; h++)
+	{
+		int		v = edgeOrigin(mesh, h);
+		degree[v]++;
+		if (vertexEdge[v] < 0 || (twin[h] < 0 && twin[vertexEdge[v]] >= 0)) vertexEdge[v] = h;
+
+		if (twin[h] == BORDER_EDGE)
+		{
+			flags[v] |= BOUNDARY_VERTEX;
+			flags[edgeTarget(mesh, h)] |= BOUNDARY_VERTEX;
+		}
+	}
+
+	//a manifold vertex reaches all its outgoing half-edges in a single fan
+	int		nNonManifoldVertices = 0;
+#pragma omp parallel for schedule(static) reduction(+:nNonManifoldVertices)
+	for (int v = 0; v < nVertices; v++)
+	{
+		int		first = vertexEdge[v];
+		if (first < 0) continue;
+
+		int		count = 0;
+		int		h = first;
+		do
+		{
+			count++;
+			h = rotateEdge(halfEdges, h);
+		} while (h >= 0 && h != first && count <= degree[v]);
+
+		if (count != degree[v])
+		{
+			flags[v] |= NON_MANIFOLD_VERTEX;
+			nNonManifoldVertices++;
+		}
+	}
+	delete[] degree;
+
+	halfEdges.nNonManifoldVertices = nNonManifoldVertices;
+}
+
+void deleteHalfEdges(HalfEdges& halfEdges)
+{
+	delete[] halfEdges.twin;
+	delete[] halfEdges.vertexEdge;
+	delete[] halfEdges.vertexFlags;
+	halfEdges = HalfEdges();
+}
@@ -0,0 +1,47 @@
+#ifndef __MESH_HALF_EDGE_H_
+#define __MESH_HALF_EDGE_H_
+
+#include "mesh.h"
+
+#include <stdint.h>
+
+//vertex classification
+const uint8_t	BOUNDARY_VERTEX = 1;		//on a border of the surface
+const uint8_t	NON_MANIFOLD_VERTEX = 2;	//its faces do not form a single fan
+
+//twins of the half-edges without a single opposite one
+const int	BORDER_EDGE = -1;
+const int	NON_MANIFOLD_EDGE = -2;	//shared by more than two faces or by two of the same orientation
+
+//half-edge connectivity of a triangle mesh with 32-bit indices
+//half-edge 3 * f + j of face f goes from face[f][j] to face[f][(j + 1) % 3],
+//i.e., from the index h of the interleaved faces, so only the twins are stored, 4 bytes per half-edge
+struct HalfEdges
+{
+	int		nVertices, nFaces;
+
+	int*	twin;			//3 per face, or BORDER_EDGE or NON_MANIFOLD_EDGE
+	int*	vertexEdge;		//an outgoing half-edge per vertex starting its fan, -1 if isolated
+	uint8_t*	vertexFlags;
+
+	int		nBoundaryEdges;
+	int		nNonManifoldEdges;
+	int		nNonManifoldVertices;
+};
+
+//edges matched by a radix sort on their vertex pairs, two counting sorts in linear time
+void buildHalfEdges(const Mesh& mesh, HalfEdges& halfEdges);
+void deleteHalfEdges(HalfEdges& halfEdges);
+
+inline int edgeFace(int h)	{ return h / 3; }
+inline int nextEdge(int h)	{ return h % 3 == 2 ? h - 2 : h + 1; }
+inline int prevEdge(int h)	{ return h % 3 == 0 ? h + 2 : h - 1; }
+
+inline int edgeOrigin(const Mesh& mesh, int h)	{ return (int)(&mesh.face[0].x)[h]; }
+inline int edgeTarget(const Mesh& mesh, int h)	{ return edgeOrigin(mesh, nextEdge(h)); }
+
+//next outgoing half-edge around the origin, negative past a border or a non-manifold edge
+//the fan of v is vertexEdge[v], rotateEdge(vertexEdge[v]), ... until negative or vertexEdge[v] again
+inline int rotateEdge(const HalfEdges& halfEdges, int h)	{ return halfEdges.twin[prevEdge(h)]; }
+
+#endif
@@ -0,0 +1,891 @@
+#include "meshImport.h"
+
+#include <math.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <string>
+#include <algorithm>
+#include <iostream>
+using namespace std;
+using namespace glm;
+
+static bool hasExtension(const char* filename, const char* extension)
+{
+	size_t	length = strlen(filename), n = strlen(extension);
+	if (length < n) return false;
+	for (size_t i = 0; i < n; i++)
+		if (tolower(filename[length - n + i]) != extension[i]) return false;
+	return true;
+}
+
+bool isViewedMeshFile(const char* filename)
+{
+	return hasExtension(filename, ".ply") || hasExtension(filename, ".glb");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//binary PLY
+
+enum PlyType { PLY_INT8 = 0, PLY_UINT8, PLY_INT16, PLY_UINT16, PLY_INT32, PLY_UINT32, PLY_FLOAT32, PLY_FLOAT64, N_PLY_TYPES };
+
+static const int	plyTypeSize[N_PLY_TYPES] = { 1, 1, 2, 2, 4, 4, 4, 8 };
+
+static int plyType(const string& name)
+{
+	static const char*	names[N_PLY_TYPES][2] = {
+		{ "char", "int8" }, { "uchar", "uint8" }, { "short", "int16" }, { "ushort", "uint16" },
+		{ "int", "int32" }, { "uint", "uint32" }, { "float", "float32" }, { "double", "float64" } };
+
+	for (int t = 0; t < N_PLY_TYPES; t++)
+		if (name == names[t][0] || name == names[t][1]) return t;
+	return -1;
+}
+
+//a scalar of the given type, byte-swapped for the other byte order
+static double readPly(const char* p, int type, bool swap)
+{
+	char	b[8];
+	memcpy(b, p, plyTypeSize[type]);
+	if (swap) reverse(b, b + plyTypeSize[type]);
+
+	switch (type)
+	{
+	case PLY_INT8:		{ int8_t v;		memcpy(&v, b, 1); return v; }
+	case PLY_UINT8:		{ uint8_t v;	memcpy(&v, b, 1); return v; }
+	case PLY_INT16:		{ int16_t v;	memcpy(&v, b, 2); return v; }
+	case PLY_UINT16:	{ uint16_t v;	memcpy(&v, b, 2); return v; }
+	case PLY_INT32:		{ int32_t v;	memcpy(&v, b, 4); return v; }
+	case PLY_UINT32:	{ uint32_t v;	memcpy(&v, b, 4); return v; }
+	case PLY_FLOAT32:	{ float v;		memcpy(&v, b, 4); return v; }
+	default:			{ double v;		memcpy(&v, b, 8); return v; }
+	}
+}
+
+struct PlyProperty
+{
+	string	name;
+	int		type;
+	int		countType;	//of a list, -1 for a scalar
+};
+
+struct PlyElement
+{
+	string		name;
+	size_t		count;
+	vector<PlyProperty>	properties;
+	size_t		size;		//of a record without lists, 0 otherwise
+};
+
+//size of the record at p, 0 if beyond the end
+static size_t recordSize(const PlyElement& element, const char* p, const char* end, bool swap)
+{
+	if (element.size > 0) return (p + element.size <= end) ? element.size : 0;
+
+	const char*	q = p;
+	for (const PlyProperty& property : element.properties)
+	{
+		if (property.countType < 0) q += plyTypeSize[property.type];
+		else
+		{
+			if (q + plyTypeSize[property.countType] > end) return 0;
+			double	n = readPly(q, property.countType, swap);
+			if (n < 0) return 0;
+			q += plyTypeSize[property.countType] + (size_t)n * plyTypeSize[property.type];
+		}
+		if (q > end) return 0;
+	}
+	return q - p;
+}
+
+//offset of a property in a record, valid for the records of a fixed size or up to the first list
+static size_t propertyOffset(const PlyElement& element, int index, const char* record, bool swap)
+{
+	size_t	offset = 0;
+	for (int i = 0; i < index; i++)
+	{
+		const PlyProperty&	property = element.properties[i];
+		if (property.countType < 0) offset += plyTypeSize[property.type];
+		else offset += plyTypeSize[property.countType] + (size_t)readPly(record + offset, property.countType, swap) * plyTypeSize[property.type];
+	}
+	return offset;
+}
+
+static int findProperty(const PlyElement& element, const char* name)
+{
+	for (size_t i = 0; i < element.properties.size(); i++)
+		if (element.properties[i].name == name) return (int)i;
+	return -1;
+}
+
+static bool viewVertices(const PlyElement& element, const char* data, const char* end, bool swap, MeshView& view)
+{
+	int		x = findProperty(element, "x"), y = findProperty(element, "y"), z = findProperty(element, "z");
+	if (x < 0 || y < 0 || z < 0 || element.size == 0) return false;
+	if (element.properties[x].countType >= 0 || element.properties[y].countType >= 0 || element.properties[z].countType >= 0) return false;
+	if (element.count > (size_t)(end - data) / element.size) return false;
+
+	size_t	ox = propertyOffset(element, x, data, swap);
+	size_t	oy = propertyOffset(element, y, data, swap);
+	size_t	oz = propertyOffset(element, z, data, swap);
+
+	//consecutive little-endian floats
+	bool	packed = !swap && oy == ox + 4 && oz == ox + 8;
+	for (int c : { x, y, z }) packed = packed && element.properties[c].type == PLY_FLOAT32;
+
+	view.vertex.count = element.count;
+	if (packed)
+	{
+		view.vertex.data = data + ox;
+		view.vertex.stride = element.size;
+		return true;
+	}
+
+	int		tx = element.properties[x].type, ty = element.properties[y].type, tz = element.properties[z].type;
+	int		n = (int)element.count;
+	view.convertedVertex.resize(n);
+#pragma omp parallel for schedule(static)
+	for (int v = 0; v < n; v++)
+	{
+		const char*	p = data + v * element.size;
+		view.convertedVertex[v] = vec3((float)readPly(p + ox, tx, swap), (float)readPly(p + oy, ty, swap), (float)readPly(p + oz, tz, swap));
+	}
+	view.vertex.data = (const char*)view.convertedVertex.data();
+	view.vertex.stride = sizeof(vec3);
+	view.inPlace = false;
+	return true;
+}
+
+//the faces as a view if every record is a triangle of 32-bit indices at the same offset and stride,
+//triangulating polygons as fans otherwise; returns the end of the element, NULL if invalid
+static const char* viewFaces(const PlyElement& element, const char* data, const char* end, bool swap, MeshView& view)
+{
+	int		list = findProperty(element, "vertex_indices");
+	if (list < 0) list = findProperty(element, "vertex_index");
+	if (list < 0 || element.properties[list].countType < 0) return NULL;
+
+	const PlyProperty&	indices = element.properties[list];
+	int		countSize = plyTypeSize[indices.countType];
+
+	//one pass over the records for their layout
+	bool	uniform = !swap && plyTypeSize[indices.type] == 4 && indices.type != PLY_FLOAT32;
+	size_t	stride = 0, offset = 0, nTriangles = 0;
+	const char*	p = data;
+	for (size_t i = 0; i < element.count; i++)
+	{
+		size_t	size = recordSize(element, p, end, swap);
+		if (size == 0) return NULL;
+
+		size_t	o = propertyOffset(element, list, p, swap);
+		int		n = (int)readPly(p + o, indices.countType, swap);
+		if (n >= 3) nTriangles += n - 2;
+		if (i == 0) { stride = size; offset = o; }
+		uniform = uniform && n == 3 && size == stride && o == offset;
+		p += size;
+	}
+
+	view.face.count = nTriangles;
+	if (uniform)
+	{
+		view.face.data = data + offset + countSize;
+		view.face.stride = stride;
+		return p;
+	}
+
+	view.convertedFace.resize(nTriangles);
+	size_t	t = 0;
+	p = data;
+	for (size_t i = 0; i < element.count; i++)
+	{
+		size_t	o = propertyOffset(element, list, p, swap);
+		int		n = (int)readPly(p + o, indices.countType, swap);
+		const char*	q = p + o + countSize;
+		int		size = plyTypeSize[indices.type];
+
+		//no index read from a record without a triangle, which may end the mapping
+		if (n >= 3)
+		{
+			uint32_t	v0 = (uint32_t)(int64_t)readPly(q, indices.type, swap);
+			uint32_t	v1 = (uint32_t)(int64_t)readPly(q + size, indices.type, swap);
+			for (int k = 2; k < n; k++)
+			{
+				uint32_t	v2 = (uint32_t)(int64_t)readPly(q + k * size, indices.type, swap);
+				view.convertedFace[t++] = uvec3(v0, v1, v2);
+				v1 = v2;
+			}
+		}
+		p += recordSize(element, p, end, swap);
+	}
+	view.face.data = (const char*)view.convertedFace.data();
+	view.face.stride = sizeof(uvec3);
+	view.inPlace = false;
+	return p;
+}
+
+static bool viewPLY(const char* filename, const MappedFile& file, MeshView& view)
+{
+	const char*	p = file.data;
+	const char*	end = file.data + file.size;
+
+	//header lines up to end_header
+	auto	nextLine = [&](string& line)
+	{
+		const char*	q = (const char*)memchr(p, '\n', end - p);
+		if (q == NULL) return false;
+		line.assign(p, q - p);
+		if (!line.empty() && line.back() == '\r') line.pop_back();
+		p = q + 1;
+		return true;
+	};
+
+	string	line;
+	if (!nextLine(line) || line != "ply")
+	{
+		cerr << filename << " is not a PLY file" << endl;
+		return false;
+	}
+
+	bool	swap = false, binary = false, ended = false;
+	vector<PlyElement>	elements;
+	while (!ended && nextLine(line))
+	{
+		vector<string>	word;
+		size_t	i = 0;
+		while (i < line.size())
+		{
+			size_t	j = line.find_first_of(" \t", i);
+			if (j == string::npos) j = line.size();
+			if (j > i) word.push_back(line.substr(i, j - i));
+			i = j + 1;
+		}
+		if (word.empty()) continue;
+
+		if (word[0] == "format" && word.size() > 1)
+		{
+			binary = word[1] == "binary_little_endian" || word[1] == "binary_big_endian";
+			swap = word[1] == "binary_big_endian";
+		}
+		else if (word[0] == "element" && word.size() == 3)
+		{
+			PlyElement	element;
+			element.name = word[1];
+			element.count = strtoull(word[2].c_str(), NULL, 10);
+			element.size = 0;
+			elements.push_back(element);
+		}
+		else if (word[0] == "property" && !elements.empty())
+		{
+			PlyProperty	property;
+			if (word.size() == 5 && word[1] == "list")
+			{
+				property.countType = plyType(word[2]);
+				property.type = plyType(word[3]);
+				property.name = word[4];
+				if (property.countType < 0 || property.countType == PLY_FLOAT32 || property.countType == PLY_FLOAT64) property.type = -1;
+			}
+			else if (word.size() == 3)
+			{
+				property.countType = -1;
+				property.type = plyType(word[1]);
+				property.name = word[2];
+			}
+			else property.type = -1;
+
+			if (property.type < 0)
+			{
+				cerr << filename << " has an invalid property: " << line << endl;
+				return false;
+			}
+			elements.back().properties.push_back(property);
+		}
+		else if (word[0] == "end_header") ended = true;
+	}
+
+	if (!ended || !binary)
+	{
+		cerr << filename << (ended ? " is not a binary PLY file" : " has no end of header") << endl;
+		return false;
+	}
+
+	for (PlyElement& element : elements)
+	{
+		size_t	size = 0;
+		for (const PlyProperty& property : element.properties)
+		{
+			if (property.countType >= 0) { size = 0; break; }
+			size += plyTypeSize[property.type];
+		}
+		element.size = size;
+	}
+
+	//the elements in their order in the file, skipping the others
+	view.inPlace = true;
+	bool	hasVertices = false, hasFaces = false;
+	for (const PlyElement& element : elements)
+	{
+		if (element.name == "vertex")
+		{
+			if (!viewVertices(element, p, end, swap, view))
+			{
+				cerr << filename << " has no valid vertices" << endl;
+				return false;
+			}
+			hasVertices = true;
+		}
+		if (element.name == "face")
+		{
+			const char*	q = viewFaces(element, p, end, swap, view);
+			if (q == NULL)
+			{
+				cerr << filename << " has no valid faces" << endl;
+				return false;
+			}
+			hasFaces = true;
+			p = q;
+			continue;
+		}
+
+		bool	truncated = element.size > 0 && element.count > (size_t)(end - p) / element.size;
+		if (element.size > 0 && !truncated) p += element.count * element.size;
+		for (size_t i = 0; i < element.count && element.size == 0 && !truncated; i++)
+		{
+			size_t	size = recordSize(element, p, end, swap);
+			truncated = size == 0;
+			p += size;
+		}
+		if (truncated)
+		{
+			cerr << filename << " is truncated" << endl;
+			return false;
+		}
+	}
+
+	if (!hasVertices || !hasFaces)
+	{
+		cerr << filename << " has no " << (hasVertices ? "faces" : "vertices") << endl;
+		return false;
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//minimal JSON for the glTF scene description
+
+struct Json
+{
+	enum Type { NONE = 0, NUMBER, STRING, ARRAY, OBJECT, LITERAL };
+
+	Type			type;
+	double			number;
+	string			text;		//string or literal
+	vector<Json>	items;		//elements of an array or values of an object
+	vector<string>	keys;		//of an object
+
+	Json() : type(NONE), number(0) {}
+
+	const Json& operator[](const char* key) const
+	{
+		static const Json	none;
+		for (size_t i = 0; i < keys.size(); i++) if (keys[i] == key) return items[i];
+		return none;
+	}
+	const Json& operator[](size_t i) const
+	{
+		static const Json	none;
+		return (type == ARRAY && i < items.size()) ? items[i] : none;
+	}
+	const Json& operator[](int i) const { return (*this)[(size_t)i]; }
+
+	bool	has(const char* key) const { return (*this)[key].type != NONE; }
+	size_t	size() const { return (type == ARRAY) ? items.size() : 0; }
+	double	value(double otherwise) const { return (type == NUMBER) ? number : otherwise; }
+
+	//the value as an index, count or byte offset, false unless a non-negative integer
+	//small enough to convert, as the cast of any other double is undefined
+	bool	toIndex(size_t& n, double otherwise = -1) const
+	{
+		double	x = value(otherwise);
+		if (!(x >= 0 && x == floor(x) && x < 9007199254740992.0)) return false;	//2^53
+		n = (size_t)x;
+		return true;
+	}
+};
+
+static const int	MAX_JSON_DEPTH = 64;
+
+static void skipJsonSpaces(const char*& p, const char* end)
+{
+	while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) p++;
+}
+
+static bool parseJsonString(const char*& p, const char* end, string& text)
+{
+	if (p >= end || *p != '"') return false;
+	for (p++; p < end && *p != '"'; p++)
+	{
+		if (*p != '\\') { text += *p; continue; }
+		if (++p >= end) return false;
+		switch (*p)
+		{
+		case 'b': text += '\b'; break;
+		case 'f': text += '\f'; break;
+		case 'n': text += '\n'; break;
+		case 'r': text += '\r'; break;
+		case 't': text += '\t'; break;
+		case 'u':	//non-ASCII characters only appear in names, not needed
+			if (end - p < 5) return false;
+			p += 4;
+			text += '?';
+			break;
+		default: text += *p; break;
+		}
+	}
+	if (p >= end) return false;
+	p++;
+	return true;
+}
+
+static bool parseJson(const char*& p, const char* end, Json& value, int depth = 0)
+{
+	skipJsonSpaces(p, end);
+	if (p >= end || depth > MAX_JSON_DEPTH) return false;
+
+	if (*p == '{' || *p == '[')
+	{
+		bool	object = *p == '{';
+		char	close = object ? '}' : ']';
+		value.type = object ? Json::OBJECT : Json::ARRAY;
+
+		p++;
+		skipJsonSpaces(p, end);
+		if (p < end && *p == close) { p++; return true; }
+		while (true)
+		{
+			if (object)
+			{
+				string	key;
+				skipJsonSpaces(p, end);
+				if (!parseJsonString(p, end, key)) return false;
+				skipJsonSpaces(p, end);
+				if (p >= end || *p++ != ':') return false;
+				value.keys.push_back(key);
+			}
+
+			value.items.push_back(Json());
+			if (!parseJson(p, end, value.items.back(), depth + 1)) return false;
+
+			skipJsonSpaces(p, end);
+			if (p >= end) return false;
+			if (*p == ',') { p++; continue; }
+			if (*p++ == close) return true;
+			return false;
+		}
+	}
+
+	if (*p == '"')
+	{
+		value.type = Json::STRING;
+		return parseJsonString(p, end, value.text);
+	}
+
+	if (*p == '-' || (*p >= '0' && *p <= '9'))
+	{
+		//strtod needs a terminated string
+		const char*	q = p;
+		while (q < end && strchr("+-.eE0123456789", *q)) q++;
+		string	number(p, q);
+		value.type = Json::NUMBER;
+		value.number = strtod(number.c_str(), NULL);
+		p = q;
+		return true;
+	}
+
+	const char*	q = p;
+	while (q < end && isalpha(*q)) q++;
+	value.type = Json::LITERAL;
+	value.text.assign(p, q);
+	p = q;
+	return value.text == "true" || value.text == "false" || value.text == "null";
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//glTF binary
+
+const uint32_t	GLB_MAGIC = 0x46546C67;		//glTF
+const uint32_t	GLB_CHUNK_JSON = 0x4E4F534A;
+const uint32_t	GLB_CHUNK_BIN = 0x004E4942;
+
+const int	GLTF_BYTE = 5120, GLTF_UNSIGNED_BYTE = 5121, GLTF_SHORT = 5122;
+const int	GLTF_UNSIGNED_SHORT = 5123, GLTF_UNSIGNED_INT = 5125, GLTF_FLOAT = 5126;
+
+const int	GLTF_TRIANGLES = 4, GLTF_TRIANGLE_STRIP = 5, GLTF_TRIANGLE_FAN = 6;
+
+//typed elements of the binary chunk
+struct GltfAccessor
+{
+	const char*	data;
+	size_t		count, stride;
+	int			componentType, nComponents;
+	bool		normalized;
+};
+
+static int componentSize(int componentType)
+{
+	switch (componentType)
+	{
+	case GLTF_BYTE: case GLTF_UNSIGNED_BYTE:	return 1;
+	case GLTF_SHORT: case GLTF_UNSIGNED_SHORT:	return 2;
+	case GLTF_UNSIGNED_INT: case GLTF_FLOAT:	return 4;
+	default:									return 0;
+	}
+}
+
+static double readComponent(const char* p, int componentType, bool normalized)
+{
+	switch (componentType)
+	{
+	case GLTF_BYTE:				{ int8_t v;		memcpy(&v, p, 1); return normalized ? std::max(v / 127.0, -1.0) : v; }
+	case GLTF_UNSIGNED_BYTE:	{ uint8_t v;	memcpy(&v, p, 1); return normalized ? v / 255.0 : v; }
+	case GLTF_SHORT:			{ int16_t v;	memcpy(&v, p, 2); return normalized ? std::max(v / 32767.0, -1.0) : v; }
+	case GLTF_UNSIGNED_SHORT:	{ uint16_t v;	memcpy(&v, p, 2); return normalized ? v / 65535.0 : v; }
+	case GLTF_UNSIGNED_INT:		{ uint32_t v;	memcpy(&v, p, 4); return v; }
+	default:					{ float v;		memcpy(&v, p, 4); return v; }
+	}
+}
+
+//an accessor within the bounds of the binary chunk, neither sparse nor in an external buffer
+static bool getAccessor(const Json& gltf, const Json& index, const char* bin, size_t binSize, GltfAccessor& accessor)
+{
+	size_t	accessorIndex, viewIndex;
+	if (!index.toIndex(accessorIndex)) return false;
+	const Json&	a = gltf["accessors"][accessorIndex];
+	if (a.type != Json::OBJECT || a.has("sparse") || !a["bufferView"].toIndex(viewIndex)) return false;
+
+	const Json&	view = gltf["bufferViews"][viewIndex];
+	if (view.type != Json::OBJECT || view["buffer"].value(-1) != 0 || gltf["buffers"][(size_t)0].has("uri")) return false;
+
+	static const char*	types[] = { "SCALAR", "VEC2", "VEC3", "VEC4" };
+	accessor.nComponents = 0;
+	for (int i = 0; i < 4; i++) if (a["type"].text == types[i]) accessor.nComponents = i + 1;
+
+	size_t	componentType;
+	if (!a["componentType"].toIndex(componentType, 0) || componentType > INT_MAX) return false;
+	accessor.componentType = (int)componentType;
+	accessor.normalized = a["normalized"].text == "true";
+
+	size_t	size = componentSize(accessor.componentType) * accessor.nComponents;
+	if (size == 0) return false;
+
+	size_t	viewOffset, viewLength, offset;
+	if (!a["count"].toIndex(accessor.count, 0) || !a["byteOffset"].toIndex(offset, 0) || !view["byteStride"].toIndex(accessor.stride, (double)size) ||
+		!view["byteOffset"].toIndex(viewOffset, 0) || !view["byteLength"].toIndex(viewLength, 0)) return false;
+
+	//in that order, as the sums and products of counts that large would wrap around
+	if (viewOffset > binSize || viewLength > binSize - viewOffset) return false;
+	if (accessor.count > 0)
+	{
+		if (offset > viewLength || size > viewLength - offset) return false;
+		if (accessor.stride > 0 && accessor.count - 1 > (viewLength - offset - size) / accessor.stride) return false;
+	}
+
+	accessor.data = bin + viewOffset + offset;
+	return true;
+}
+
+//triangles of a mesh placed by a node
+struct GltfPrimitive
+{
+	GltfAccessor	position, indices;
+	bool			indexed;
+	int				mode;
+	mat4			transform;
+};
+
+static bool isIdentity(const mat4& M)
+{
+	for (int i = 0; i < 4; i++)
+		for (int j = 0; j < 4; j++)
+			if (M[i][j] != ((i == j) ? 1.0f : 0.0f)) return false;
+	return true;
+}
+
+//matrix of a node, given or composed of its translation, rotation and scale
+static mat4 nodeTransform(const Json& node)
+{
+	mat4	M(1.0f);
+	const Json&	m = node["matrix"];
+	if (m.size() == 16)
+	{
+		for (int i = 0; i < 16; i++) M[i / 4][i % 4] = (float)m[i].value(0);
+		return M;
+	}
+
+	const Json&	t = node["translation"];
+	const Json&	r = node["rotation"];
+	const Json&	s = node["scale"];
+	float	x = (float)r[0].value(0), y = (float)r[1].value(0), z = (float)r[2].value(0), w = (float)r[3].value(1);
+
+	M[0] = vec4(1 - 2 * (y * y + z * z), 2 * (x * y + z * w), 2 * (x * z - y * w), 0);
+	M[1] = vec4(2 * (x * y - z * w), 1 - 2 * (x * x + z * z), 2 * (y * z + x * w), 0);
+	M[2] = vec4(2 * (x * z + y * w), 2 * (y * z - x * w), 1 - 2 * (x * x + y * y), 0);
+	for (int i = 0; i < 3; i++) M[i] *= (float)s[i].value(1);
+	M[3] = vec4((float)t[0].value(0), (float)t[1].value(0), (float)t[2].value(0), 1);
+	return M;
+}
+
+static bool addMesh(const Json& gltf, const Json& mesh, const mat4& transform, const char* bin, size_t binSize, vector<GltfPrimitive>& primitives)
+{
+	const Json&	list = mesh["primitives"];
+	for (size_t i = 0; i < list.size(); i++)
+	{
+		const Json&		p = list[i];
+		GltfPrimitive	primitive;
+		size_t			mode;
+		if (!p["mode"].toIndex(mode, GLTF_TRIANGLES) || mode > INT_MAX) return false;
+		primitive.mode = (int)mode;
+		primitive.transform = transform;
+		if (primitive.mode < GLTF_TRIANGLES) continue;	//points and lines
+
+		if (!getAccessor(gltf, p["attributes"]["POSITION"], bin, binSize, primitive.position) || primitive.position.nComponents != 3) return false;
+
+		primitive.indexed = p.has("indices");
+		if (primitive.indexed)
+			if (!getAccessor(gltf, p["indices"], bin, binSize, primitive.indices) || primitive.indices.nComponents != 1) return false;
+
+		primitives.push_back(primitive);
+	}
+	return true;
+}
+
+//the nodes form trees, each with a single parent: a node reached twice is shared or in a cycle,
+//either of which would expand the scene exponentially, so visited marks the nodes placed so far
+static bool addNode(const Json& gltf, const Json& index, const mat4& parent, const char* bin, size_t binSize, vector<GltfPrimitive>& primitives,
+	vector<bool>& visited, int depth)
+{
+	size_t	i;
+	if (!index.toIndex(i) || i >= visited.size() || visited[i] || depth > MAX_JSON_DEPTH) return false;
+	visited[i] = true;
+
+	const Json&	node = gltf["nodes"][i];
+	if (node.type != Json::OBJECT) return false;
+
+	mat4	transform = parent * nodeTransform(node);
+	if (node.has("mesh"))
+	{
+		size_t	m;
+		if (!node["mesh"].toIndex(m)) return false;
+		const Json&	mesh = gltf["meshes"][m];
+		if (mesh.type != Json::OBJECT || !addMesh(gltf, mesh, transform, bin, binSize, primitives)) return false;
+	}
+
+	const Json&	children = node["children"];
+	for (size_t j = 0; j < children.size(); j++)
+		if (!addNode(gltf, children[j], transform, bin, binSize, primitives, visited, depth + 1)) return false;
+	return true;
+}
+
+static bool viewGLB(const char* filename, const MappedFile& file, MeshView& view)
+{
+	uint32_t	header[5];
+	if (file.size < sizeof(header))
+	{
+		cerr << filename << " is not a glTF binary file" << endl;
+		return false;
+	}
+	memcpy(header, file.data, sizeof(header));
+	if (header[0] != GLB_MAGIC || header[1] != 2 || header[4] != GLB_CHUNK_JSON || 20 + (size_t)header[3] > file.size)
+	{
+		cerr << filename << " is not a glTF 2.0 binary file" << endl;
+		return false;
+	}
+
+	const char*	json = file.data + 20;
+	const char*	jsonEnd = json + header[3];
+	Json		gltf;
+	if (!parseJson(json, jsonEnd, gltf) || gltf.type != Json::OBJECT)
+	{
+		cerr << filename << " has an invalid scene description" << endl;
+		return false;
+	}
+
+	//the binary chunk right after the 4-byte aligned JSON chunk
+	const char*	bin = NULL;
+	size_t		binSize = 0;
+	size_t		chunk = 20 + ((header[3] + 3) & ~3u);
+	if (chunk + 8 <= file.size)
+	{
+		uint32_t	chunkHeader[2];
+		memcpy(chunkHeader, file.data + chunk, sizeof(chunkHeader));
+		if (chunkHeader[1] == GLB_CHUNK_BIN && chunk + 8 + chunkHeader[0] <= file.size)
+		{
+			bin = file.data + chunk + 8;
+			binSize = chunkHeader[0];
+		}
+	}
+
+	//the meshes of the default scene placed by their nodes, or every mesh as it is without a scene
+	vector<GltfPrimitive>	primitives;
+	bool	valid = true;
+	if (gltf.has("scenes"))
+	{
+		size_t	scene = 0;
+		valid = gltf["scene"].toIndex(scene, 0);
+
+		const Json&		nodes = gltf["scenes"][scene]["nodes"];
+		vector<bool>	visited(gltf["nodes"].size(), false);
+		for (size_t i = 0; i < nodes.size() && valid; i++)
+			valid = addNode(gltf, nodes[i], mat4(1.0f), bin, binSize, primitives, visited, 0);
+	}
+	else
+		for (size_t i = 0; i < gltf["meshes"].size() && valid; i++)
+			valid = addMesh(gltf, gltf["meshes"][i], mat4(1.0f), bin, binSize, primitives);
+
+	if (!valid || primitives.empty())
+	{
+		cerr << filename << (valid ? " has no triangles" : " has an invalid node or an unsupported or invalid accessor") << endl;
+		return false;
+	}
+
+	//a single indexed triangle list of float positions and 32-bit indices in place
+	const GltfPrimitive&	first = primitives[0];
+	if (primitives.size() == 1 && first.mode == GLTF_TRIANGLES && isIdentity(first.transform) &&
+		first.position.componentType == GLTF_FLOAT && first.indexed &&
+		first.indices.componentType == GLTF_UNSIGNED_INT && first.indices.stride == 4)
+	{
+		view.vertex.data = first.position.data;
+		view.vertex.count = first.position.count;
+		view.vertex.stride = first.position.stride;
+		view.face.data = first.indices.data;
+		view.face.count = first.indices.count / 3;
+		view.face.stride = sizeof(uvec3);
+		view.inPlace = true;
+		return true;
+	}
+
+	//otherwise the primitives transformed and concatenated
+	for (const GltfPrimitive& primitive : primitives)
+	{
+		const GltfAccessor&	position = primitive.position;
+		uint32_t	base = (uint32_t)view.convertedVertex.size();
+		for (size_t v = 0; v < position.count; v++)
+		{
+			const char*	p = position.data + v * position.stride;
+			int			size = componentSize(position.componentType);
+			vec4		q(0, 0, 0, 1);
+			for (int c = 0; c < 3; c++) q[c] = (float)readComponent(p + c * size, position.componentType, position.normalized);
+			view.convertedVertex.push_back(vec3(primitive.transform * q));
+		}
+
+		//the vertices of a strip or a fan as a list of triangles
+		const GltfAccessor&	indices = primitive.indices;
+		size_t	n = primitive.indexed ? indices.count : position.count;
+		auto	vertex = [&](size_t k)
+		{
+			uint32_t	i = primitive.indexed ? (uint32_t)readComponent(indices.data + k * indices.stride, indices.componentType, false) : (uint32_t)k;
+			return base + i;
+		};
+
+		//a mirroring transform turns the triangles inside out
+		const mat4&	M = primitive.transform;
+		bool	mirrored = dot(cross(vec3(M[0]), vec3(M[1])), vec3(M[2])) < 0;
+
+		for (size_t k = 0; k + 2 < n; k += (primitive.mode == GLTF_TRIANGLES) ? 3 : 1)
+		{
+			uvec3	t;
+			if (primitive.mode == GLTF_TRIANGLES)			t = uvec3(vertex(k), vertex(k + 1), vertex(k + 2));
+			else if (primitive.mode == GLTF_TRIANGLE_STRIP)	t = (k % 2 == 0) ? uvec3(vertex(k), vertex(k + 1), vertex(k + 2)) : uvec3(vertex(k + 1), vertex(k), vertex(k + 2));
+			else											t = uvec3(vertex(0), vertex(k + 1), vertex(k + 2));
+			if (mirrored) swap(t[1], t[2]);
+			view.convertedFace.push_back(t);
+		}
+	}
+
+	view.vertex.data = (const char*)view.convertedVertex.data();
+	view.vertex.count = view.convertedVertex.size();
+	view.vertex.stride = sizeof(vec3);
+	view.face.data = (const char*)view.convertedFace.data();
+	view.face.count = view.convertedFace.size();
+	view.face.stride = sizeof(uvec3);
+	view.inPlace = false;
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool viewMesh(const char* filename, const MappedFile& file, MeshView& view)
+{
+	view.vertex = BufferView<vec3>();
+	view.face = BufferView<uvec3>();
+	view.inPlace = true;
+	view.convertedVertex.clear();
+	view.convertedFace.clear();
+
+	if (hasExtension(filename, ".ply")) return viewPLY(filename, file, view);
+	if (hasExtension(filename, ".glb")) return viewGLB(filename, file, view);
+
+	cerr << filename << " is neither a PLY nor a glTF binary file" << endl;
+	return false;
+}
+
+bool mapMeshView(const char* filename, MeshView& view)
+{
+	view.file = MappedFile();
+	if (!mapFile(filename, view.file))
+	{
+		cerr << "Can't open " << filename << endl;
+		return false;
+	}
+
+	if (!viewMesh(filename, view.file, view))
+	{
+		unmapMeshView(view);
+		return false;
+	}
+	return true;
+}
+
+void unmapMeshView(MeshView& view)
+{
+	unmapFile(view.file);
+	view.vertex = BufferView<vec3>();
+	view.face = BufferView<uvec3>();
+	view.convertedVertex.clear();
+	view.convertedFace.clear();
+}
+
+bool copyMeshView(const char* filename, const MeshView& view, Mesh& mesh)
+{
+	if (view.vertex.count > INT_MAX || view.face.count > INT_MAX)
+	{
+		cerr << filename << " is too large" << endl;
+		return false;
+	}
+
+	int		nVertices = (int)view.vertex.count;
+	int		nFaces = (int)view.face.count;
+	createMesh(mesh, nVertices, nFaces);
+
+	bool	valid = true;
+#pragma omp parallel for schedule(static) reduction(&&:valid)
+	for (int i = 0; i < nFaces; i++)
+	{
+		uvec3	f = view.face[i];
+		mesh.face[i] = f;
+		valid = valid && f[0] < (uint32_t)nVertices && f[1] < (uint32_t)nVertices && f[2] < (uint32_t)nVertices;
+	}
+
+#pragma omp parallel for schedule(static)
+	for (int v = 0; v < nVertices; v++)
+		mesh.vertex[v] = view.vertex[v];
+
+	if (!valid)
+	{
+		cerr << filename << " has invalid faces" << endl;
+		deleteMesh(mesh);
+		return false;
+	}
+
+	meshLog() << "# vertices = " << nVertices << endl;
+	meshLog() << "# faces = " << nFaces << (view.inPlace ? "" : " (converted)") << endl;
+	return true;
+}
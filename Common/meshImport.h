@@ -0,0 +1,57 @@
+#ifndef __MESH_IMPORT_H_
+#define __MESH_IMPORT_H_
+
+#include "mesh.h"
+
+#include <string.h>
+#include <vector>
+
+//elements of a type at a fixed stride in memory, e.g., the positions interleaved with
+//the other vertex attributes of a mapped file, copied out as they may be unaligned
+template <typename T>
+struct BufferView
+{
+	const char*	data;
+	size_t		count;
+	size_t		stride;		//in bytes
+
+	T operator[](size_t i) const
+	{
+		T	element;
+		memcpy(&element, data + i * stride, sizeof(T));
+		return element;
+	}
+};
+
+//vertex positions and triangles of a mesh file viewed in place where its layout allows,
+//i.e., little-endian float coordinates and 32-bit indices of triangles,
+//converted into the arrays below otherwise, e.g., polygons, big-endian or 16-bit data
+//the views may point into the arrays, so it is not to be copied
+struct MeshView
+{
+	BufferView<glm::vec3>	vertex;
+	BufferView<glm::uvec3>	face;
+
+	bool		inPlace;	//neither view converted
+
+	std::vector<glm::vec3>	convertedVertex;
+	std::vector<glm::uvec3>	convertedFace;
+
+	MappedFile	file;		//mapped by mapMeshView() only
+};
+
+//binary PLY files of either byte order and glTF binary (.glb) files are viewed
+bool isViewedMeshFile(const char* filename);
+
+//view a file mapped by the caller, chosen by its extension
+//a .glb file gives the triangles of every mesh in its default scene, transformed by their nodes
+bool viewMesh(const char* filename, const MappedFile& file, MeshView& view);
+
+//map a file and view it
+bool mapMeshView(const char* filename, MeshView& view);
+void unmapMeshView(MeshView& view);
+
+//a mesh of its own from a view after validating the indices, its normals and centers not computed
+bool copyMeshView(const char* filename, const MeshView& view, Mesh& mesh);
+
+#endif
@@ -0,0 +1,226 @@
+#include "meshOptimize.h"
+
+#include <string.h>
+#include <vector>
+#include <algorithm>
+using namespace std;
+using namespace glm;
+
+VertexCacheStats analyzeVertexCache(const Mesh& mesh, int cacheSize)
+{
+	//a vertex stays in the FIFO until cacheSize misses follow its insertion
+	vector<int>	inserted(mesh.nVertices, -cacheSize - 1);
+	int		misses = 0;
+
+	for (int i = 0; i < mesh.nFaces; i++)
+		for (int j = 0; j < 3; j++)
+		{
+			int		v = mesh.face[i][j];
+			if (misses - inserted[v] > cacheSize)
+			{
+				inserted[v] = misses;
+				misses++;
+			}
+		}
+
+	VertexCacheStats	stats;
+	stats.acmr = (mesh.nFaces > 0) ? (float)misses / mesh.nFaces : 0;
+	stats.atvr = (mesh.nVertices > 0) ? (float)misses / mesh.nVertices : 0;
+
+	return stats;
+}
+
+//Tipsify: fan around the vertex whose remaining faces still fit in the cache
+//returns the faces in the new order and the first face of every cluster
+static void tipsify(const Mesh& mesh, const VertexFaces& adjacency, int cacheSize,
+	vector<int>& order, vector<int>& clusterStart)
+{
+	int		nVertices = mesh.nVertices;
+
+	vector<int>		live(nVertices);		//# faces not emitted yet
+	vector<int>		timestamp(nVertices, 0);
+	vector<char>	emitted(mesh.nFaces, 0);
+	vector<int>		deadEnd;				//recently used vertices to continue from
+	vector<int>		candidate;
+
+	for (int v = 0; v < nVertices; v++)
+		live[v] = adjacency.start[v + 1] - adjacency.start[v];
+
+	order.clear();
+	clusterStart.clear();
+
+	int		time = cacheSize + 1;
+	int		cursor = 0;		//next vertex to try after running out of dead ends
+	int		f = -1;
+
+	while (true)
+	{
+		if (f < 0)
+		{
+			//skip a dead end: the most recent vertex with live faces or the next one in input order
+			while (!deadEnd.empty() && f < 0)
+			{
+				int		d = deadEnd.back();
+				deadEnd.pop_back();
+				if (live[d] > 0) f = d;
+			}
+			while (f < 0 && cursor < nVertices)
+			{
+				if (live[cursor] > 0) f = cursor;
+				cursor++;
+			}
+			if (f < 0) break;
+
+			//a new cluster starts with the cache effectively flushed
+			clusterStart.push_back((int)order.size());
+		}
+
+		//emit the remaining faces around f
+		candidate.clear();
+		for (int k = adjacency.start[f]; k < adjacency.start[f + 1]; k++)
+		{
+			int		t = adjacency.faces[k];
+			if (emitted[t]) continue;
+
+			for (int j = 0; j < 3; j++)
+			{
+				int		v = mesh.face[t][j];
+				deadEnd.push_back(v);
+				candidate.push_back(v);
+				live[v]--;
+				if (time - timestamp[v] > cacheSize) { timestamp[v] = time; time++; }
+			}
+			emitted[t] = 1;
+			order.push_back(t);
+		}
+
+		//next fanning vertex: the oldest one in the cache whose faces still fit in it
+		int		next = -1, best = -1;
+		for (size_t c = 0; c < candidate.size(); c++)
+		{
+			int		v = candidate[c];
+			if (live[v] <= 0) continue;
+
+			int		priority = 0;
+			if (time - timestamp[v] + 2 * live[v] <= cacheSize) priority = time - timestamp[v];
+			if (priority > best) { best = priority; next = v; }
+		}
+
+		f = next;
+	}
+}
+
+//area-weighted normal of a face
+static inline vec3 areaNormal(const Mesh& mesh, int i)
+{
+	return cross(mesh.vertex[mesh.face[i][1]] - mesh.vertex[mesh.face[i][0]],
+		mesh.vertex[mesh.face[i][2]] - mesh.vertex[mesh.face[i][0]]);
+}
+
+//sort the clusters by how much they face away from the center so that
+//the outer clusters are drawn first and occlude the inner ones
+static void sortClusters(const Mesh& mesh, vector<int>& order, const vector<int>& clusterStart)
+{
+	int		nClusters = (int)clusterStart.size();
+	if (nClusters < 2) return;
+
+	//area-weighted centroid of the mesh
+	vec3	centroid(0, 0, 0);
+	float	area = 0;
+	for (int i = 0; i < mesh.nFaces; i++)
+	{
+		float	a = length(areaNormal(mesh, i));
+		centroid += a * mesh.fcenter[i];
+		area += a;
+	}
+	if (area > 0) centroid /= area;
+
+	vector<float>	key(nClusters);
+#pragma omp parallel for schedule(dynamic)
+	for (int c = 0; c < nClusters; c++)
+	{
+		int		end = (c + 1 < nClusters) ? clusterStart[c + 1] : (int)order.size();
+
+		vec3	n(0, 0, 0), p(0, 0, 0);
+		float	a = 0;
+		for (int k = clusterStart[c]; k < end; k++)
+		{
+			vec3	an = areaNormal(mesh, order[k]);
+			float	l = length(an);
+			n += an;
+			p += l * mesh.fcenter[order[k]];
+			a += l;
+		}
+		if (a > 0) p /= a;
+
+		key[c] = (dot(n, n) > 0) ? dot(p - centroid, normalize(n)) : 0;
+	}
+
+	vector<int>	cluster(nClusters);
+	for (int c = 0; c < nClusters; c++) cluster[c] = c;
+	stable_sort(cluster.begin(), cluster.end(), [&](int a, int b) { return key[a] > key[b]; });
+
+	vector<int>	sorted;
+	sorted.reserve(order.size());
+	for (int c = 0; c < nClusters; c++)
+	{
+		int		begin = clusterStart[cluster[c]];
+		int		end = (cluster[c] + 1 < nClusters) ? clusterStart[cluster[c] + 1] : (int)order.size();
+		sorted.insert(sorted.end(), order.begin() + begin, order.begin() + end);
+	}
+	order.swap(sorted);
+}
+
+//apply the permutation to an array of n elements
+template <typename T>
+static void permute(T* data, const int* order, int n)
+{
+	vector<T>	copy(data, data + n);
+	for (int i = 0; i < n; i++)
+		data[i] = copy[order[i]];
+}
+
+void optimizeMesh(Mesh& mesh, bool reduceOverdraw, int cacheSize)
+{
+	if (mesh.nFaces == 0) return;
+
+	VertexFaces	adjacency;
+	buildVertexFaces(mesh, adjacency);
+
+	vector<int>	order, clusterStart;
+	tipsify(mesh, adjacency, cacheSize, order, clusterStart);
+	deleteVertexFaces(adjacency);
+
+	if (reduceOverdraw) sortClusters(mesh, order, clusterStart);
+
+	reorderMesh(mesh, order.data());
+}
+
+void reorderMesh(Mesh& mesh, const int* order)
+{
+	//faces in the new order
+	permute(mesh.face, order, mesh.nFaces);
+	permute(mesh.fnormal, order, mesh.nFaces);
+	permute(mesh.fcenter, order, mesh.nFaces);
+
+	//vertices in the order of their first use
+	vector<int>	remap(mesh.nVertices, -1);
+	vector<int>	vertexOrder;
+	vertexOrder.reserve(mesh.nVertices);
+	for (int i = 0; i < mesh.nFaces; i++)
+		for (int j = 0; j < 3; j++)
+		{
+			int		v = mesh.face[i][j];
+			if (remap[v] < 0) { remap[v] = (int)vertexOrder.size(); vertexOrder.push_back(v); }
+		}
+	for (int v = 0; v < mesh.nVertices; v++)	//unreferenced vertices last
+		if (remap[v] < 0) { remap[v] = (int)vertexOrder.size(); vertexOrder.push_back(v); }
+
+	permute(mesh.vertex, vertexOrder.data(), mesh.nVertices);
+	permute(mesh.vnormal, vertexOrder.data(), mesh.nVertices);
+
+#pragma omp parallel for schedule(static)
+	for (int i = 0; i < mesh.nFaces; i++)
+		for (int j = 0; j < 3; j++)
+			mesh.face[i][j] = remap[mesh.face[i][j]];
+}
@@ -0,0 +1,26 @@
+#ifndef __MESH_OPTIMIZE_H_
+#define __MESH_OPTIMIZE_H_
+
+#include "mesh.h"
+
+//FIFO post-transform vertex cache assumed by the optimization
+const int	VERTEX_CACHE_SIZE = 16;
+
+//average transformed vertices per triangle (ACMR) and per vertex (ATVR)
+struct VertexCacheStats
+{
+	float	acmr;	//0.5 at best for large regular meshes, 3 at worst
+	float	atvr;	//1 at best
+};
+
+VertexCacheStats analyzeVertexCache(const Mesh& mesh, int cacheSize = VERTEX_CACHE_SIZE);
+
+//reorder the faces for the vertex cache (Tipsify) and optionally the clusters
+//between its cache flushes from the outside in to reduce overdraw,
+//then the vertices in the order of their first use for the vertex fetch
+void optimizeMesh(Mesh& mesh, bool reduceOverdraw = true, int cacheSize = VERTEX_CACHE_SIZE);
+
+//faces in the given order, order[i] becoming face i, then the vertices in the order of their first use
+void reorderMesh(Mesh& mesh, const int* order);
+
+#endif
@@ -0,0 +1,387 @@
+#include "meshSimplify.h"
+#include "meshOptimize.h"
+
+#include <math.h>
+#include <vector>
+#include <queue>
+#include <algorithm>
+#include <iostream>
+using namespace std;
+using namespace glm;
+
+//border edges are kept by planes through them perpendicular to their face
+const double	BORDER_WEIGHT = 100;
+
+//collapses turning an adjacent face by more than this are rejected
+const float		MIN_NORMAL_COS = 0.2f;
+
+//symmetric 4x4 matrix summing the squared distances to planes (n, d) with weights
+struct Quadric
+{
+	double	a00, a01, a02, a03, a11, a12, a13, a22, a23, a33;
+	double	weight;
+};
+
+static void addPlane(Quadric& q, const dvec3& n, double d, double w)
+{
+	q.a00 += w * n.x * n.x;	q.a01 += w * n.x * n.y;	q.a02 += w * n.x * n.z;	q.a03 += w * n.x * d;
+	q.a11 += w * n.y * n.y;	q.a12 += w * n.y * n.z;	q.a13 += w * n.y * d;
+	q.a22 += w * n.z * n.z;	q.a23 += w * n.z * d;
+	q.a33 += w * d * d;
+	q.weight += w;
+}
+
+static void addQuadric(Quadric& q, const Quadric& r)
+{
+	q.a00 += r.a00;	q.a01 += r.a01;	q.a02 += r.a02;	q.a03 += r.a03;
+	q.a11 += r.a11;	q.a12 += r.a12;	q.a13 += r.a13;
+	q.a22 += r.a22;	q.a23 += r.a23;
+	q.a33 += r.a33;
+	q.weight += r.weight;
+}
+
+static double evaluate(const Quadric& q, const dvec3& p)
+{
+	double	e = q.a00 * p.x * p.x + 2 * q.a01 * p.x * p.y + 2 * q.a02 * p.x * p.z + 2 * q.a03 * p.x
+		+ q.a11 * p.y * p.y + 2 * q.a12 * p.y * p.z + 2 * q.a13 * p.y
+		+ q.a22 * p.z * p.z + 2 * q.a23 * p.z
+		+ q.a33;
+	return e > 0 ? e : 0;
+}
+
+//position minimizing the quadric, or false if it is not unique
+static bool minimize(const Quadric& q, dvec3& p)
+{
+	double	c00 = q.a11 * q.a22 - q.a12 * q.a12;
+	double	c01 = q.a02 * q.a12 - q.a01 * q.a22;
+	double	c02 = q.a01 * q.a12 - q.a02 * q.a11;
+	double	det = q.a00 * c00 + q.a01 * c01 + q.a02 * c02;
+
+	double	scale = q.a00 + q.a11 + q.a22;
+	if (fabs(det) <= 1e-9 * scale * scale * scale) return false;
+
+	double	c11 = q.a00 * q.a22 - q.a02 * q.a02;
+	double	c12 = q.a01 * q.a02 - q.a00 * q.a12;
+	double	c22 = q.a00 * q.a11 - q.a01 * q.a01;
+
+	p.x = -(c00 * q.a03 + c01 * q.a13 + c02 * q.a23) / det;
+	p.y = -(c01 * q.a03 + c11 * q.a13 + c12 * q.a23) / det;
+	p.z = -(c02 * q.a03 + c12 * q.a13 + c22 * q.a23) / det;
+	return true;
+}
+
+//candidate collapse of the edge (v0, v1) into v0 at p
+//stale once either vertex changed after the candidate was made
+struct Collapse
+{
+	double	cost;
+	int		v0, v1;
+	int		stamp0, stamp1;
+	vec3	p;
+
+	bool operator>(const Collapse& c) const { return cost > c.cost; }
+};
+
+//working copy of the mesh reduced by collapses
+struct Simplifier
+{
+	vector<vec3>		position;
+	vector<Quadric>		quadric;
+	vector<int>			stamp;		//incremented on each change of the vertex, -1 once removed
+	vector<vector<int>>	vfaces;		//remaining faces around each vertex
+
+	vector<ivec3>		face;
+	vector<bool>		faceAlive;
+	int					nFaces;
+
+	priority_queue<Collapse, vector<Collapse>, greater<Collapse>>	heap;
+};
+
+static void initialize(const Mesh& mesh, Simplifier& s)
+{
+	s.position.assign(mesh.vertex, mesh.vertex + mesh.nVertices);
+	s.quadric.assign(mesh.nVertices, Quadric());
+	s.stamp.assign(mesh.nVertices, 0);
+	s.vfaces.assign(mesh.nVertices, vector<int>());
+	s.face.resize(mesh.nFaces);
+	for (int i = 0; i < mesh.nFaces; i++) s.face[i] = ivec3(mesh.face[i]);
+	s.faceAlive.assign(mesh.nFaces, true);
+	s.nFaces = mesh.nFaces;
+
+	//area weighted planes of the faces
+	for (int i = 0; i < mesh.nFaces; i++)
+	{
+		dvec3	p0(s.position[s.face[i][0]]);
+		dvec3	n = cross(dvec3(s.position[s.face[i][1]]) - p0, dvec3(s.position[s.face[i][2]]) - p0);
+		double	area = 0.5 * length(n);
+		if (area > 0)
+		{
+			n /= 2 * area;
+			for (int j = 0; j < 3; j++) addPlane(s.quadric[s.face[i][j]], n, -dot(n, p0), area);
+		}
+
+		for (int j = 0; j < 3; j++) s.vfaces[s.face[i][j]].push_back(i);
+	}
+
+	//border edges are the ones used by a single face
+	struct Edge { int a, b, f; };
+	vector<Edge>	edges;
+	edges.reserve(3 * mesh.nFaces);
+	for (int i = 0; i < mesh.nFaces; i++)
+		for (int j = 0; j < 3; j++)
+		{
+			int		a = s.face[i][j], b = s.face[i][(j + 1) % 3];
+			edges.push_back({ std::min(a, b), std::max(a, b), i });
+		}
+	sort(edges.begin(), edges.end(), [](const Edge& e, const Edge& f) { return e.a < f.a || (e.a == f.a && e.b < f.b); });
+
+	for (size_t k = 0; k < edges.size(); )
+	{
+		size_t	m = k + 1;
+		while (m < edges.size() && edges[m].a == edges[k].a && edges[m].b == edges[k].b) m++;
+		if (m == k + 1)
+		{
+			const Edge&	e = edges[k];
+			dvec3	pa(s.position[e.a]), pb(s.position[e.b]);
+			dvec3	p0(s.position[s.face[e.f][0]]);
+			dvec3	fn = cross(dvec3(s.position[s.face[e.f][1]]) - p0, dvec3(s.position[s.face[e.f][2]]) - p0);
+			dvec3	n = cross(pb - pa, fn);
+			double	len = length(n);
+			if (len > 0)
+			{
+				n /= len;
+				double	w = BORDER_WEIGHT * dot(pb - pa, pb - pa);
+				addPlane(s.quadric[e.a], n, -dot(n, pa), w);
+				addPlane(s.quadric[e.b], n, -dot(n, pa), w);
+			}
+		}
+		k = m;
+	}
+}
+
+static void pushCollapse(Simplifier& s, int v0, int v1)
+{
+	Quadric	q = s.quadric[v0];
+	addQuadric(q, s.quadric[v1]);
+
+	//optimal position, or the best of the end points and the midpoint
+	dvec3	p;
+	double	cost;
+	if (minimize(q, p)) cost = evaluate(q, p);
+	else
+	{
+		dvec3	candidate[3] = { dvec3(s.position[v0]), dvec3(s.position[v1]), 0.5 * (dvec3(s.position[v0]) + dvec3(s.position[v1])) };
+		p = candidate[0];
+		cost = evaluate(q, p);
+		for (int k = 1; k < 3; k++)
+		{
+			double	c = evaluate(q, candidate[k]);
+			if (c < cost) { cost = c; p = candidate[k]; }
+		}
+	}
+
+	s.heap.push({ cost, v0, v1, s.stamp[v0], s.stamp[v1], vec3(p) });
+}
+
+static inline bool hasVertex(const Simplifier& s, int f, int v)
+{
+	return s.face[f][0] == v || s.face[f][1] == v || s.face[f][2] == v;
+}
+
+static void neighbors(const Simplifier& s, int v, vector<int>& result)
+{
+	result.clear();
+	for (int f : s.vfaces[v])
+		for (int j = 0; j < 3; j++)
+			if (s.face[f][j] != v) result.push_back(s.face[f][j]);
+	sort(result.begin(), result.end());
+	result.erase(unique(result.begin(), result.end()), result.end());
+}
+
+static void removeFace(Simplifier& s, int v, int f)
+{
+	vector<int>&	faces = s.vfaces[v];
+	faces.erase(find(faces.begin(), faces.end(), f));
+}
+
+//the collapse keeps the surface manifold (link condition) and does not fold any face over
+static bool isValid(const Simplifier& s, const Collapse& c, vector<int>& n0, vector<int>& n1)
+{
+	int		shared = 0;
+	for (int f : s.vfaces[c.v0]) if (hasVertex(s, f, c.v1)) shared++;
+
+	neighbors(s, c.v0, n0);
+	neighbors(s, c.v1, n1);
+	int		common = 0;
+	for (size_t i = 0, j = 0; i < n0.size() && j < n1.size(); )
+	{
+		if (n0[i] < n1[j]) i++;
+		else if (n1[j] < n0[i]) j++;
+		else { common++; i++; j++; }
+	}
+	if (common != shared) return false;
+
+	for (int k = 0; k < 2; k++)
+	{
+		int		v = k == 0 ? c.v0 : c.v1, other = k == 0 ? c.v1 : c.v0;
+		for (int f : s.vfaces[v])
+		{
+			if (hasVertex(s, f, other)) continue;
+
+			vec3	p[3], q[3];
+			for (int j = 0; j < 3; j++)
+			{
+				p[j] = s.position[s.face[f][j]];
+				q[j] = s.face[f][j] == v ? c.p : p[j];
+			}
+			vec3	before = cross(p[1] - p[0], p[2] - p[0]);
+			vec3	after = cross(q[1] - q[0], q[2] - q[0]);
+			float	lb = length(before), la = length(after);
+			if (la == 0 || dot(before, after) < MIN_NORMAL_COS * lb * la) return false;
+		}
+	}
+	return true;
+}
+
+static void collapse(Simplifier& s, const Collapse& c)
+{
+	int		v0 = c.v0, v1 = c.v1;
+
+	s.position[v0] = c.p;
+	addQuadric(s.quadric[v0], s.quadric[v1]);
+
+	for (int f : s.vfaces[v1])
+	{
+		if (hasVertex(s, f, v0))
+		{
+			for (int j = 0; j < 3; j++) if (s.face[f][j] != v1) removeFace(s, s.face[f][j], f);
+			s.faceAlive[f] = false;
+			s.nFaces--;
+		}
+		else
+		{
+			for (int j = 0; j < 3; j++) if (s.face[f][j] == v1) s.face[f][j] = v0;
+			s.vfaces[v0].push_back(f);
+		}
+	}
+	s.vfaces[v1].clear();
+	s.stamp[v1] = -1;
+	s.stamp[v0]++;
+}
+
+//compact the remaining faces and vertices into a new mesh
+static Mesh* extract(const Simplifier& s)
+{
+	vector<int>	remap(s.position.size(), -1);
+	int			nVertices = 0;
+	for (size_t i = 0; i < s.faceAlive.size(); i++)
+		if (s.faceAlive[i])
+			for (int j = 0; j < 3; j++)
+				if (remap[s.face[i][j]] < 0) remap[s.face[i][j]] = nVertices++;
+
+	Mesh*	mesh = new Mesh();
+	createMesh(*mesh, nVertices, s.nFaces);
+	for (size_t v = 0; v < remap.size(); v++)
+		if (remap[v] >= 0) mesh->vertex[remap[v]] = s.position[v];
+
+	int		k = 0;
+	for (size_t i = 0; i < s.faceAlive.size(); i++)
+		if (s.faceAlive[i])
+		{
+			for (int j = 0; j < 3; j++) mesh->face[k][j] = remap[s.face[i][j]];
+			k++;
+		}
+
+	computeNormals(*mesh);
+	computeCenters(*mesh);
+	optimizeMesh(*mesh);
+	return mesh;
+}
+
+void buildMeshLOD(Mesh& mesh, MeshLOD& lod, int nLevels, float ratio, int minFaces)
+{
+	lod = MeshLOD();
+	lod.nLevels = 1;
+	lod.level[0] = &mesh;
+	lod.error[0] = 0;
+
+	lod.center = 0.5f * (mesh.bmin + mesh.bmax);
+	lod.radius = 0;
+	for (int i = 0; i < mesh.nVertices; i++)
+		lod.radius = std::max(lod.radius, length(mesh.vertex[i] - lod.center));
+
+	nLevels = std::min(nLevels, MAX_LOD_LEVELS);
+	if (nLevels < 2 || mesh.nFaces * ratio < minFaces) return;
+
+	Simplifier	s;
+	initialize(mesh, s);
+
+	vector<int>	n0, n1;
+	for (int v = 0; v < mesh.nVertices; v++)
+	{
+		neighbors(s, v, n0);
+		for (int n : n0) if (v < n) pushCollapse(s, v, n);
+	}
+
+	float	maxError = 0;
+	int		target = (int)(mesh.nFaces * ratio);
+	while (lod.nLevels < nLevels && target >= minFaces)
+	{
+		while (s.nFaces > target && !s.heap.empty())
+		{
+			Collapse	c = s.heap.top();
+			s.heap.pop();
+
+			if (s.stamp[c.v0] != c.stamp0 || s.stamp[c.v1] != c.stamp1) continue;
+			if (!isValid(s, c, n0, n1)) continue;
+
+			//deviation as the root mean square distance to the planes merged so far
+			double	weight = s.quadric[c.v0].weight + s.quadric[c.v1].weight;
+			if (weight > 0) maxError = std::max(maxError, (float)sqrt(c.cost / weight));
+
+			collapse(s, c);
+
+			neighbors(s, c.v0, n0);
+			for (int n : n0) pushCollapse(s, c.v0, n);
+		}
+
+		//no further collapse without breaking the surface
+		if (s.nFaces > target && s.nFaces >= lod.level[lod.nLevels - 1]->nFaces * (1 + ratio) / 2) break;
+
+		lod.level[lod.nLevels] = extract(s);
+		lod.error[lod.nLevels] = maxError;
+		lod.nLevels++;
+
+		target = (int)(s.nFaces * ratio);
+	}
+
+	cout << "LOD faces =";
+	for (int l = 0; l < lod.nLevels; l++) cout << " " << lod.level[l]->nFaces;
+	cout << endl;
+}
+
+void deleteMeshLOD(MeshLOD& lod)
+{
+	for (int l = 1; l < lod.nLevels; l++)
+	{
+		deleteMesh(*lod.level[l]);
+		delete lod.level[l];
+	}
+	lod = MeshLOD();
+}
+
+float pixelsPerUnit(float distance, float fovy, int viewportH)
+{
+	return viewportH / (2 * distance * tanf(radians(fovy) / 2));
+}
+
+int selectLOD(MeshLOD& lod, float pixelsPerUnit, float maxPixels, float hysteresis)
+{
+	int&	l = lod.current;
+	l = std::min(l, lod.nLevels - 1);
+
+	while (l + 1 < lod.nLevels && lod.error[l + 1] * pixelsPerUnit <= (1 - hysteresis) * maxPixels) l++;
+	while (l > 0 && lod.error[l] * pixelsPerUnit > (1 + hysteresis) * maxPixels) l--;
+
+	return l;
+}
@@ -0,0 +1,35 @@
+#ifndef __MESH_SIMPLIFY_H_
+#define __MESH_SIMPLIFY_H_
+
+#include "mesh.h"
+
+const int	MAX_LOD_LEVELS = 8;
+
+//chain of levels of detail, each with about ratio times the faces of the previous one
+//level 0 is the mesh itself, which the chain does not own
+struct MeshLOD
+{
+	int		nLevels;
+	Mesh*	level[MAX_LOD_LEVELS];
+	float	error[MAX_LOD_LEVELS];	//object space deviation from level 0
+
+	glm::vec3	center;		//bounding sphere of level 0
+	float		radius;
+
+	int		current;		//level selected last
+};
+
+//simplify the mesh by quadric error edge collapses, keeping its borders,
+//until a level would have fewer than minFaces faces or cannot be reduced further
+void buildMeshLOD(Mesh& mesh, MeshLOD& lod, int nLevels = MAX_LOD_LEVELS, float ratio = 0.5f, int minFaces = 256);
+void deleteMeshLOD(MeshLOD& lod);
+
+//pixels covered by a unit length at the given distance from the eye
+//with the vertical field of view fovy (degree) on a viewport of the given height
+float pixelsPerUnit(float distance, float fovy, int viewportH);
+
+//select the coarsest level whose error projects to at most maxPixels
+//the selection moves coarser only below (1 - hysteresis) maxPixels and finer only above (1 + hysteresis) maxPixels
+int selectLOD(MeshLOD& lod, float pixelsPerUnit, float maxPixels = 1.0f, float hysteresis = 0.25f);
+
+#endif
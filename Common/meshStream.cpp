@@ -0,0 +1,345 @@
+#include "meshStream.h"
+#include "meshOptimize.h"
+
+#include <math.h>
+#include <string.h>
+#include <charconv>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+using namespace std;
+using namespace glm;
+
+//file read in chunks of this size, grown only for a longer line
+const size_t	READ_CHUNK = 1 << 20;
+
+//vertices written to the temporary file in blocks
+const int		VERTEX_BLOCK = 1 << 16;
+
+//lines of a file read through a bounded buffer
+struct LineReader
+{
+	FILE*			fp;
+	vector<char>	buffer;
+	size_t			begin, end;
+	bool			eof;
+};
+
+static void openReader(LineReader& r, FILE* fp)
+{
+	r.fp = fp;
+	r.buffer.resize(READ_CHUNK);
+	r.begin = r.end = 0;
+	r.eof = false;
+}
+
+static void refill(LineReader& r)
+{
+	//the partial line moves to the front
+	memmove(r.buffer.data(), r.buffer.data() + r.begin, r.end - r.begin);
+	r.end -= r.begin;
+	r.begin = 0;
+
+	if (r.end == r.buffer.size()) r.buffer.resize(2 * r.buffer.size());
+
+	size_t	n = fread(r.buffer.data() + r.end, 1, r.buffer.size() - r.end, r.fp);
+	r.end += n;
+	if (n == 0) r.eof = true;
+}
+
+static inline bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+static inline const char* skipSpaces(const char* p, const char* end)
+{
+	while (p < end && isSpace(*p)) p++;
+	return p;
+}
+
+template <typename T>
+static inline bool parse(const char*& p, const char* end, T& value)
+{
+	p = skipSpaces(p, end);
+	from_chars_result	r = from_chars(p, end, value);
+	if (r.ec != errc()) return false;
+	p = r.ptr;
+	return true;
+}
+
+//next line holding data, i.e., neither empty nor a comment
+static bool nextDataLine(LineReader& r, const char*& line, const char*& lineEnd)
+{
+	for (;;)
+	{
+		const char*	p = r.buffer.data() + r.begin;
+		const char*	end = r.buffer.data() + r.end;
+		const char*	q = (const char*)memchr(p, '\n', end - p);
+		if (q == NULL)
+		{
+			if (!r.eof) { refill(r); continue; }
+			if (p == end) return false;
+			q = end;	//last line without a newline
+		}
+
+		r.begin = q - r.buffer.data() + (q < end ? 1 : 0);
+
+		p = skipSpaces(p, q);
+		if (p < q && *p != '#')
+		{
+			line = p;
+			lineEnd = q;
+			return true;
+		}
+	}
+}
+
+static size_t clusterBytes(const Mesh& mesh)
+{
+	return (2 * sizeof(vec3)) * mesh.nVertices + (2 * sizeof(vec3) + 3 * sizeof(int)) * mesh.nFaces;
+}
+
+//cluster of the given faces with their vertices renumbered
+static Mesh* createCluster(const vector<int>& faces, const vec3* position)
+{
+	vector<int>	vertices(faces);
+	sort(vertices.begin(), vertices.end());
+	vertices.erase(unique(vertices.begin(), vertices.end()), vertices.end());
+
+	Mesh*	cluster = new Mesh();
+	int		nFaces = (int)faces.size() / 3;
+	createMesh(*cluster, (int)vertices.size(), nFaces);
+
+	for (size_t v = 0; v < vertices.size(); v++)
+		cluster->vertex[v] = position[vertices[v]];
+	for (int i = 0; i < nFaces; i++)
+		for (int j = 0; j < 3; j++)
+			cluster->face[i][j] = (int)(lower_bound(vertices.begin(), vertices.end(), faces[3 * i + j]) - vertices.begin());
+
+	computeNormals(*cluster);
+	computeCenters(*cluster);
+	optimizeMesh(*cluster);
+	return cluster;
+}
+
+//hand a cluster to the consumer, waiting while the taken ones exceed half the budget
+static void emit(MeshStream& stream, Mesh* cluster)
+{
+	size_t	bytes = clusterBytes(*cluster);
+
+	unique_lock<mutex>	lock(stream.mutex);
+	stream.taken.wait(lock, [&] { return stream.cancel || stream.ready.empty() || stream.readyBytes + bytes <= stream.budget / 2; });
+	if (stream.cancel)
+	{
+		deleteMesh(*cluster);
+		delete cluster;
+		return;
+	}
+
+	stream.ready.push_back(cluster);
+	stream.readyBytes += bytes;
+	stream.nClusters++;
+}
+
+static bool readVertices(MeshStream& stream, LineReader& reader, const string& vertexFile)
+{
+	FILE*	out = fopen(vertexFile.c_str(), "wb");
+	if (out == NULL)
+	{
+		cerr << "Can't write " << vertexFile << endl;
+		return false;
+	}
+
+	vector<vec3>	block;
+	block.reserve(VERTEX_BLOCK);
+	vec3	bmin(INFINITY), bmax(-INFINITY);
+
+	bool	valid = true;
+	const char	*line, *end;
+	for (int i = 0; i < stream.nVertices && valid && !stream.cancel; i++)
+	{
+		vec3	v;
+		valid = nextDataLine(reader, line, end)
+			&& parse(line, end, v.x) && parse(line, end, v.y) && parse(line, end, v.z);
+		if (!valid) break;
+
+		bmin = min(bmin, v);
+		bmax = max(bmax, v);
+		block.push_back(v);
+		if ((int)block.size() == VERTEX_BLOCK || i + 1 == stream.nVertices)
+		{
+			valid = valid && fwrite(block.data(), sizeof(vec3), block.size(), out) == block.size();
+			block.clear();
+		}
+	}
+	valid = (fclose(out) == 0) && valid;
+
+	if (!valid && !stream.cancel) cerr << stream.filename << " has invalid vertices" << endl;
+
+	stream.bmin = bmin;
+	stream.bmax = bmax;
+	return valid;
+}
+
+static bool readFaces(MeshStream& stream, LineReader& reader, const vec3* position)
+{
+	vec3	extent = max(stream.bmax - stream.bmin, vec3(1e-20f));
+
+	//cells holding about CLUSTER_FACES faces of a surface spread over the grid
+	int		g = (int)glm::clamp(sqrtf((float)stream.nFaces / CLUSTER_FACES) * 2, 1.0f, 64.0f);
+	vector<vector<int>>	cell(g * g * g);
+	vector<int>	limit(cell.size(), FIRST_CLUSTER_FACES);	//faces of the next cluster of each cell
+	size_t	buffered = 0;	//bytes of the faces in the cells
+
+	auto	flush = [&](int c)
+	{
+		if (cell[c].empty()) return;
+		buffered -= sizeof(int) * cell[c].size();
+		emit(stream, createCluster(cell[c], position));
+		vector<int>().swap(cell[c]);
+		limit[c] = std::min(2 * limit[c], CLUSTER_FACES);
+	};
+
+	bool	valid = true;
+	const char	*line, *end;
+	for (int i = 0; i < stream.nFaces && valid && !stream.cancel; i++)
+	{
+		int		n = 0, v[3];
+		valid = nextDataLine(reader, line, end) && parse(line, end, n) && n >= 3
+			&& parse(line, end, v[0]) && parse(line, end, v[1]);
+
+		//fan triangulation of the polygon
+		for (int k = 2; k < n && valid; k++, v[1] = v[2])
+		{
+			valid = parse(line, end, v[2]);
+			for (int j = 0; j < 3 && valid; j++) valid = v[j] >= 0 && v[j] < stream.nVertices;
+			if (!valid) break;
+
+			vec3	center = (position[v[0]] + position[v[1]] + position[v[2]]) / 3.0f;
+			ivec3	index = glm::clamp(ivec3((center - stream.bmin) / extent * (float)g), ivec3(0), ivec3(g - 1));
+			int		c = (index.z * g + index.y) * g + index.x;
+
+			cell[c].insert(cell[c].end(), v, v + 3);
+			buffered += 3 * sizeof(int);
+			if ((int)cell[c].size() >= 3 * limit[c]) flush(c);
+		}
+		stream.facesRead = i + 1;
+
+		//over the budget, the fullest cell goes out early
+		while (buffered > stream.budget / 2)
+			flush((int)(max_element(cell.begin(), cell.end(),
+				[](const vector<int>& a, const vector<int>& b) { return a.size() < b.size(); }) - cell.begin()));
+	}
+
+	if (!valid && !stream.cancel) cerr << stream.filename << " has invalid faces" << endl;
+
+	for (int c = 0; c < (int)cell.size() && !stream.cancel; c++) flush(c);
+	return valid;
+}
+
+static void streamMesh(MeshStream& stream)
+{
+	LineReader	reader;
+	openReader(reader, stream.fp);
+
+	string		vertexFile = stream.filename + ".vertices";
+	MappedFile	vertices;
+
+	bool	success = readVertices(stream, reader, vertexFile);
+	if (success && stream.nVertices > 0)
+	{
+		success = mapFile(vertexFile.c_str(), vertices);
+		if (!success) cerr << "Can't map " << vertexFile << endl;
+	}
+	stream.boundsReady = true;
+
+	if (success) success = readFaces(stream, reader, (const vec3*)vertices.data);
+
+	unmapFile(vertices);
+	remove(vertexFile.c_str());
+	fclose(stream.fp);
+	stream.fp = NULL;
+
+	stream.failed = !success && !stream.cancel;
+	stream.done = true;
+}
+
+//next line of the header holding data
+static const char* headerLine(FILE* fp, char* line, int size)
+{
+	while (fgets(line, size, fp))
+	{
+		const char*	p = skipSpaces(line, line + strlen(line));
+		if (*p != '#' && *p != '\n' && *p != 0) return p;
+	}
+	return NULL;
+}
+
+bool startMeshStream(const char* filename, MeshStream& stream, size_t budget)
+{
+	stream.filename = filename;
+	stream.budget = budget;
+	stream.nVertices = stream.nFaces = 0;
+	stream.boundsReady = stream.done = stream.failed = stream.cancel = false;
+	stream.facesRead = stream.nClusters = 0;
+	stream.readyBytes = 0;
+
+	stream.fp = fopen(filename, "rb");
+	if (stream.fp == NULL)
+	{
+		cerr << "Can't open " << filename << endl;
+		return false;
+	}
+
+	//magic number, # vertices, # faces, # edges on the same or the next data line
+	char	line[256];
+	int		nEdges = 0;
+	const char*	p = headerLine(stream.fp, line, sizeof(line));
+	bool	valid = p && strncmp(p, "OFF", 3) == 0;
+	if (valid && sscanf(p + 3, "%d %d %d", &stream.nVertices, &stream.nFaces, &nEdges) < 2)
+	{
+		p = headerLine(stream.fp, line, sizeof(line));
+		valid = p && sscanf(p, "%d %d %d", &stream.nVertices, &stream.nFaces, &nEdges) >= 2;
+	}
+	if (!valid || stream.nVertices < 0 || stream.nFaces < 0)
+	{
+		cerr << filename << " is not an OFF file" << endl;
+		fclose(stream.fp);
+		stream.fp = NULL;
+		return false;
+	}
+	cout << "# vertices = " << stream.nVertices << endl;
+	cout << "# faces = " << stream.nFaces << endl;
+
+	stream.thread = thread(streamMesh, ref(stream));
+	return true;
+}
+
+Mesh* nextCluster(MeshStream& stream)
+{
+	lock_guard<mutex>	lock(stream.mutex);
+	if (stream.ready.empty()) return NULL;
+
+	Mesh*	cluster = stream.ready.front();
+	stream.ready.pop_front();
+	stream.readyBytes -= clusterBytes(*cluster);
+	stream.taken.notify_one();
+
+	return cluster;
+}
+
+void stopMeshStream(MeshStream& stream)
+{
+	{
+		lock_guard<mutex>	lock(stream.mutex);
+		stream.cancel = true;
+		stream.taken.notify_one();
+	}
+	if (stream.thread.joinable()) stream.thread.join();
+
+	for (Mesh* cluster : stream.ready)
+	{
+		deleteMesh(*cluster);
+		delete cluster;
+	}
+	stream.ready.clear();
+	stream.readyBytes = 0;
+}
@@ -0,0 +1,56 @@
+#ifndef __MESH_STREAM_H_
+#define __MESH_STREAM_H_
+
+#include "mesh.h"
+
+#include <stdio.h>
+#include <string>
+#include <deque>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+//memory for the faces waiting in the grid cells and the clusters waiting to be taken, half each
+const size_t	DEFAULT_STREAM_BUDGET = (size_t)256 << 20;
+
+//faces of the clusters emitted from a full grid cell, doubling from the first
+//of each cell so that a coarse outline shows up early
+const int		FIRST_CLUSTER_FACES = 256;
+const int		CLUSTER_FACES = 16384;
+
+//OFF file too large to be read at once, parsed by a background thread in bounded chunks
+//the vertices go to a temporary binary file mapped in memory, then the faces are binned
+//by their centers in a uniform grid over the bounding box and handed out as clusters,
+//i.e., small meshes with their own vertices and normals
+struct MeshStream
+{
+	std::string	filename;
+	size_t		budget;
+	FILE*		fp;				//positioned after the header
+
+	int			nVertices, nFaces;	//declared in the header
+
+	glm::vec3			bmin, bmax;		//valid once boundsReady
+	std::atomic<bool>	boundsReady;
+	std::atomic<bool>	done, failed, cancel;
+	std::atomic<int>	facesRead, nClusters;
+
+	std::thread				thread;
+	std::mutex				mutex;
+	std::condition_variable	taken;
+	std::deque<Mesh*>		ready;
+	size_t					readyBytes;
+};
+
+//read the header and start the background thread
+bool startMeshStream(const char* filename, MeshStream& stream, size_t budget = DEFAULT_STREAM_BUDGET);
+
+//a cluster parsed so far, NULL if none is ready
+//the caller deletes it with deleteMesh() and delete after uploading it
+Mesh* nextCluster(MeshStream& stream);
+
+//stop the thread and delete the clusters not taken
+void stopMeshStream(MeshStream& stream);
+
+#endif
@@ -0,0 +1,170 @@
+#include "meshSubdivide.h"
+#include "meshHalfEdge.h"
+#include "meshOptimize.h"
+
+#include <math.h>
+#include <vector>
+#include <algorithm>
+using namespace std;
+using namespace glm;
+
+const char*	subdivisionSchemeName[N_SUBDIVISION_SCHEMES] = { "Midpoint", "Loop" };
+
+//Loop's weight of each of the n neighbors of an interior vertex
+static inline float loopBeta(int n)
+{
+	float	c = 3.0f / 8 + 0.25f * cosf(2 * 3.14159265f / n);
+	return (5.0f / 8 - c * c) / n;
+}
+
+//new position of an original vertex from its fan
+static vec3 smoothVertex(const Mesh& mesh, const HalfEdges& halfEdges, int v)
+{
+	vec3	p = mesh.vertex[v];
+	int		first = halfEdges.vertexEdge[v];
+	if (first < 0 || (halfEdges.vertexFlags[v] & NON_MANIFOLD_VERTEX)) return p;
+
+	//a border vertex averages only its two border neighbors
+	if (halfEdges.vertexFlags[v] & BOUNDARY_VERTEX)
+	{
+		int		h = first, last = first;
+		for (int k = rotateEdge(halfEdges, h); k >= 0; k = rotateEdge(halfEdges, k)) last = k;
+		vec3	b0 = mesh.vertex[edgeTarget(mesh, first)];
+		vec3	b1 = mesh.vertex[edgeOrigin(mesh, prevEdge(last))];
+		return 0.75f * p + 0.125f * (b0 + b1);
+	}
+
+	vec3	sum(0);
+	int		n = 0;
+	int		h = first;
+	do
+	{
+		sum += mesh.vertex[edgeTarget(mesh, h)];
+		n++;
+		h = rotateEdge(halfEdges, h);
+	} while (h != first);
+
+	float	beta = loopBeta(n);
+	return (1 - n * beta) * p + beta * sum;
+}
+
+void subdivideMesh(const Mesh& mesh, Mesh& refined, SubdivisionScheme scheme)
+{
+	HalfEdges	halfEdges;
+	buildHalfEdges(mesh, halfEdges);
+	const int*	twin = halfEdges.twin;
+
+	int		nFaces = mesh.nFaces;
+	int		nHalfEdges = 3 * nFaces;
+
+	//a new vertex for each edge, owned by its half-edge with the smaller index
+	//or by each half-edge of a border or a non-manifold edge
+	auto	owner = [&](int h) { return twin[h] < 0 || twin[h] > h; };
+	vector<int>	edgeVertex(nHalfEdges);
+	vector<int>	firstEdge(nFaces + 1, 0);
+
+#pragma omp parallel for schedule(static)
+	for (int i = 0; i < nFaces; i++)
+		for (int j = 0; j < 3; j++)
+		{
+			int		h = 3 * i + j;
+			if (owner(h)) firstEdge[i + 1]++;
+		}
+
+	for (int i = 0; i < nFaces; i++)
+		firstEdge[i + 1] += firstEdge[i];
+
+	int		nEdges = firstEdge[nFaces];
+	createMesh(refined, mesh.nVertices + nEdges, 4 * nFaces);
+
+#pragma omp parallel for schedule(static)
+	for (int i = 0; i < nFaces; i++)
+	{
+		int		e = mesh.nVertices + firstEdge[i];
+		for (int j = 0; j < 3; j++)
+		{
+			int		h = 3 * i + j;
+			if (owner(h)) edgeVertex[h] = e++;
+		}
+	}
+
+#pragma omp parallel for schedule(static)
+	for (int h = 0; h < nHalfEdges; h++)
+		if (!owner(h)) edgeVertex[h] = edgeVertex[twin[h]];
+
+	//edge vertices
+#pragma omp parallel for schedule(static)
+	for (int h = 0; h < nHalfEdges; h++)
+	{
+		if (!owner(h)) continue;
+
+		vec3	a = mesh.vertex[edgeOrigin(mesh, h)];
+		vec3	b = mesh.vertex[edgeTarget(mesh, h)];
+		vec3	p = 0.5f * (a + b);
+		if (scheme == SUBDIVIDE_LOOP && twin[h] >= 0)
+		{
+			vec3	c = mesh.vertex[edgeOrigin(mesh, prevEdge(h))];
+			vec3	d = mesh.vertex[edgeOrigin(mesh, prevEdge(twin[h]))];
+			p = 0.375f * (a + b) + 0.125f * (c + d);
+		}
+		refined.vertex[edgeVertex[h]] = p;
+	}
+
+	//original vertices
+#pragma omp parallel for schedule(static)
+	for (int v = 0; v < mesh.nVertices; v++)
+		refined.vertex[v] = (scheme == SUBDIVIDE_LOOP) ? smoothVertex(mesh, halfEdges, v) : mesh.vertex[v];
+
+	//four faces per face, the corners first and the middle last
+#pragma omp parallel for schedule(static)
+	for (int i = 0; i < nFaces; i++)
+	{
+		int		v[3], e[3];
+		for (int j = 0; j < 3; j++)
+		{
+			v[j] = mesh.face[i][j];
+			e[j] = edgeVertex[3 * i + j];	//on the edge from v[j] to v[j + 1]
+		}
+
+		int		corner[4][3] = {
+			{ v[0], e[0], e[2] },
+			{ e[0], v[1], e[1] },
+			{ e[2], e[1], v[2] },
+			{ e[0], e[1], e[2] } };
+		for (int k = 0; k < 4; k++)
+			for (int j = 0; j < 3; j++)
+				refined.face[4 * i + k][j] = corner[k][j];
+	}
+
+	deleteHalfEdges(halfEdges);
+
+	computeNormals(refined);
+	computeCenters(refined);
+	optimizeMesh(refined);
+}
+
+void subdivideMesh(const Mesh& mesh, Mesh& refined, int levels, SubdivisionScheme scheme)
+{
+	Mesh	current;
+	const Mesh*	source = &mesh;
+	for (int l = 0; l < levels; l++)
+	{
+		subdivideMesh(*source, refined, scheme);
+		if (source != &mesh) deleteMesh(current);
+		current = refined;
+		source = &current;
+	}
+
+	//no subdivision is a copy
+	if (levels <= 0)
+	{
+		createMesh(refined, mesh.nVertices, mesh.nFaces);
+		copy(mesh.vertex, mesh.vertex + mesh.nVertices, refined.vertex);
+		copy(mesh.vnormal, mesh.vnormal + mesh.nVertices, refined.vnormal);
+		copy(mesh.fnormal, mesh.fnormal + mesh.nFaces, refined.fnormal);
+		copy(mesh.fcenter, mesh.fcenter + mesh.nFaces, refined.fcenter);
+		copy(mesh.face, mesh.face + mesh.nFaces, refined.face);
+		refined.bmin = mesh.bmin;
+		refined.bmax = mesh.bmax;
+	}
+}
@@ -0,0 +1,18 @@
+#ifndef __MESH_SUBDIVIDE_H_
+#define __MESH_SUBDIVIDE_H_
+
+#include "mesh.h"
+
+enum SubdivisionScheme { SUBDIVIDE_MIDPOINT = 0, SUBDIVIDE_LOOP, N_SUBDIVISION_SCHEMES };
+extern const char*	subdivisionSchemeName[N_SUBDIVISION_SCHEMES];
+
+//split every triangle into four at the midpoints of its edges, in parallel
+//the Loop scheme smooths the positions with its masks, keeping borders as cubic B-splines
+//and non-manifold vertices in place, the midpoint scheme keeps the surface flat
+//the refined mesh has its normals, centers and vertex cache order computed
+void subdivideMesh(const Mesh& mesh, Mesh& refined, SubdivisionScheme scheme = SUBDIVIDE_LOOP);
+
+//repeated subdivision for 4^levels times the faces
+void subdivideMesh(const Mesh& mesh, Mesh& refined, int levels, SubdivisionScheme scheme = SUBDIVIDE_LOOP);
+
+#endif
@@ -0,0 +1,242 @@
+#include "meshWeld.h"
+
+#include <math.h>
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+using namespace std;
+using namespace glm;
+
+//cell of a position in the grid of the given cell size, optionally offset along every axis
+struct Cell { int64_t x, y, z; };
+
+static inline Cell cellOf(const vec3& p, const vec3& origin, float cellSize, double offset = 0)
+{
+	Cell	c;
+	c.x = (int64_t)floor(((double)p.x - origin.x + offset) / cellSize);
+	c.y = (int64_t)floor(((double)p.y - origin.y + offset) / cellSize);
+	c.z = (int64_t)floor(((double)p.z - origin.z + offset) / cellSize);
+	return c;
+}
+
+static inline uint64_t hashCell(const Cell& c)
+{
+	//the final mix spreads the high bits to the low ones masked, regular grids colliding otherwise
+	uint64_t	h = (uint64_t)c.x * 0x9E3779B97F4A7C15ULL;
+	h ^= (uint64_t)c.y * 0xC2B2AE3D27D4EB4FULL;
+	h ^= (uint64_t)c.z * 0x165667B19E3779F9ULL;
+	h ^= h >> 33;
+	h *= 0xFF51AFD7ED558CCDULL;
+	h ^= h >> 33;
+	return h;
+}
+
+//vertices bucketed by the hash of their cells
+struct SpatialHash
+{
+	uint64_t		mask;
+	vector<int>		start;		//CSR over the buckets
+	vector<int>		vertices;	//in increasing order within a bucket
+};
+
+static void buildSpatialHash(const Mesh& mesh, const vec3& origin, float cellSize, SpatialHash& hash)
+{
+	int			nVertices = mesh.nVertices;
+	uint64_t	nBuckets = 1;
+	while (nBuckets < 2 * (uint64_t)nVertices) nBuckets *= 2;
+
+	hash.mask = nBuckets - 1;
+	hash.start.assign(nBuckets + 1, 0);
+	hash.vertices.resize(nVertices);
+
+	vector<uint32_t>	bucket(nVertices);
+#pragma omp parallel for schedule(static)
+	for (int v = 0; v < nVertices; v++)
+	{
+		bucket[v] = (uint32_t)(hashCell(cellOf(mesh.vertex[v], origin, cellSize)) & hash.mask);
+#pragma omp atomic
+		hash.start[bucket[v] + 1]++;
+	}
+
+	for (uint64_t b = 0; b < nBuckets; b++)
+		hash.start[b + 1] += hash.start[b];
+
+	vector<int>	next(hash.start.begin(), hash.start.end() - 1);
+	for (int v = 0; v < nVertices; v++)
+		hash.vertices[next[bucket[v]]++] = v;
+}
+
+WeldStats weldMesh(Mesh& mesh, float tolerance)
+{
+	WeldStats	stats;
+	memset(&stats, 0, sizeof(stats));
+
+	int		nVertices = mesh.nVertices;
+	int		nFaces = mesh.nFaces;
+	if (nVertices == 0) return stats;
+
+	vec3	bmin = mesh.vertex[0], bmax = mesh.vertex[0];
+	for (int v = 1; v < nVertices; v++)
+	{
+		bmin = min(bmin, mesh.vertex[v]);
+		bmax = max(bmax, mesh.vertex[v]);
+	}
+
+	//cells twice the distance so that the box around a vertex overlaps at most 8 of them
+	float	diagonal = length(bmax - bmin);
+	float	distance = tolerance * diagonal;
+	float	cellSize = std::max(2 * distance, 1e-12f * diagonal);	//exact duplicates for no tolerance
+	if (cellSize == 0) cellSize = 1;
+	float	distance2 = distance * distance;
+
+	SpatialHash	hash;
+	buildSpatialHash(mesh, bmin, cellSize, hash);
+
+	//each vertex goes to the first vertex within the distance
+	vector<int>	remap(nVertices);
+#pragma omp parallel for schedule(dynamic, 4096)
+	for (int v = 0; v < nVertices; v++)
+	{
+		const vec3&	p = mesh.vertex[v];
+		Cell		lo = cellOf(p, bmin, cellSize, -distance);
+		Cell		hi = cellOf(p, bmin, cellSize, distance);
+		uint64_t	visited[27];	//8 but on the cell boundaries
+		int			nVisited = 0;
+
+		int		first = v;
+		for (int64_t z = lo.z; z <= hi.z; z++)
+			for (int64_t y = lo.y; y <= hi.y; y++)
+				for (int64_t x = lo.x; x <= hi.x; x++)
+				{
+					//cells sharing a bucket are scanned once
+					Cell		n = { x, y, z };
+					uint64_t	b = hashCell(n) & hash.mask;
+					if (find(visited, visited + nVisited, b) != visited + nVisited) continue;
+					visited[nVisited++] = b;
+
+					for (int k = hash.start[b]; k < hash.start[b + 1]; k++)
+					{
+						int		u = hash.vertices[k];
+						if (u >= first) break;
+
+						vec3	d = mesh.vertex[u] - p;
+						if (dot(d, d) <= distance2) first = u;
+					}
+				}
+		remap[v] = first;
+	}
+
+	//chains of merges collapse to their first vertex
+	bool	changed = true;
+	while (changed)
+	{
+		changed = false;
+#pragma omp parallel for schedule(static) reduction(||:changed)
+		for (int v = 0; v < nVertices; v++)
+			if (remap[remap[v]] != remap[v])
+			{
+				remap[v] = remap[remap[v]];
+				changed = true;
+			}
+	}
+
+	int		nWelded = 0;
+#pragma omp parallel for schedule(static) reduction(+:nWelded)
+	for (int v = 0; v < nVertices; v++)
+		if (remap[v] != v) nWelded++;
+	stats.nWeldedVertices = nWelded;
+
+	//faces after welding with their vertices sorted to find the duplicates
+	vector<uvec3>	face(nFaces);
+	vector<char>	keep(nFaces, 1);
+	int		nDegenerate = 0;
+#pragma omp parallel for schedule(static) reduction(+:nDegenerate)
+	for (int i = 0; i < nFaces; i++)
+	{
+		uvec3	f(remap[mesh.face[i][0]], remap[mesh.face[i][1]], remap[mesh.face[i][2]]);
+		face[i] = f;
+
+		vec3	n = cross(mesh.vertex[f[1]] - mesh.vertex[f[0]], mesh.vertex[f[2]] - mesh.vertex[f[0]]);
+		if (f[0] == f[1] || f[1] == f[2] || f[2] == f[0] || dot(n, n) == 0)
+		{
+			keep[i] = 0;
+			nDegenerate++;
+		}
+	}
+	stats.nDegenerateFaces = nDegenerate;
+
+	//each face rotated to start at its smallest vertex, compared instead of the faces
+	//the winding is kept, so the two sides of a thin wall are not duplicates of each other
+	vector<uvec3>	sorted(nFaces);
+#pragma omp parallel for schedule(static)
+	for (int i = 0; i < nFaces; i++)
+	{
+		const uvec3&	f = face[i];
+		int		j = f[0] < f[1] ? (f[0] < f[2] ? 0 : 2) : (f[1] < f[2] ? 1 : 2);
+		sorted[i] = uvec3(f[j], f[(j + 1) % 3], f[(j + 2) % 3]);
+	}
+	auto	less = [&](int a, int b)
+	{
+		const uvec3&	fa = sorted[a];
+		const uvec3&	fb = sorted[b];
+		if (fa[0] != fb[0]) return fa[0] < fb[0];
+		if (fa[1] != fb[1]) return fa[1] < fb[1];
+		if (fa[2] != fb[2]) return fa[2] < fb[2];
+		return a < b;
+	};
+
+	vector<int>	order;
+	order.reserve(nFaces);
+	for (int i = 0; i < nFaces; i++) if (keep[i]) order.push_back(i);
+	sort(order.begin(), order.end(), less);
+	for (size_t k = 1; k < order.size(); k++)
+		if (sorted[order[k]] == sorted[order[k - 1]])
+		{
+			keep[order[k]] = 0;
+			stats.nDuplicateFaces++;
+		}
+
+	//vertices still used in their order
+	vector<int>	newIndex(nVertices, -1);
+	for (int i = 0; i < nFaces; i++)
+		if (keep[i])
+			for (int j = 0; j < 3; j++) newIndex[face[i][j]] = 0;
+
+	int		nUsed = 0;
+	for (int v = 0; v < nVertices; v++)
+		if (newIndex[v] == 0) newIndex[v] = nUsed++;
+	stats.nUnusedVertices = nVertices - nUsed;
+
+	if (stats.nDegenerateFaces == 0 && stats.nDuplicateFaces == 0 && stats.nUnusedVertices == 0) return stats;
+
+	int		nKept = nFaces - stats.nDegenerateFaces - stats.nDuplicateFaces;
+	Mesh	cleaned;
+	createMesh(cleaned, nUsed, nKept);
+
+#pragma omp parallel for schedule(static)
+	for (int v = 0; v < nVertices; v++)
+		if (newIndex[v] >= 0) cleaned.vertex[newIndex[v]] = mesh.vertex[v];
+
+	int		k = 0;
+	for (int i = 0; i < nFaces; i++)
+		if (keep[i])
+		{
+			for (int j = 0; j < 3; j++) cleaned.face[k][j] = newIndex[face[i][j]];
+			k++;
+		}
+
+	deleteMesh(mesh);
+	mesh = cleaned;
+
+	return stats;
+}
+
+void printWeldStats(const WeldStats& stats)
+{
+	if (stats.nWeldedVertices == 0 && stats.nDegenerateFaces == 0 && stats.nDuplicateFaces == 0 && stats.nUnusedVertices == 0) return;
+
+	meshLog() << "Welded " << stats.nWeldedVertices << " vertices, removed " << stats.nDegenerateFaces << " degenerate and ";
+	meshLog() << stats.nDuplicateFaces << " duplicate faces and " << stats.nUnusedVertices << " unused vertices" << endl;
+}
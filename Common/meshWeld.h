@@ -0,0 +1,27 @@
+#ifndef __MESH_WELD_H_
+#define __MESH_WELD_H_
+
+#include "mesh.h"
+
+//default distance of the vertices merged, relative to the diagonal of the bounding box
+const float	WELD_TOLERANCE = 1e-6f;
+
+//what a cleanup pass changed
+struct WeldStats
+{
+	int		nWeldedVertices;	//merged into another vertex
+	int		nDegenerateFaces;	//with a repeated vertex or no area
+	int		nDuplicateFaces;	//with the same vertices as an earlier face in the same cyclic order
+	int		nUnusedVertices;	//referenced by no face, including the welded ones
+};
+
+//merge the vertices closer than tolerance * diagonal with a spatial hash of cells twice that size,
+//each to the first one within the tolerance, remove the degenerate and duplicate faces
+//and compact the vertices left unused, in parallel and in near-linear time
+//the normals and centers are to be computed after it, as readMesh() does for an OFF file
+WeldStats weldMesh(Mesh& mesh, float tolerance = WELD_TOLERANCE);
+
+//report the changes, if any
+void printWeldStats(const WeldStats& stats);
+
+#endif
@@ -0,0 +1,220 @@
+#include "meshlet.h"
+#include "meshOptimize.h"
+
+#include <math.h>
+#include <vector>
+#include <algorithm>
+using namespace std;
+using namespace glm;
+
+//bounding sphere and normal cone of the faces [first, first + n)
+static void computeBounds(const Mesh& mesh, Meshlet& m)
+{
+	vec3	bmin(INFINITY), bmax(-INFINITY), axis(0, 0, 0);
+	for (int i = m.firstFace; i < m.firstFace + m.nFaces; i++)
+	{
+		for (int j = 0; j < 3; j++)
+		{
+			bmin = min(bmin, mesh.vertex[mesh.face[i][j]]);
+			bmax = max(bmax, mesh.vertex[mesh.face[i][j]]);
+		}
+		axis += mesh.fnormal[i];
+	}
+
+	m.center = 0.5f * (bmin + bmax);
+	float	r2 = 0;
+	for (int i = m.firstFace; i < m.firstFace + m.nFaces; i++)
+		for (int j = 0; j < 3; j++)
+		{
+			vec3	d = mesh.vertex[mesh.face[i][j]] - m.center;
+			r2 = std::max(r2, dot(d, d));
+		}
+	m.radius = sqrtf(r2);
+
+	//the normal farthest from the axis bounds the cone
+	float	minDot = -1;
+	if (dot(axis, axis) > 0)
+	{
+		axis = normalize(axis);
+		minDot = 1;
+		for (int i = m.firstFace; i < m.firstFace + m.nFaces; i++)
+			if (dot(mesh.fnormal[i], mesh.fnormal[i]) > 0) minDot = std::min(minDot, dot(mesh.fnormal[i], axis));
+	}
+	m.coneAxis = axis;
+	m.coneCutoff = (minDot < MESHLET_MIN_CONE_DOT) ? 1.0f : sqrtf(1 - minDot * minDot);
+}
+
+//cost of adding a face to a meshlet: the new vertices first, then the deviation from its normal cone
+static inline float faceCost(const Mesh& mesh, int f, int newVertices, const vec3& axis)
+{
+	return newVertices + MESHLET_CONE_WEIGHT * (1 - dot(mesh.fnormal[f], axis));
+}
+
+void buildMeshlets(Mesh& mesh, Meshlets& meshlets)
+{
+	VertexFaces	adjacency;
+	buildVertexFaces(mesh, adjacency);
+
+	vector<Meshlet>	list;
+	vector<int>		order;					//faces meshlet by meshlet
+	vector<char>	emitted(mesh.nFaces, 0);
+	vector<int>		owner(mesh.nVertices, -1);	//meshlet holding each vertex lastly
+	vector<int>		candidate;				//faces around the vertices of the current meshlet
+	order.reserve(mesh.nFaces);
+
+	int		cursor = 0;		//next seed in the stored order once the meshlet has no neighbor left
+	while ((int)order.size() < mesh.nFaces)
+	{
+		int		k = (int)list.size();
+		Meshlet	m;
+		m.firstFace = (int)order.size();
+		m.nFaces = 0;
+		int		nVertices = 0;
+		vec3	axis(0, 0, 0);
+
+		//a seed left over by the previous meshlet keeps the meshlets adjacent
+		int		f = -1;
+		for (int c : candidate) if (!emitted[c]) { f = c; break; }
+		while (f < 0) if (!emitted[cursor++]) f = cursor - 1;
+		candidate.clear();
+
+		while (f >= 0)
+		{
+			emitted[f] = 1;
+			order.push_back(f);
+			m.nFaces++;
+			axis += mesh.fnormal[f];
+			for (int j = 0; j < 3; j++)
+			{
+				int		v = mesh.face[f][j];
+				if (owner[v] == k) continue;
+
+				owner[v] = k;
+				nVertices++;
+				for (int a = adjacency.start[v]; a < adjacency.start[v + 1]; a++)
+					if (!emitted[adjacency.faces[a]]) candidate.push_back(adjacency.faces[a]);
+			}
+			if (m.nFaces == MESHLET_MAX_FACES) break;
+
+			//the cheapest neighboring face still fitting in
+			vec3	n = (dot(axis, axis) > 0) ? normalize(axis) : axis;
+			float	best = INFINITY;
+			f = -1;
+			size_t	live = 0;
+			for (size_t c = 0; c < candidate.size(); c++)
+			{
+				int		t = candidate[c];
+				if (emitted[t]) continue;
+				candidate[live++] = t;
+
+				int		added = 0;
+				for (int j = 0; j < 3; j++) if (owner[mesh.face[t][j]] != k) added++;
+				if (nVertices + added > MESHLET_MAX_VERTICES) continue;
+
+				float	cost = faceCost(mesh, t, added, n);
+				if (cost < best) { best = cost; f = t; }
+			}
+			candidate.resize(live);
+		}
+
+		//the faces of a meshlet in their vertex cache order
+		sort(order.begin() + m.firstFace, order.end());
+		list.push_back(m);
+	}
+	deleteVertexFaces(adjacency);
+
+	reorderMesh(mesh, order.data());
+
+	meshlets.nMeshlets = (int)list.size();
+	meshlets.meshlet = new Meshlet[list.size()];
+	copy(list.begin(), list.end(), meshlets.meshlet);
+
+#pragma omp parallel for schedule(static)
+	for (int k = 0; k < meshlets.nMeshlets; k++)
+		computeBounds(mesh, meshlets.meshlet[k]);
+
+	meshlets.rangeFirst = new int[list.size()];
+	meshlets.rangeCount = new int[list.size()];
+	resetMeshlets(meshlets);
+}
+
+void deleteMeshlets(Meshlets& meshlets)
+{
+	delete[] meshlets.meshlet;
+	delete[] meshlets.rangeFirst;
+	delete[] meshlets.rangeCount;
+	meshlets = Meshlets();
+}
+
+//append the meshlet to the ranges, extending the last one if adjacent
+static void addRange(Meshlets& meshlets, const Meshlet& m)
+{
+	int		n = meshlets.nRanges;
+	if (n > 0 && meshlets.rangeFirst[n - 1] + meshlets.rangeCount[n - 1] == m.firstFace)
+	{
+		meshlets.rangeCount[n - 1] += m.nFaces;
+		return;
+	}
+	meshlets.rangeFirst[n] = m.firstFace;
+	meshlets.rangeCount[n] = m.nFaces;
+	meshlets.nRanges++;
+}
+
+void resetMeshlets(Meshlets& meshlets)
+{
+	meshlets.nRanges = 0;
+	for (int k = 0; k < meshlets.nMeshlets; k++) addRange(meshlets, meshlets.meshlet[k]);
+	meshlets.nVisible = meshlets.nMeshlets;
+	meshlets.nFrustumCulled = meshlets.nConeCulled = 0;
+}
+
+int cullMeshlets(Meshlets& meshlets, const mat4& modelView, const mat4& projection)
+{
+	//frustum planes in the object coordinate system from the rows of the combined matrix
+	mat4	M = projection * modelView;
+	vec4	row[4], plane[6];
+	for (int i = 0; i < 4; i++) row[i] = vec4(M[0][i], M[1][i], M[2][i], M[3][i]);
+	for (int i = 0; i < 3; i++)
+	{
+		plane[2 * i] = row[3] + row[i];
+		plane[2 * i + 1] = row[3] - row[i];
+	}
+	for (int p = 0; p < 6; p++)
+	{
+		float	l = length(vec3(plane[p]));
+		if (l > 0) plane[p] /= l;
+	}
+
+	//the viewer in the object coordinate system, a direction for a parallel projection
+	mat4	inverseModelView = inverse(modelView);
+	bool	orthographic = projection[3][3] != 0;
+	vec3	eye = vec3(inverseModelView * vec4(0, 0, 0, 1));
+	vec3	viewDirection = normalize(vec3(inverseModelView * vec4(0, 0, -1, 0)));
+
+	meshlets.nRanges = 0;
+	meshlets.nVisible = meshlets.nFrustumCulled = meshlets.nConeCulled = 0;
+	for (int k = 0; k < meshlets.nMeshlets; k++)
+	{
+		const Meshlet&	m = meshlets.meshlet[k];
+
+		bool	outside = false;
+		for (int p = 0; p < 6 && !outside; p++)
+			outside = dot(vec3(plane[p]), m.center) + plane[p].w < -m.radius;
+		if (outside) { meshlets.nFrustumCulled++; continue; }
+
+		//every face normal points away from the viewer
+		bool	backFacing;
+		if (orthographic)	backFacing = dot(viewDirection, m.coneAxis) >= m.coneCutoff;
+		else
+		{
+			vec3	v = m.center - eye;
+			backFacing = dot(v, m.coneAxis) >= m.coneCutoff * length(v) + m.radius;
+		}
+		if (backFacing) { meshlets.nConeCulled++; continue; }
+
+		addRange(meshlets, m);
+		meshlets.nVisible++;
+	}
+
+	return meshlets.nVisible;
+}
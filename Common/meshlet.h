@@ -0,0 +1,57 @@
+#ifndef __MESHLET_H_
+#define __MESHLET_H_
+
+#include "mesh.h"
+
+//limits of a meshlet as used by mesh shading hardware
+const int	MESHLET_MAX_VERTICES = 64;
+const int	MESHLET_MAX_FACES = 124;
+
+//normal cones wider than this are never back-facing as a whole
+const float	MESHLET_MIN_CONE_DOT = 0.1f;
+
+//cost of the deviation of a face normal from the cone of a growing meshlet against a new vertex
+const float	MESHLET_CONE_WEIGHT = 0.5f;
+
+//consecutive faces of the mesh, drawn as a range of its index buffer
+struct Meshlet
+{
+	int			firstFace, nFaces;
+
+	glm::vec3	center;		//bounding sphere
+	float		radius;
+
+	glm::vec3	coneAxis;	//average face normal
+	float		coneCutoff;	//sine of the widest angle of a face normal from the axis, 1 if none culled
+};
+
+//meshlets of a mesh and the face ranges left after culling them
+struct Meshlets
+{
+	int			nMeshlets;
+	Meshlet*	meshlet;
+
+	//visible meshlets, adjacent ones merged into a single range of faces
+	int			nRanges;
+	int*		rangeFirst;
+	int*		rangeCount;
+
+	int			nVisible, nFrustumCulled, nConeCulled;
+};
+
+//grow each meshlet over the neighboring faces adding the fewest vertices and keeping
+//its normal cone narrow, then reorder the faces meshlet by meshlet, keeping their
+//vertex cache order within each, so that a meshlet is a range of the index buffer
+//call it before uploading the mesh
+void buildMeshlets(Mesh& mesh, Meshlets& meshlets);
+void deleteMeshlets(Meshlets& meshlets);
+
+//cull the meshlets outside the view frustum or facing away from the viewer
+//with the matrices from the object to the eye and to the clip coordinates
+//returns the # visible meshlets
+int cullMeshlets(Meshlets& meshlets, const glm::mat4& modelView, const glm::mat4& projection);
+
+//every meshlet as visible
+void resetMeshlets(Meshlets& meshlets);
+
+#endif
@@ -0,0 +1,164 @@
+#include "quadricCache.h"
+
+#include <math.h>
+#include <map>
+#include <tuple>
+using namespace std;
+
+//shape with its radii normalized so that the larger one is 1
+typedef tuple<int, int, int, float, float>	QuadricKey;
+
+static map<QuadricKey, GLuint>	lists;
+static GLUquadric*	quadric = NULL;
+
+static GLuint unitQuadric(QuadricType type, GLint slices, GLint stacks, float r0, float r1)
+{
+	QuadricKey	key(type, slices, stacks, r0, r1);
+	auto	found = lists.find(key);
+	if (found != lists.end()) return found->second;
+
+	if (quadric == NULL)
+	{
+		quadric = gluNewQuadric();
+		gluQuadricDrawStyle(quadric, GLU_FILL);
+		gluQuadricNormals(quadric, GLU_SMOOTH);
+		gluQuadricOrientation(quadric, GLU_OUTSIDE);
+		gluQuadricTexture(quadric, GL_FALSE);
+	}
+
+	GLuint	list = glGenLists(1);
+	glNewList(list, GL_COMPILE);
+	switch (type)
+	{
+	case QUADRIC_SPHERE:	gluSphere(quadric, 1, slices, stacks); break;
+	case QUADRIC_CYLINDER:	gluCylinder(quadric, r0, r1, 1, slices, stacks); break;
+	default:				gluDisk(quadric, r0, r1, slices, stacks); break;
+	}
+	glEndList();
+
+	lists[key] = list;
+	return list;
+}
+
+static void drawScaled(GLuint list, GLdouble sx, GLdouble sy, GLdouble sz)
+{
+	GLboolean	normalize = glIsEnabled(GL_NORMALIZE);
+	if (!normalize) glEnable(GL_NORMALIZE);
+
+	glPushMatrix();
+	glScaled(sx, sy, sz);
+	glCallList(list);
+	glPopMatrix();
+
+	if (!normalize) glDisable(GL_NORMALIZE);
+}
+
+void drawQuadricSphere(GLdouble radius, GLint slices, GLint stacks)
+{
+	if (radius <= 0) return;
+	drawScaled(unitQuadric(QUADRIC_SPHERE, slices, stacks, 1, 1), radius, radius, radius);
+}
+
+void drawQuadricCylinder(GLdouble baseRadius, GLdouble topRadius, GLdouble height, GLint slices, GLint stacks)
+{
+	GLdouble	radius = (baseRadius > topRadius) ? baseRadius : topRadius;
+	if (radius <= 0 || height == 0) return;
+
+	GLuint	list = unitQuadric(QUADRIC_CYLINDER, slices, stacks, (float)(baseRadius / radius), (float)(topRadius / radius));
+	drawScaled(list, radius, radius, height);
+}
+
+void drawQuadricDisk(GLdouble innerRadius, GLdouble outerRadius, GLint slices, GLint loops)
+{
+	if (outerRadius <= 0) return;
+	drawScaled(unitQuadric(QUADRIC_DISK, slices, loops, (float)(innerRadius / outerRadius), 1), outerRadius, outerRadius, 1);
+}
+
+//pixels per unit length at the origin of a modelview matrix with the projection scaled to pixels
+static float modelViewPixelsPerUnit(const GLdouble modelView[16], double projectionScale, bool perspective)
+{
+	double	scale = 0;
+	for (int c = 0; c < 3; c++)
+	{
+		const GLdouble*	column = modelView + 4 * c;
+		scale = fmax(scale, sqrt(column[0] * column[0] + column[1] * column[1] + column[2] * column[2]));
+	}
+
+	//clip space to pixels, divided by the depth of the origin in a perspective projection
+	double	ppu = scale * projectionScale;
+	if (perspective)
+	{
+		double	depth = -modelView[14];
+		if (depth <= 0) return HUGE_VALF;
+		ppu /= depth;
+	}
+	return (float)fabs(ppu);
+}
+
+//clip space to pixels of the last projection rendered with, kept for the selection passes
+static double	renderedScale = 0;
+static bool		renderedPerspective = false;
+
+float currentPixelsPerUnit()
+{
+	GLdouble	modelView[16];
+	glGetDoublev(GL_MODELVIEW_MATRIX, modelView);
+
+	//the pick matrix of a selection pass magnifies the region picked, so the spheres are
+	//tessellated with the projection last rendered with, i.e., as they were drawn
+	GLint	renderMode;
+	glGetIntegerv(GL_RENDER_MODE, &renderMode);
+	if (renderMode != GL_SELECT || renderedScale == 0)
+	{
+		GLdouble	projection[16];
+		GLint		viewport[4];
+		glGetDoublev(GL_PROJECTION_MATRIX, projection);
+		glGetIntegerv(GL_VIEWPORT, viewport);
+
+		double	projectionScale = projection[5] * viewport[3] / 2;
+		bool	perspective = projection[11] != 0;
+		if (renderMode != GL_RENDER) return modelViewPixelsPerUnit(modelView, projectionScale, perspective);
+
+		renderedScale = projectionScale;
+		renderedPerspective = perspective;
+	}
+	return modelViewPixelsPerUnit(modelView, renderedScale, renderedPerspective);
+}
+
+int sphereSlices(GLdouble radius, float pixelsPerUnit, float maxPixels)
+{
+	const int	minSlices = 8, maxSlices = 128;
+
+	//a chord over 2 pi / n deviates by r (1 - cos(pi / n)) from the circle of radius r
+	double	r = radius * pixelsPerUnit;
+	if (!(r > maxPixels)) return minSlices;
+	if (maxPixels <= 0) return maxSlices;
+
+	double	n = 3.14159265358979 / acos(1 - maxPixels / r);
+	if (!(n < maxSlices)) return maxSlices;
+
+	int		slices = 8 * (int)ceil(n / 8);
+	return slices < minSlices ? minSlices : slices;
+}
+
+int drawQuadricSphereLOD(GLdouble radius, float maxPixels)
+{
+	int		slices = sphereSlices(radius, currentPixelsPerUnit(), maxPixels);
+	drawQuadricSphere(radius, slices, slices / 2);
+
+	return slices;
+}
+
+int quadricCacheSize()
+{
+	return (int)lists.size();
+}
+
+void deleteQuadricCache()
+{
+	for (auto& entry : lists) glDeleteLists(entry.second, 1);
+	lists.clear();
+
+	if (quadric) gluDeleteQuadric(quadric);
+	quadric = NULL;
+}
@@ -0,0 +1,46 @@
+#ifndef __QUADRIC_CACHE_H_
+#define __QUADRIC_CACHE_H_
+
+#if defined(__APPLE__) && defined(__MACH__)
+#include <OpenGL/glu.h>
+#else
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include <GL/glu.h>
+#endif
+
+enum QuadricType { QUADRIC_SPHERE = 0, QUADRIC_CYLINDER, QUADRIC_DISK, N_QUADRIC_TYPES };
+
+//gluSphere(), gluCylinder() and gluDisk() of a filled, smooth and outward quadric
+//without regenerating the tessellation at every draw: each unit shape is compiled into a display list
+//once per type, slices and stacks (and ratio of the radii) and drawn scaled to the given size
+//GL_NORMALIZE is turned on while drawing since the scale changes the length of the normals
+void drawQuadricSphere(GLdouble radius, GLint slices, GLint stacks);
+void drawQuadricCylinder(GLdouble baseRadius, GLdouble topRadius, GLdouble height, GLint slices, GLint stacks);
+void drawQuadricDisk(GLdouble innerRadius, GLdouble outerRadius, GLint slices, GLint loops);
+
+//default deviation in pixels of a sphere tessellated by its size on screen
+const float	SPHERE_PIXEL_ERROR = 0.5f;
+
+//pixels per unit length at the origin of the current modelview matrix
+//with the current projection and viewport, for the largest scale of the modelview
+//in GL_SELECT mode the projection and viewport of the last GL_RENDER call are used instead,
+//so that a pick matrix does not change the tessellation of what is picked
+float currentPixelsPerUnit();
+
+//fewest slices, in multiples of 8 up to 128, whose chords deviate by at most maxPixels
+//from a sphere of the given radius drawn at pixelsPerUnit, its stacks half of them
+int sphereSlices(GLdouble radius, float pixelsPerUnit, float maxPixels = SPHERE_PIXEL_ERROR);
+
+//sphere at the origin of the current modelview matrix tessellated by its size on screen,
+//returning the slices chosen
+int drawQuadricSphereLOD(GLdouble radius, float maxPixels = SPHERE_PIXEL_ERROR);
+
+//# display lists compiled so far
+int quadricCacheSize();
+
+//delete the display lists while the context is current, e.g., in quit()
+void deleteQuadricCache();
+
+#endif
@@ -0,0 +1,200 @@
+#include "mesh.h"
+#include "meshSubdivide.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+using namespace std;
+using namespace glm;
+
+const int	CACHE_LINE = 64;
+
+//the triangle walks of the lessons over the interleaved faces and over the separate
+//face[0..2] arrays they used to have, built as a structure-of-arrays view of the same mesh
+//a mesh smaller than the requested # faces is refined with midpoint subdivision first
+void usage(const char* program)
+{
+	cout << "Usage: " << program << " input.off|ply|glb|mcache [options]" << endl;
+	cout << "  -faces n    minimum # faces, subdividing the input (default 1000000)" << endl;
+	cout << "  -repeat n   runs of each loop, the fastest is reported (default 5)" << endl;
+}
+
+//the face i through either layout
+struct Interleaved
+{
+	const uvec3*	face;
+	uvec3 operator()(int i) const { return face[i]; }
+};
+
+struct Separate
+{
+	const FaceArrays*	arrays;
+	uvec3 operator()(int i) const { return uvec3(arrays->index[0][i], arrays->index[1][i], arrays->index[2][i]); }
+};
+
+//drawFlatMesh(): the vertices of the faces in the stored order
+template <typename Faces>
+static float flatWalk(const Mesh& mesh, const Faces& faces, const int* order)
+{
+	vec3	sum(0, 0, 0);
+	for (int k = 0; k < mesh.nFaces; k++)
+	{
+		int		i = order ? order[k] : k;
+		uvec3	f = faces(i);
+		sum += mesh.fnormal[i] + mesh.vertex[f[0]] + mesh.vertex[f[1]] + mesh.vertex[f[2]];
+	}
+	return sum.x + sum.y + sum.z;
+}
+
+//the face normals of computeNormals()
+template <typename Faces>
+static float faceNormals(const Mesh& mesh, const Faces& faces, vec3* normal)
+{
+	for (int i = 0; i < mesh.nFaces; i++)
+	{
+		uvec3	f = faces(i);
+		normal[i] = cross(mesh.vertex[f[1]] - mesh.vertex[f[0]], mesh.vertex[f[2]] - mesh.vertex[f[0]]);
+	}
+	return normal[mesh.nFaces / 2].x;
+}
+
+//the face count of each vertex in buildVertexFaces()
+template <typename Faces>
+static float vertexValence(const Mesh& mesh, const Faces& faces, int* valence)
+{
+	memset(valence, 0, sizeof(int) * mesh.nVertices);
+	for (int i = 0; i < mesh.nFaces; i++)
+	{
+		uvec3	f = faces(i);
+		valence[f[0]]++;
+		valence[f[1]]++;
+		valence[f[2]]++;
+	}
+	return (float)valence[mesh.nVertices / 2];
+}
+
+//fastest of the runs in milliseconds
+template <typename Loop>
+static double best(int repeat, float& checksum, Loop loop)
+{
+	double	fastest = 1e30;
+	for (int r = 0; r < repeat; r++)
+	{
+		auto	start = chrono::steady_clock::now();
+		checksum += loop();
+		fastest = std::min(fastest, chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+	}
+	return fastest;
+}
+
+//cache lines of the index arrays fetched per face by a cache holding only the last few lines,
+//i.e., the misses of a walk whose working set does not fit in the cache
+static double indexLinesPerFace(const Mesh& mesh, const int* order, bool interleaved)
+{
+	const size_t	arrayBytes = ((size_t)mesh.nFaces * 4 + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+	const int		RECENT = 4;
+
+	size_t		recent[RECENT];
+	int			next = 0;
+	for (int r = 0; r < RECENT; r++) recent[r] = (size_t)-1;
+
+	long long	misses = 0;
+	for (int k = 0; k < mesh.nFaces; k++)
+	{
+		size_t	i = order ? order[k] : k;
+		for (int j = 0; j < 3; j++)
+		{
+			size_t	offset = interleaved ? 12 * i + 4 * j : j * arrayBytes + 4 * i;
+			size_t	line = offset / CACHE_LINE;
+			if (find(recent, recent + RECENT, line) != recent + RECENT) continue;
+
+			recent[next] = line;
+			next = (next + 1) % RECENT;
+			misses++;
+		}
+	}
+	return (double)misses / mesh.nFaces;
+}
+
+static void report(const char* name, double interleaved, double separate)
+{
+	cout << "  " << name << ": " << interleaved << " ms interleaved, " << separate << " ms separate";
+	cout << " (x" << (interleaved > 0 ? separate / interleaved : 0) << ")" << endl;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2) { usage(argv[0]); return 1; }
+
+	long long	minFaces = 1000000;
+	int			repeat = 5;
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-faces") == 0 && i + 1 < argc)			minFaces = atoll(argv[++i]);
+		else if (strcmp(argv[i], "-repeat") == 0 && i + 1 < argc)	repeat = std::max(1, atoi(argv[++i]));
+		else { usage(argv[0]); return 1; }
+	}
+
+	Mesh	mesh;
+	if (!readMesh(argv[1], mesh)) return 1;
+
+	//midpoint subdivision keeps the shape and the vertex cache order
+	int		levels = 0;
+	for (long long n = mesh.nFaces; n > 0 && n < minFaces && n * 4 <= 0x7fffffff; n *= 4) levels++;
+	if (levels > 0)
+	{
+		Mesh	refined;
+		subdivideMesh(mesh, refined, levels, SUBDIVIDE_MIDPOINT);
+		deleteMesh(mesh);
+		mesh = refined;
+	}
+	cout << mesh.nFaces << " faces, " << mesh.nVertices << " vertices" << endl;
+	if (mesh.nFaces == 0) { deleteMesh(mesh); return 1; }
+
+	FaceArrays	arrays;
+	createFaceArrays(mesh, arrays);
+	Interleaved	interleaved = { mesh.face };
+	Separate	separate = { &arrays };
+
+	//back-to-front order of drawSortedFlatMesh() along a diagonal view
+	vector<int>		sorted(mesh.nFaces);
+	vector<float>	depth(mesh.nFaces);
+	for (int i = 0; i < mesh.nFaces; i++)
+	{
+		sorted[i] = i;
+		depth[i] = dot(mesh.fcenter[i], vec3(0.577f, 0.577f, 0.577f));
+	}
+	sort(sorted.begin(), sorted.end(), [&](int a, int b) { return depth[a] > depth[b]; });
+
+	vector<vec3>	normal(mesh.nFaces);
+	vector<int>		valence(mesh.nVertices);
+	float	checksum = 0;
+
+	cout << "Single-threaded, fastest of " << repeat << " runs:" << endl;
+	report("flat walk",
+		best(repeat, checksum, [&] { return flatWalk(mesh, interleaved, NULL); }),
+		best(repeat, checksum, [&] { return flatWalk(mesh, separate, NULL); }));
+	report("depth-sorted walk",
+		best(repeat, checksum, [&] { return flatWalk(mesh, interleaved, sorted.data()); }),
+		best(repeat, checksum, [&] { return flatWalk(mesh, separate, sorted.data()); }));
+	report("face normals",
+		best(repeat, checksum, [&] { return faceNormals(mesh, interleaved, normal.data()); }),
+		best(repeat, checksum, [&] { return faceNormals(mesh, separate, normal.data()); }));
+	report("vertex valence",
+		best(repeat, checksum, [&] { return vertexValence(mesh, interleaved, valence.data()); }),
+		best(repeat, checksum, [&] { return vertexValence(mesh, separate, valence.data()); }));
+
+	cout << "Index cache lines per face, stored order: ";
+	cout << indexLinesPerFace(mesh, NULL, true) << " interleaved, " << indexLinesPerFace(mesh, NULL, false) << " separate" << endl;
+	cout << "Index cache lines per face, depth-sorted: ";
+	cout << indexLinesPerFace(mesh, sorted.data(), true) << " interleaved, " << indexLinesPerFace(mesh, sorted.data(), false) << " separate" << endl;
+	cout << "(checksum " << checksum << ")" << endl;
+
+	deleteFaceArrays(arrays);
+	deleteMesh(mesh);
+
+	return 0;
+}
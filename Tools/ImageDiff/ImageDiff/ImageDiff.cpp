@@ -0,0 +1,79 @@
+#include "imageCompare.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <iostream>
+using namespace std;
+
+//compare an approximate rendering with its reference and gate it on an error budget
+//exit code: 0 within the budget, 1 over the budget, 2 for an error
+void usage(const char* program)
+{
+	cout << "Usage: " << program << " reference.ppm test.ppm [options]" << endl;
+	cout << "  -heatmap file.ppm  per-pixel FLIP-lite error heatmap" << endl;
+	cout << "  -psnr dB           minimum PSNR" << endl;
+	cout << "  -ssim value        minimum mean SSIM" << endl;
+	cout << "  -flip value        maximum mean FLIP-lite error" << endl;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3) { usage(argv[0]); return 2; }
+
+	const char*	referenceFile = argv[1];
+	const char*	testFile = argv[2];
+	const char*	heatmapFile = NULL;
+
+	//error budget: negative for no limit
+	double	minPSNR = -1, minSSIM = -1, maxFLIP = -1;
+
+	for (int i = 3; i < argc; i++)
+	{
+		if (i + 1 >= argc) { usage(argv[0]); return 2; }
+
+		if (strcmp(argv[i], "-heatmap") == 0)	heatmapFile = argv[++i];
+		else if (strcmp(argv[i], "-psnr") == 0)	minPSNR = atof(argv[++i]);
+		else if (strcmp(argv[i], "-ssim") == 0)	minSSIM = atof(argv[++i]);
+		else if (strcmp(argv[i], "-flip") == 0)	maxFLIP = atof(argv[++i]);
+		else { usage(argv[0]); return 2; }
+	}
+
+	Image	reference, test;
+	if (!readPPM(referenceFile, reference)) return 2;
+	if (!readPPM(testFile, test)) { deleteImage(reference); return 2; }
+
+	ImageDifference	diff;
+	bool	success = compareImages(reference, test, diff);
+
+	deleteImage(reference);
+	deleteImage(test);
+
+	if (!success) return 2;
+
+	cout << "Image: " << diff.w << " x " << diff.h << endl;
+	cout << "MSE = " << diff.mse << endl;
+	cout << "PSNR = " << diff.psnr << " dB" << endl;
+	cout << "SSIM = " << diff.ssim << endl;
+	cout << "FLIP-lite = " << diff.flip << " (max " << diff.maxError << ")" << endl;
+
+	if (heatmapFile)
+	{
+		Image	heatmap;
+		errorHeatmap(diff, heatmap);
+		if (writePPM(heatmapFile, heatmap)) cout << "Heatmap: " << heatmapFile << endl;
+		deleteImage(heatmap);
+	}
+
+	deleteImageDifference(diff);
+
+	//error budget
+	bool	accepted = true;
+	if (minPSNR >= 0 && diff.psnr < minPSNR)	{ accepted = false; cout << "PSNR below " << minPSNR << " dB" << endl; }
+	if (minSSIM >= 0 && diff.ssim < minSSIM)	{ accepted = false; cout << "SSIM below " << minSSIM << endl; }
+	if (maxFLIP >= 0 && diff.flip > maxFLIP)	{ accepted = false; cout << "FLIP-lite above " << maxFLIP << endl; }
+
+	cout << (accepted ? "ACCEPTED" : "REJECTED") << endl;
+
+	return accepted ? 0 : 1;
+}
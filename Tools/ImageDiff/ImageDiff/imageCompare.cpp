@@ -0,0 +1,417 @@
+#include "imageCompare.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <limits>
+#include <algorithm>
+#include <iostream>
+using namespace std;
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define USE_SSE2
+#endif
+
+//SSIM constants for the dynamic range 1 and its window radius (7x7)
+const float	SSIM_C1 = 0.01f * 0.01f;
+const float	SSIM_C2 = 0.03f * 0.03f;
+const int	SSIM_RADIUS = 3;
+
+bool createImage(Image& image, int w, int h)
+{
+	image.w = w;	image.h = h;
+	for (int c = 0; c < 3; c++)
+		image.plane[c] = new float[(size_t)w * h];
+
+	return true;
+}
+
+void deleteImage(Image& image)
+{
+	for (int c = 0; c < 3; c++)
+	{
+		delete[] image.plane[c];
+		image.plane[c] = NULL;
+	}
+	image.w = image.h = 0;
+}
+
+//skip white spaces and comments in a PPM header
+static void skipSpaces(FILE* fp)
+{
+	int		ch;
+	while ((ch = fgetc(fp)) != EOF)
+	{
+		if (ch == '#') { while ((ch = fgetc(fp)) != EOF && ch != '\n'); }
+		else if (ch != ' ' && ch != '\t' && ch != '\r' && ch != '\n') { ungetc(ch, fp); break; }
+	}
+}
+
+bool readPPM(const char* filename, Image& image)
+{
+	FILE*	fp = fopen(filename, "rb");
+	if (fp == NULL)
+	{
+		cerr << "Can't open " << filename << endl;
+		return false;
+	}
+
+	char	magic[3] = { 0, 0, 0 };
+	int		w = 0, h = 0, maxValue = 0;
+	bool	valid = fread(magic, 1, 2, fp) == 2 && strcmp(magic, "P6") == 0;
+	if (valid) { skipSpaces(fp); valid = fscanf(fp, "%d", &w) == 1; }
+	if (valid) { skipSpaces(fp); valid = fscanf(fp, "%d", &h) == 1; }
+	if (valid) { skipSpaces(fp); valid = fscanf(fp, "%d", &maxValue) == 1; }
+	valid = valid && fgetc(fp) != EOF && w > 0 && h > 0 && maxValue == 255;
+	if (!valid)
+	{
+		cerr << filename << " is not a binary 8-bit PPM" << endl;
+		fclose(fp);
+		return false;
+	}
+
+	unsigned char*	rgb = new unsigned char[(size_t)3 * w * h];
+	valid = fread(rgb, 3, (size_t)w * h, fp) == (size_t)w * h;
+	fclose(fp);
+
+	if (valid)
+	{
+		createImage(image, w, h);
+		for (size_t k = 0; k < (size_t)w * h; k++)
+			for (int c = 0; c < 3; c++)
+				image.plane[c][k] = rgb[3 * k + c] / 255.0f;
+	}
+	else cerr << filename << " is truncated" << endl;
+
+	delete[] rgb;
+
+	return valid;
+}
+
+bool writePPM(const char* filename, const Image& image)
+{
+	FILE*	fp = fopen(filename, "wb");
+	if (fp == NULL)
+	{
+		cerr << "Can't write " << filename << endl;
+		return false;
+	}
+
+	size_t	nPixels = (size_t)image.w * image.h;
+	unsigned char*	rgb = new unsigned char[3 * nPixels];
+	for (size_t k = 0; k < nPixels; k++)
+		for (int c = 0; c < 3; c++)
+			rgb[3 * k + c] = (unsigned char)(std::min(std::max(image.plane[c][k], 0.0f), 1.0f) * 255 + 0.5f);
+
+	fprintf(fp, "P6\n%d %d\n255\n", image.w, image.h);
+	bool	success = fwrite(rgb, 3, nPixels, fp) == nPixels;
+	success = (fclose(fp) == 0) && success;
+
+	delete[] rgb;
+
+	return success;
+}
+
+//sum of (a - b)^2 over n floats
+static double sumSquaredDifference(const float* a, const float* b, int n)
+{
+	int		i = 0;
+	double	sum = 0;
+
+#if defined(USE_SSE2)
+	__m128	acc = _mm_setzero_ps();
+	for (; i + 4 <= n; i += 4)
+	{
+		__m128	d = _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+		acc = _mm_add_ps(acc, _mm_mul_ps(d, d));
+	}
+	float	lanes[4];
+	_mm_storeu_ps(lanes, acc);
+	sum = (double)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+
+	for (; i < n; i++)
+		sum += (double)(a[i] - b[i]) * (a[i] - b[i]);
+
+	return sum;
+}
+
+//dst[i] += src[i]
+static inline void addRow(float* dst, const float* src, int n)
+{
+	int		i = 0;
+#if defined(USE_SSE2)
+	for (; i + 4 <= n; i += 4)
+		_mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_loadu_ps(src + i)));
+#endif
+	for (; i < n; i++)
+		dst[i] += src[i];
+}
+
+//dst[i] = a[i] * b[i]
+static inline void multiplyRow(float* dst, const float* a, const float* b, int n)
+{
+	int		i = 0;
+#if defined(USE_SSE2)
+	for (; i + 4 <= n; i += 4)
+		_mm_storeu_ps(dst + i, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+#endif
+	for (; i < n; i++)
+		dst[i] = a[i] * b[i];
+}
+
+//mean of the (2r+1)x(2r+1) window around every pixel whose window lies in the image
+//out is a (w-2r)x(h-2r) image
+static void boxFilter(const float* in, float* out, int w, int h, int r)
+{
+	int		wo = w - 2 * r, ho = h - 2 * r;
+	float	scale = 1.0f / ((2 * r + 1) * (2 * r + 1));
+
+#pragma omp parallel
+	{
+		float*	column = new float[w];	//vertical sums of a row
+
+#pragma omp for schedule(static)
+		for (int y = 0; y < ho; y++)
+		{
+			//vertical pass over contiguous rows
+			memcpy(column, in + (size_t)w * y, sizeof(float) * w);
+			for (int k = 1; k <= 2 * r; k++)
+				addRow(column, in + (size_t)w * (y + k), w);
+
+			//horizontal pass with shifted rows
+			float*	o = out + (size_t)wo * y;
+			memcpy(o, column, sizeof(float) * wo);
+			for (int k = 1; k <= 2 * r; k++)
+				addRow(o, column + k, wo);
+
+			for (int x = 0; x < wo; x++)
+				o[x] *= scale;
+		}
+
+		delete[] column;
+	}
+}
+
+//Rec. 709 luminance
+static void luminance(const Image& image, float* Y)
+{
+	const float* R = image.plane[0];
+	const float* G = image.plane[1];
+	const float* B = image.plane[2];
+
+	int		n = image.w * image.h;
+#pragma omp parallel for schedule(static)
+	for (int k = 0; k < n; k++)
+		Y[k] = 0.2126f * R[k] + 0.7152f * G[k] + 0.0722f * B[k];
+}
+
+//mean SSIM of the luminance over the windows inside the image
+static double meanSSIM(const float* X, const float* Y, int w, int h)
+{
+	int		r = SSIM_RADIUS;
+	if (w <= 2 * r || h <= 2 * r) return 1;
+
+	int		n = w * h;
+	int		wo = w - 2 * r, ho = h - 2 * r;
+
+	float*	XX = new float[n];
+	float*	YY = new float[n];
+	float*	XY = new float[n];
+#pragma omp parallel for schedule(static)
+	for (int y = 0; y < h; y++)
+	{
+		size_t	k = (size_t)w * y;
+		multiplyRow(XX + k, X + k, X + k, w);
+		multiplyRow(YY + k, Y + k, Y + k, w);
+		multiplyRow(XY + k, X + k, Y + k, w);
+	}
+
+	//local moments
+	float*	mu_x = new float[wo * ho];
+	float*	mu_y = new float[wo * ho];
+	float*	m_xx = new float[wo * ho];
+	float*	m_yy = new float[wo * ho];
+	float*	m_xy = new float[wo * ho];
+	boxFilter(X, mu_x, w, h, r);
+	boxFilter(Y, mu_y, w, h, r);
+	boxFilter(XX, m_xx, w, h, r);
+	boxFilter(YY, m_yy, w, h, r);
+	boxFilter(XY, m_xy, w, h, r);
+
+	double	sum = 0;
+#pragma omp parallel for schedule(static) reduction(+:sum)
+	for (int y = 0; y < ho; y++)
+	{
+		int		x = 0;
+		size_t	k = (size_t)wo * y;
+		double	rowSum = 0;
+
+#if defined(USE_SSE2)
+		const __m128	two = _mm_set1_ps(2), c1 = _mm_set1_ps(SSIM_C1), c2 = _mm_set1_ps(SSIM_C2);
+		__m128	acc = _mm_setzero_ps();
+		for (; x + 4 <= wo; x += 4)
+		{
+			__m128	mx = _mm_loadu_ps(mu_x + k + x), my = _mm_loadu_ps(mu_y + k + x);
+			__m128	mxx = _mm_mul_ps(mx, mx), myy = _mm_mul_ps(my, my), mxy = _mm_mul_ps(mx, my);
+			__m128	sxx = _mm_sub_ps(_mm_loadu_ps(m_xx + k + x), mxx);
+			__m128	syy = _mm_sub_ps(_mm_loadu_ps(m_yy + k + x), myy);
+			__m128	sxy = _mm_sub_ps(_mm_loadu_ps(m_xy + k + x), mxy);
+
+			__m128	num = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(two, mxy), c1), _mm_add_ps(_mm_mul_ps(two, sxy), c2));
+			__m128	den = _mm_mul_ps(_mm_add_ps(_mm_add_ps(mxx, myy), c1), _mm_add_ps(_mm_add_ps(sxx, syy), c2));
+			acc = _mm_add_ps(acc, _mm_div_ps(num, den));
+		}
+		float	lanes[4];
+		_mm_storeu_ps(lanes, acc);
+		rowSum = (double)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+
+		for (; x < wo; x++)
+		{
+			float	mx = mu_x[k + x], my = mu_y[k + x];
+			float	sxx = m_xx[k + x] - mx * mx;
+			float	syy = m_yy[k + x] - my * my;
+			float	sxy = m_xy[k + x] - mx * my;
+
+			rowSum += ((2 * mx * my + SSIM_C1) * (2 * sxy + SSIM_C2)) / ((mx * mx + my * my + SSIM_C1) * (sxx + syy + SSIM_C2));
+		}
+
+		sum += rowSum;
+	}
+
+	delete[] XX;	delete[] YY;	delete[] XY;
+	delete[] mu_x;	delete[] mu_y;
+	delete[] m_xx;	delete[] m_yy;	delete[] m_xy;
+
+	return sum / ((double)wo * ho);
+}
+
+//sRGB in [0, 1] to CIE L*a*b* with the D65 white
+static void rgbToLab(float R, float G, float B, float lab[3])
+{
+	float	rgb[3] = { R, G, B };
+	for (int c = 0; c < 3; c++)
+		rgb[c] = (rgb[c] <= 0.04045f) ? rgb[c] / 12.92f : powf((rgb[c] + 0.055f) / 1.055f, 2.4f);
+
+	float	xyz[3];
+	xyz[0] = (0.4124f * rgb[0] + 0.3576f * rgb[1] + 0.1805f * rgb[2]) / 0.95047f;
+	xyz[1] = (0.2126f * rgb[0] + 0.7152f * rgb[1] + 0.0722f * rgb[2]);
+	xyz[2] = (0.0193f * rgb[0] + 0.1192f * rgb[1] + 0.9505f * rgb[2]) / 1.08883f;
+
+	for (int c = 0; c < 3; c++)
+		xyz[c] = (xyz[c] > 0.008856f) ? cbrtf(xyz[c]) : 7.787f * xyz[c] + 16.0f / 116;
+
+	lab[0] = 116 * xyz[1] - 16;
+	lab[1] = 500 * (xyz[0] - xyz[1]);
+	lab[2] = 200 * (xyz[1] - xyz[2]);
+}
+
+//Sobel gradient magnitude of the luminance at (x, y) with clamped borders
+static inline float gradient(const float* Y, int w, int h, int x, int y)
+{
+	int		x0 = std::max(x - 1, 0), x1 = std::min(x + 1, w - 1);
+	int		y0 = std::max(y - 1, 0), y1 = std::min(y + 1, h - 1);
+
+	float	gx = (Y[w * y0 + x1] + 2 * Y[w * y + x1] + Y[w * y1 + x1]) - (Y[w * y0 + x0] + 2 * Y[w * y + x0] + Y[w * y1 + x0]);
+	float	gy = (Y[w * y1 + x0] + 2 * Y[w * y1 + x] + Y[w * y1 + x1]) - (Y[w * y0 + x0] + 2 * Y[w * y0 + x] + Y[w * y0 + x1]);
+
+	return sqrtf(gx * gx + gy * gy) / 4;	//in [0, sqrt(2)]
+}
+
+bool compareImages(const Image& reference, const Image& test, ImageDifference& diff)
+{
+	memset(&diff, 0, sizeof(diff));
+
+	if (reference.w != test.w || reference.h != test.h)
+	{
+		cerr << "Different image sizes: " << reference.w << " x " << reference.h;
+		cerr << " and " << test.w << " x " << test.h << endl;
+		return false;
+	}
+
+	int		w = reference.w, h = reference.h;
+	int		n = w * h;
+	diff.w = w;	diff.h = h;
+
+	//MSE and PSNR over the RGB channels
+	double	sse = 0;
+#pragma omp parallel for schedule(static) reduction(+:sse)
+	for (int y = 0; y < h; y++)
+		for (int c = 0; c < 3; c++)
+			sse += sumSquaredDifference(reference.plane[c] + (size_t)w * y, test.plane[c] + (size_t)w * y, w);
+
+	diff.mse = sse / (3.0 * n);
+	diff.psnr = (diff.mse > 0) ? 10 * log10(1.0 / diff.mse) : numeric_limits<double>::infinity();
+
+	//SSIM of the luminance
+	float*	Y_ref = new float[n];
+	float*	Y_test = new float[n];
+	luminance(reference, Y_ref);
+	luminance(test, Y_test);
+
+	diff.ssim = meanSSIM(Y_ref, Y_test, w, h);
+
+	//FLIP-lite: the larger of the color difference (CIE76 delta E / 100)
+	//and the edge difference (Sobel magnitudes of the luminance)
+	diff.errorMap = new float[n];
+
+	double	sum = 0, maxError = 0;
+#pragma omp parallel for schedule(static) reduction(+:sum)
+	for (int y = 0; y < h; y++)
+	{
+		double	rowMax = 0;
+		for (int x = 0; x < w; x++)
+		{
+			int		k = w * y + x;
+
+			float	lab_ref[3], lab_test[3];
+			rgbToLab(reference.plane[0][k], reference.plane[1][k], reference.plane[2][k], lab_ref);
+			rgbToLab(test.plane[0][k], test.plane[1][k], test.plane[2][k], lab_test);
+
+			float	dL = lab_ref[0] - lab_test[0], da = lab_ref[1] - lab_test[1], db = lab_ref[2] - lab_test[2];
+			float	color = std::min(sqrtf(dL * dL + da * da + db * db) / 100, 1.0f);
+			float	feature = std::min(fabsf(gradient(Y_ref, w, h, x, y) - gradient(Y_test, w, h, x, y)), 1.0f);
+
+			float	e = std::max(color, feature);
+			diff.errorMap[k] = e;
+
+			sum += e;
+			rowMax = std::max(rowMax, (double)e);
+		}
+
+#pragma omp critical(maxError)
+		maxError = std::max(maxError, rowMax);
+	}
+
+	diff.flip = sum / n;
+	diff.maxError = maxError;
+
+	delete[] Y_ref;
+	delete[] Y_test;
+
+	return true;
+}
+
+void deleteImageDifference(ImageDifference& diff)
+{
+	delete[] diff.errorMap;
+	diff.errorMap = NULL;
+}
+
+void errorHeatmap(const ImageDifference& diff, Image& heatmap)
+{
+	createImage(heatmap, diff.w, diff.h);
+
+	int		n = diff.w * diff.h;
+	for (int k = 0; k < n; k++)
+	{
+		float	e = std::min(std::max(diff.errorMap[k], 0.0f), 1.0f);
+
+		//black (0) -> red (1/3) -> yellow (2/3) -> white (1)
+		heatmap.plane[0][k] = std::min(3 * e, 1.0f);
+		heatmap.plane[1][k] = std::min(std::max(3 * e - 1, 0.0f), 1.0f);
+		heatmap.plane[2][k] = std::min(std::max(3 * e - 2, 0.0f), 1.0f);
+	}
+}
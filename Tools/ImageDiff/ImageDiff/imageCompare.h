@@ -0,0 +1,37 @@
+#ifndef __IMAGE_COMPARE_H_
+#define __IMAGE_COMPARE_H_
+
+//RGB image stored as float planes in [0, 1] for vectorized processing
+struct Image
+{
+	int		w, h;
+	float*	plane[3];	//R, G, B planes of w x h floats
+};
+
+bool createImage(Image& image, int w, int h);
+void deleteImage(Image& image);
+
+//binary PPM (P6) with 8-bit channels, e.g., written by the ray tracer
+bool readPPM(const char* filename, Image& image);
+bool writePPM(const char* filename, const Image& image);
+
+//difference between a reference image and an approximation of it
+struct ImageDifference
+{
+	double	mse;		//mean squared error over the RGB channels
+	double	psnr;		//dB, infinity for identical images
+	double	ssim;		//mean structural similarity of the luminance
+	double	flip;		//mean FLIP-lite error in [0, 1]
+	double	maxError;	//maximum FLIP-lite error of a pixel
+
+	int		w, h;
+	float*	errorMap;	//FLIP-lite error of each pixel
+};
+
+bool compareImages(const Image& reference, const Image& test, ImageDifference& diff);
+void deleteImageDifference(ImageDifference& diff);
+
+//black-red-yellow-white heatmap of the per-pixel errors in [0, 1]
+void errorHeatmap(const ImageDifference& diff, Image& heatmap);
+
+#endif
@@ -0,0 +1,184 @@
+#include "mesh.h"
+#include "meshWeld.h"
+#include "meshHalfEdge.h"
+#include "meshOptimize.h"
+#include "meshSimplify.h"
+#include "meshCache.h"
+#include "mappedFile.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+using namespace std;
+using namespace glm;
+
+//qualify an asset before it goes into a scene: parse it as stored, then run the stages
+//of the shared loader one by one, timing each and reporting what it finds
+//the exit code is 2 if the surface has non-manifold edges or vertices,
+//or degenerate or duplicate faces, 1 if it cannot be read at all
+void usage(const char* program)
+{
+	cout << "Usage: " << program << " input.off|ply|glb|mcache [options]" << endl;
+	cout << "  -tolerance t  weld distance relative to the bounding box diagonal (default 1e-6)" << endl;
+	cout << "  -cache n      vertex cache size for the ACMR (default 16)" << endl;
+	cout << "  -nolod        skip the simplification" << endl;
+}
+
+static double elapsed(chrono::steady_clock::time_point start)
+{
+	return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+static void stage(const char* name, double ms)
+{
+	cout << "  " << name << ": " << ms << " ms, ";
+}
+
+//arrays of createMesh(): positions and normals per vertex, indices, normals and centers per face
+static double meshMegabytes(const Mesh& mesh)
+{
+	return ((double)mesh.nVertices * 2 * sizeof(vec3) + (double)mesh.nFaces * (sizeof(uvec3) + 2 * sizeof(vec3))) / (1 << 20);
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2) { usage(argv[0]); return 1; }
+
+	const char*	inputFile = argv[1];
+	float		tolerance = WELD_TOLERANCE;
+	int			cacheSize = VERTEX_CACHE_SIZE;
+	bool		lod = true;
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-tolerance") == 0 && i + 1 < argc)	tolerance = (float)atof(argv[++i]);
+		else if (strcmp(argv[i], "-cache") == 0 && i + 1 < argc)	cacheSize = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-nolod") == 0)					lod = false;
+		else { usage(argv[0]); return 1; }
+	}
+	if (tolerance < 0 || cacheSize < 3) { usage(argv[0]); return 1; }
+
+	MappedFile	file;
+	size_t		fileSize = 0;
+	if (mapFile(inputFile, file))
+	{
+		fileSize = file.size;
+		unmapFile(file);
+	}
+
+	cout << inputFile << ": " << fileSize / 1024.0 / 1024.0 << " MB" << endl;
+
+	//parse
+	auto	start = chrono::steady_clock::now();
+	Mesh	mesh;
+	if (!parseMesh(inputFile, mesh)) return 1;
+	double	parseTime = elapsed(start);
+
+	stage("parse", parseTime);
+	cout << mesh.nVertices << " vertices, " << mesh.nFaces << " faces, " << meshMegabytes(mesh) << " MB in memory";
+	if (parseTime > 0 && mesh.cache.data == NULL) cout << ", " << fileSize / 1024.0 / 1024.0 / (parseTime / 1000) << " MB/s";
+	cout << endl;
+
+	//the stored order as delivered, before the stages reorder anything
+	VertexCacheStats	stored = analyzeVertexCache(mesh, cacheSize);
+
+	start = chrono::steady_clock::now();
+	WeldStats	weld = weldMesh(mesh, tolerance);
+	stage("weld", elapsed(start));
+	cout << weld.nWeldedVertices << " welded, " << weld.nDegenerateFaces << " degenerate and ";
+	cout << weld.nDuplicateFaces << " duplicate faces, " << weld.nUnusedVertices << " unused vertices" << endl;
+
+	start = chrono::steady_clock::now();
+	computeNormals(mesh);
+	computeCenters(mesh);
+	stage("normals", elapsed(start));
+	cout << "bounding box (" << mesh.bmin.x << ", " << mesh.bmin.y << ", " << mesh.bmin.z << ") - (";
+	cout << mesh.bmax.x << ", " << mesh.bmax.y << ", " << mesh.bmax.z << "), diagonal " << length(mesh.bmax - mesh.bmin) << endl;
+
+	start = chrono::steady_clock::now();
+	HalfEdges	halfEdges;
+	buildHalfEdges(mesh, halfEdges);
+	double	halfEdgeTime = elapsed(start);
+
+	int		nIsolated = 0;
+	for (int v = 0; v < mesh.nVertices; v++) if (halfEdges.vertexEdge[v] < 0) nIsolated++;
+
+	//Euler characteristic V - E + F with the interior edges counted once
+	long long	nEdges = ((long long)3 * mesh.nFaces + halfEdges.nBoundaryEdges) / 2;
+	long long	euler = (long long)mesh.nVertices - nIsolated - nEdges + mesh.nFaces;
+	bool	manifold = halfEdges.nNonManifoldEdges == 0 && halfEdges.nNonManifoldVertices == 0;
+
+	stage("manifoldness", halfEdgeTime);
+	cout << (manifold ? "manifold" : "NON-MANIFOLD") << ", " << halfEdges.nBoundaryEdges << " border edges, ";
+	cout << halfEdges.nNonManifoldEdges << " non-manifold edges, " << halfEdges.nNonManifoldVertices << " non-manifold vertices, ";
+	cout << nIsolated << " isolated vertices, Euler characteristic " << euler << endl;
+	deleteHalfEdges(halfEdges);
+
+	VertexCacheStats	welded = analyzeVertexCache(mesh, cacheSize);
+	start = chrono::steady_clock::now();
+	optimizeMesh(mesh, true, cacheSize);
+	stage("cache optimization", elapsed(start));
+	VertexCacheStats	optimized = analyzeVertexCache(mesh, cacheSize);
+	cout << "ACMR " << stored.acmr << " stored, " << welded.acmr << " welded -> " << optimized.acmr;
+	cout << ", ATVR " << stored.atvr << " -> " << optimized.atvr << " (" << cacheSize << " entries)" << endl;
+
+	if (lod)
+	{
+		start = chrono::steady_clock::now();
+		MeshLOD	chain;
+		buildMeshLOD(mesh, chain);
+		stage("simplification", elapsed(start));
+
+		double	megabytes = 0;
+		for (int l = 1; l < chain.nLevels; l++) megabytes += meshMegabytes(*chain.level[l]);
+		cout << chain.nLevels << " levels down to " << chain.level[chain.nLevels - 1]->nFaces << " faces, ";
+		cout << "error " << chain.error[chain.nLevels - 1] / std::max(length(mesh.bmax - mesh.bmin), 1e-30f) << " of the diagonal, ";
+		cout << megabytes << " MB" << endl;
+		deleteMeshLOD(chain);
+	}
+
+	//the cache readMesh() keeps next to the file, written to and mapped from the temporary folder instead
+	//for the times not to depend on whether an earlier run left one there, nor to leave one
+	string	cacheFile = (filesystem::temp_directory_path() / filesystem::path(inputFile).filename()).string() + ".mcache";
+	if (mapFile(inputFile, file))
+	{
+		start = chrono::steady_clock::now();
+		uint64_t	sourceHash = hashContent(file.data, file.size);
+		uint64_t	sourceSize = file.size;
+		bool		written = writeMeshCache(cacheFile.c_str(), mesh, sourceHash, sourceSize);
+		double		writeTime = elapsed(start);
+		unmapFile(file);
+
+		//a later load: hash the source, then map the cache as readMesh() does
+		Mesh	cached;
+		bool	mapped = false;
+		start = chrono::steady_clock::now();
+		if (written && mapFile(inputFile, file))
+		{
+			mapped = mapMeshCache(cacheFile.c_str(), hashContent(file.data, file.size), file.size, cached);
+			unmapFile(file);
+		}
+		double	mapTime = elapsed(start);
+
+		if (written)
+		{
+			stage("cache write", writeTime);
+			cout << meshMegabytes(mesh) << " MB" << endl;
+		}
+		if (mapped)
+		{
+			stage("cache map", mapTime);
+			cout << cached.nVertices << " vertices, " << cached.nFaces << " faces" << endl;
+			deleteMesh(cached);
+		}
+		remove(cacheFile.c_str());
+	}
+	deleteMesh(mesh);
+
+	bool	qualified = manifold && weld.nDegenerateFaces == 0 && weld.nDuplicateFaces == 0;
+	cout << (qualified ? "OK" : "ISSUES FOUND") << endl;
+
+	return qualified ? 0 : 2;
+}
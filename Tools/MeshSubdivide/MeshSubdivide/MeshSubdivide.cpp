@@ -0,0 +1,90 @@
+#include "mesh.h"
+#include "meshCache.h"
+#include "meshSubdivide.h"
+#include "mappedFile.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <chrono>
+#include <iostream>
+using namespace std;
+
+//refine a mesh into a stress variant with 4^levels times the faces, written as a mesh cache
+//that readMesh() maps directly, e.g., m01_bunny_x256.mcache with 1.1M faces
+void usage(const char* program)
+{
+	cout << "Usage: " << program << " input.off|ply|glb [options]" << endl;
+	cout << "  -levels n       subdivision steps, 4^n times the faces (default 4, i.e., 256x)" << endl;
+	cout << "  -midpoint       flat midpoint subdivision instead of Loop subdivision" << endl;
+	cout << "  -o file.mcache  output (default input_x<factor>.mcache)" << endl;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2) { usage(argv[0]); return 1; }
+
+	const char*	inputFile = argv[1];
+	string		outputFile;
+	int			levels = 4;
+	SubdivisionScheme	scheme = SUBDIVIDE_LOOP;
+
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-midpoint") == 0)					scheme = SUBDIVIDE_MIDPOINT;
+		else if (strcmp(argv[i], "-levels") == 0 && i + 1 < argc)	levels = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)		outputFile = argv[++i];
+		else { usage(argv[0]); return 1; }
+	}
+	if (levels < 0) { usage(argv[0]); return 1; }
+
+	Mesh	mesh;
+	if (!readMesh(inputFile, mesh)) return 1;
+
+	//the faces have to fit in int
+	long long	nFaces = mesh.nFaces;
+	for (int l = 0; l < levels; l++) nFaces *= 4;
+	if (nFaces > 0x7fffffff)
+	{
+		cerr << levels << " levels give too many faces: " << nFaces << endl;
+		deleteMesh(mesh);
+		return 1;
+	}
+
+	long long	factor = nFaces / (mesh.nFaces > 0 ? mesh.nFaces : 1);
+	if (outputFile.empty())
+	{
+		string	stem(inputFile);
+		size_t	dot = stem.find_last_of('.');
+		size_t	slash = stem.find_last_of("/\\");
+		if (dot != string::npos && (slash == string::npos || dot > slash)) stem.resize(dot);
+		outputFile = stem + "_x" + to_string(factor) + ".mcache";
+	}
+
+	auto	start = chrono::steady_clock::now();
+
+	Mesh	refined;
+	subdivideMesh(mesh, refined, levels, scheme);
+
+	double	seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	cout << subdivisionSchemeName[scheme] << " subdivision x" << factor << ": ";
+	cout << mesh.nFaces << " -> " << refined.nFaces << " faces, " << refined.nVertices << " vertices in " << seconds << " s" << endl;
+
+	//tagged with the content of the input
+	MappedFile	input;
+	uint64_t	sourceHash = 0, sourceSize = 0;
+	if (mapFile(inputFile, input))
+	{
+		sourceHash = hashContent(input.data, input.size);
+		sourceSize = input.size;
+		unmapFile(input);
+	}
+
+	bool	success = writeMeshCache(outputFile.c_str(), refined, sourceHash, sourceSize);
+	if (success) cout << "Wrote " << outputFile << endl;
+
+	deleteMesh(refined);
+	deleteMesh(mesh);
+
+	return success ? 0 : 1;
+}